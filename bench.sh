@@ -0,0 +1,83 @@
+#!/bin/bash
+
+if ! test -f ./aptinfo
+then
+    echo "aptinfo needs to be built first"
+    exit 1
+fi
+
+test -f Packages || curl -s http://archive.ubuntu.com/ubuntu/dists/jammy/main/binary-amd64/Packages.gz | gunzip > Packages
+
+runs=5
+size=$(stat -c %s Packages)
+package=$(awk '/^Package: / { print $2; exit }' Packages)
+
+parse()
+{
+    local start=$(date +%s%N)
+
+    for i in $(seq $runs)
+    do
+        ./aptinfo --no-cache -j$1 size $package Packages > /dev/null
+    done
+
+    local end=$(date +%s%N)
+
+    awk -v jobs=$1 -v size=$size -v runs=$runs -v ns=$((end - start)) 'BEGIN { printf "parse -j%-3d %8.1f MB/s\n", jobs, size * runs / 1000000 / (ns / 1000000000) }'
+}
+
+echo "====="
+echo "PARSE"
+echo "====="
+parse 1
+test $(nproc) -gt 1 && parse $(nproc)
+
+resolve()
+{
+    ./aptinfo resolve $1 Packages > /dev/null
+
+    local start=$(date +%s%N)
+
+    for i in $(seq $runs)
+    do
+        ./aptinfo resolve $1 Packages > /dev/null
+    done
+
+    local end=$(date +%s%N)
+
+    awk -v name=$1 -v runs=$runs -v ns=$((end - start)) 'BEGIN { printf "resolve %-16s %8.2f ms\n", name, ns / runs / 1000000 }'
+}
+
+minimize()
+{
+    local field=Installed-Size
+
+    test $2 = size && field=Size
+
+    local before=$(./aptinfo size "$(./aptinfo resolve $1 Packages | paste -sd,)" Packages | awk -v field=$field '$1 == field ":" { print $2 }')
+    local start=$(date +%s%N)
+
+    for i in $(seq $runs)
+    do
+        ./aptinfo resolve --minimize=$2 $1 Packages 2> /dev/null > /dev/null
+    done
+
+    local end=$(date +%s%N)
+    local after=$(./aptinfo size "$(./aptinfo resolve --minimize=$2 $1 Packages 2> /dev/null | paste -sd,)" Packages | awk -v field=$field '$1 == field ":" { print $2 }')
+
+    awk -v name=$1 -v cost=$2 -v runs=$runs -v ns=$((end - start)) -v before=$before -v after=$after -v field=$field 'BEGIN { printf "minimize=%-5s %-16s %8.2f ms %12d -> %12d %s\n", cost, name, ns / runs / 1000000, before, after, field }'
+}
+
+root=$package
+grep -q '^Package: ubuntu-server$' Packages && root=ubuntu-server
+
+echo "======="
+echo "RESOLVE"
+echo "======="
+resolve $root
+
+echo "========"
+echo "MINIMIZE"
+echo "========"
+minimize $root isize
+minimize $root size
@@ -2,13 +2,29 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "sys.h"
-
-#define NUM_CMDS                        8
-#define MAX_ENTRIES                     0x20000
-#define FIELDBUFFER_SIZE                0x4000
-#define LETTERS_UPSTREAM                "~.+-:"
-#define LETTERS_REVISION                 "~.+"
+#include "version.h"
+#include "output.h"
+#include "scan.h"
+
+#define NUM_CMDS                        21
+#define MAX_FILES                       256
+#define MAX_JOBS                        256
+#define BATCH_ARGS                      64
+#define REQUEST_SIZE                    0x10000
+#define RELOAD_DELAY                    200
+#define MAX_CONFLICTS                   256
+#define MAX_BACKTRACKS                  100000
+#define MINIMIZE_BUDGET                 1000
+#define SIZE_CHUNK                      64
+#define WALK_CHUNK                      256
+#define CHUNK_SIZE                      0x100000
+#define STREAM_SIZE                     0xfffff000
+#define CACHE_MAGIC                     0x49545041
+#define CACHE_VERSION                   6
+#define KEY_BUFFER                      VERSION_KEYSIZE(256)
+#define BITS_LONG                       (sizeof (unsigned long) * 8)
 
 enum state
 {
@@ -34,10 +50,30 @@ enum relation
 
 };
 
+enum field
+{
+
+    FIELD_PREDEPENDS = 1,
+    FIELD_DEPENDS = 2,
+    FIELD_RECOMMENDS = 4,
+    FIELD_SUGGESTS = 8,
+    FIELD_CONFLICTS = 16,
+    FIELD_BREAKS = 32
+
+};
+
+enum scope
+{
+
+    SCOPE_NONE = 1,
+    SCOPE_INDEX = 2,
+    SCOPE_PROCESS = 3
+
+};
+
 enum compare
 {
 
-    COMPARE_CONTINUE = 0,
     COMPARE_VALID = 1,
     COMPARE_INVALID = 2
 
@@ -69,214 +105,521 @@ struct vstring
 
 };
 
-struct command
+struct slice
+{
+
+    unsigned int offset;
+    unsigned int length;
+
+};
+
+struct vslice
+{
+
+    struct slice name;
+    struct slice arch;
+    struct slice relation;
+    struct slice version;
+
+};
+
+struct file
 {
 
     char *name;
-    int (*handle)(int argc, char **argv);
+    char *data;
+    unsigned int count;
+    unsigned int size;
+    unsigned int mapped;
+    unsigned long mtime;
 
 };
 
 struct entry
 {
 
-    char namedata[64];
-    char versiondata[64];
-    char archdata[24];
-    struct vstring vstring;
+    struct vslice vslice;
+    struct slice key;
     unsigned int size;
     unsigned int isize;
-    unsigned int count;
-    char *filename;
+    unsigned int file;
     unsigned int offset;
-    unsigned int matched;
+    unsigned int count;
+    unsigned int next;
 
 };
 
-static void substring_init(struct substring *substring)
+struct provide
 {
 
-    substring->offset = 0;
-    substring->end = 0;
+    struct vslice vslice;
+    struct slice key;
+    unsigned int entry;
+    unsigned int next;
 
-}
+};
 
-static void snippet_init(struct snippet *snippet, char *data, unsigned int length)
+struct edge
 {
 
-    snippet->data = data;
-    snippet->length = length;
+    struct vslice vslice;
+    struct slice key;
+    unsigned int entry;
+    unsigned int field;
+    unsigned int alternative;
 
-}
+};
 
-static unsigned int snippet_match(struct snippet *snippet, struct snippet *snippet2)
+struct group
 {
 
-    return (snippet->length == snippet2->length) && !memcmp(snippet->data, snippet2->data, snippet->length);
+    unsigned int field;
+    unsigned int start;
 
-}
+};
 
-static void vstring_init(struct vstring *vstring, char *data, unsigned int length, struct substring *name, struct substring *arch, struct substring *relation, struct substring *version)
+struct alternative
 {
 
-    snippet_init(&vstring->name, data + name->offset, (name->end > name->offset) ? name->end - name->offset + 1 : 0);
-    snippet_init(&vstring->arch, data + arch->offset, (arch->end > arch->offset) ? arch->end - arch->offset + 1 : 0);
-    snippet_init(&vstring->relation, data + relation->offset, (relation->end > relation->offset) ? relation->end - relation->offset + 1 : 0);
-    snippet_init(&vstring->version, data + version->offset, (version->end > version->offset) ? version->end - version->offset + 1 : 0);
+    unsigned int target;
+    unsigned int relation;
+    struct slice key;
+    unsigned int start;
 
-}
+};
 
-static unsigned int append(char *s1, char *s2, unsigned int length, unsigned int offset)
+enum minimize
 {
 
-    memcpy(s1 + offset, s2, length);
+    MINIMIZE_SIZE = 1,
+    MINIMIZE_ISIZE = 2
+
+};
+
+struct decision
+{
 
-    return offset + length;
+    unsigned int group;
+    unsigned int candidate;
+    unsigned int position;
+    unsigned int ntrail;
 
-}
+};
 
-static unsigned int findfirst(char *version, unsigned int length, char c, unsigned int offset)
+struct clause
 {
 
-    unsigned int i;
+    unsigned int start;
+    unsigned int count;
 
-    for (i = offset; i < length; i++)
-    {
+};
 
-        if (version[i] == c)
-            return i;
+struct member
+{
 
-    }
+    unsigned int entry;
+    unsigned int clause;
+    unsigned int next;
 
-    return 0;
+};
 
-}
+struct solver
+{
 
-static unsigned int findlast(char *version, unsigned int length, char c, unsigned int offset)
+    struct query *query;
+    struct index *index;
+    unsigned int fields;
+    unsigned int *roots;
+    unsigned int nroots;
+    unsigned int *forbidden;
+    unsigned int *forbidder;
+    unsigned int *watches;
+    unsigned int *parents;
+    unsigned int *positions;
+    struct decision *decisions;
+    unsigned int ndecisions;
+    unsigned int maxdecisions;
+    struct clause *clauses;
+    unsigned int nclauses;
+    unsigned int maxclauses;
+    struct member *members;
+    unsigned int nmembers;
+    unsigned int maxmembers;
+    unsigned int backtracks;
+    unsigned int failnode;
+    unsigned int failgroup;
+    unsigned int strict;
+    unsigned int minimize;
+    unsigned long cost;
+
+};
+
+struct bounds
 {
 
-    unsigned int last = length;
-    unsigned int i;
+    unsigned int *starts;
+    unsigned int *counts;
+    unsigned int *pool;
+    unsigned int npool;
+    unsigned int maxpool;
+    unsigned int *stamps;
+    unsigned int stamp;
+    unsigned int *stack;
 
-    for (i = offset; i < length; i++)
-    {
+};
 
-        if (version[i] == c)
-            last = i;
+struct range
+{
 
-    }
+    pthread_mutex_t lock;
+    unsigned int next;
+    unsigned int end;
 
-    return last;
+};
 
-}
+struct checker
+{
 
-static unsigned int isnumerical(unsigned int v)
+    struct index *index;
+    unsigned int *items;
+    unsigned int nitems;
+    unsigned char *failed;
+    unsigned char *installable;
+    struct range ranges[MAX_JOBS];
+    unsigned int nranges;
+    unsigned int nworkers;
+
+};
+
+struct sizer
 {
 
-    return (v >= '0' && v <= '9');
+    unsigned int ncomponents;
+    unsigned int *offsets;
+    unsigned int *targets;
+    unsigned int *counts;
+    unsigned long *sizes;
+    unsigned long *isizes;
+    unsigned int *closures;
+    unsigned long *totals;
+    unsigned long *itotals;
+    unsigned int *items;
+    unsigned int nitems;
+    unsigned int next;
 
-}
+};
 
-static unsigned int isalphabetical(unsigned int v)
+struct closure
 {
 
-    return (v >= 'a' && v <= 'z') || (v >= 'A' && v <= 'Z');
+    unsigned int entry;
+    unsigned int count;
+    unsigned long size;
+    unsigned long isize;
 
-}
+};
 
-static unsigned int isspecial(unsigned int v, char *letters)
+struct step
 {
 
-    unsigned int i;
+    unsigned int node;
+    unsigned int parent;
 
-    for (i = 0; i < strlen(letters); i++)
-    {
+};
 
-        if (letters[i] == v)
-            return 1;
+struct frontier
+{
 
-    }
+    unsigned int *nodes;
+    unsigned int count;
+    unsigned int max;
 
-    return 0;
+};
 
-}
+struct walker
+{
 
-static unsigned int tonumerical(char *input, unsigned int length, unsigned int base, unsigned int offset)
+    struct index *index;
+    unsigned int fields;
+    unsigned long *visited;
+    unsigned int *current;
+    unsigned int ncurrent;
+    unsigned int next;
+    struct frontier frontiers[MAX_JOBS];
+    unsigned int nworkers;
+
+};
+
+struct arena
 {
 
-    unsigned int value = 0;
-    unsigned int m = 1;
-    unsigned int i;
+    unsigned int file;
+    char *data;
+    unsigned int start;
+    unsigned int end;
+    struct entry *entries;
+    unsigned int nentries;
+    unsigned int maxentries;
+    struct provide *provides;
+    unsigned int nprovides;
+    unsigned int maxprovides;
+    struct edge *edges;
+    unsigned int nedges;
+    unsigned int maxedges;
+    char *keys;
+    unsigned int nkeys;
+    unsigned int maxkeys;
 
-    for (i = length; i > 0; i--)
-    {
+};
 
-        int v = input[offset + i - 1] - '0';
+struct loader
+{
 
-        value += v * m;
-        m *= base;
+    struct arena *arenas;
+    unsigned int narenas;
+    unsigned int next;
+    pthread_mutex_t lock;
 
-    }
+};
 
-    return value;
+struct stream
+{
+
+    char *name;
+    unsigned int file;
+    unsigned int fd;
+    int pid;
+    char *data;
+    unsigned int count;
+    unsigned int done;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t reader;
+    pthread_t parser;
+    struct arena *arenas;
+    unsigned int narenas;
+    unsigned int maxarenas;
+
+};
+
+struct index
+{
+
+    struct file *files;
+    unsigned int nfiles;
+    struct entry *entries;
+    unsigned int nentries;
+    unsigned int *names;
+    unsigned int maxnames;
+    struct provide *provides;
+    unsigned int nprovides;
+    unsigned int *virtuals;
+    unsigned int maxvirtuals;
+    struct edge *edges;
+    unsigned int nedges;
+    unsigned int *nodes;
+    struct group *groups;
+    unsigned int ngroups;
+    struct alternative *alternatives;
+    unsigned int *candidates;
+    unsigned int ncandidates;
+    unsigned int *rnodes;
+    unsigned int *rdeps;
+    unsigned int nrdeps;
+    char *keys;
+    unsigned int nkeys;
+    char *cache;
+    unsigned int ncache;
+
+};
+
+struct query
+{
+
+    struct index *index;
+    unsigned int out;
+    unsigned int err;
+    unsigned int *matched;
+    unsigned long *visited;
+    unsigned int maxmatched;
+    unsigned int nmatched;
+    struct server *server;
+
+};
+
+struct server
+{
+
+    unsigned int fd;
+    struct index *current;
+    unsigned int nfiles;
+    char **filenames;
+    unsigned long epoch;
+    unsigned long epochs[MAX_JOBS];
+    unsigned int nworkers;
+    pthread_mutex_t lock;
+    unsigned int generation;
+    unsigned int reloads;
+    unsigned int failures;
+    unsigned long lastreload;
+    unsigned long totalreload;
+
+};
+
+struct command
+{
+
+    char *name;
+    int (*handle)(struct query *query, int argc, char **argv);
+    unsigned int scope;
+
+};
+
+struct sortkey
+{
+
+    char *key;
+    unsigned int length;
+    unsigned int id;
+
+};
+
+struct cacheheader
+{
+
+    unsigned int magic;
+    unsigned int version;
+    unsigned int count;
+    unsigned int nfiles;
+    unsigned int files;
+    unsigned int nentries;
+    unsigned int entries;
+    unsigned int maxnames;
+    unsigned int names;
+    unsigned int nprovides;
+    unsigned int provides;
+    unsigned int maxvirtuals;
+    unsigned int virtuals;
+    unsigned int nedges;
+    unsigned int edges;
+    unsigned int nodes;
+    unsigned int ngroups;
+    unsigned int groups;
+    unsigned int alternatives;
+    unsigned int ncandidates;
+    unsigned int candidates;
+    unsigned int rnodes;
+    unsigned int nrdeps;
+    unsigned int rdeps;
+    unsigned int nkeys;
+    unsigned int keys;
+
+};
+
+struct cachefile
+{
+
+    unsigned long size;
+    unsigned long mtime;
+    unsigned long hash;
+    unsigned int data;
+    unsigned int count;
+
+};
+
+static void substring_init(struct substring *substring)
+{
+
+    substring->offset = 0;
+    substring->end = 0;
 
 }
 
-static unsigned int tolexical(unsigned int c, char *letters)
+static void snippet_init(struct snippet *snippet, char *data, unsigned int length)
 {
 
-    unsigned int offset = 0;
-    unsigned int i;
+    snippet->data = data;
+    snippet->length = length;
+
+}
+
+static unsigned int snippet_match(struct snippet *snippet, struct snippet *snippet2)
+{
 
-    if (c == '~')
-        return offset;
+    return (snippet->length == snippet2->length) && !memcmp(snippet->data, snippet2->data, snippet->length);
 
-    offset += 1;
+}
 
-    if (c == 0)
-        return offset;
+static void snippet_load(struct snippet *snippet, char *base, struct slice *slice)
+{
 
-    offset += 1;
+    snippet_init(snippet, base + slice->offset, slice->length);
 
-    if (c >= 'A' && c <= 'Z')
-        return offset + (c - 'A');
+}
 
-    offset += 26;
+static void slice_init(struct slice *slice, unsigned int offset, unsigned int length)
+{
 
-    if (c >= 'a' && c <= 'z')
-        return offset + (c - 'a');
+    slice->offset = offset;
+    slice->length = length;
 
-    offset += 26;
+}
 
-    for (i = 0; i < strlen(letters); i++)
-    {
+static void vslice_init(struct vslice *vslice, char *base, struct vstring *vstring)
+{
 
-        if (letters[i] == c)
-            return offset + i;
+    slice_init(&vslice->name, vstring->name.data - base, vstring->name.length);
+    slice_init(&vslice->arch, vstring->arch.data - base, vstring->arch.length);
+    slice_init(&vslice->relation, vstring->relation.data - base, vstring->relation.length);
+    slice_init(&vslice->version, vstring->version.data - base, vstring->version.length);
 
-    }
+}
 
-    offset += strlen(letters);
+static void vstring_load(struct vstring *vstring, char *base, struct vslice *vslice)
+{
 
-    return offset;
+    snippet_load(&vstring->name, base, &vslice->name);
+    snippet_load(&vstring->arch, base, &vslice->arch);
+    snippet_load(&vstring->relation, base, &vslice->relation);
+    snippet_load(&vstring->version, base, &vslice->version);
 
 }
 
-static unsigned int numoptions(char *data, unsigned int length)
+static void vstring_init(struct vstring *vstring, char *data, unsigned int length, struct substring *name, struct substring *arch, struct substring *relation, struct substring *version)
 {
 
-    unsigned int count = 0;
+    snippet_init(&vstring->name, data + name->offset, (name->end > name->offset) ? name->end - name->offset : 0);
+    snippet_init(&vstring->arch, data + arch->offset, (arch->end > arch->offset) ? arch->end - arch->offset : 0);
+    snippet_init(&vstring->relation, data + relation->offset, (relation->end > relation->offset) ? relation->end - relation->offset : 0);
+    snippet_init(&vstring->version, data + version->offset, (version->end > version->offset) ? version->end - version->offset : 0);
+
+}
+
+static unsigned int isnumerical(unsigned int v)
+{
+
+    return (v >= '0' && v <= '9');
+
+}
+
+static unsigned int tonumerical(char *input, unsigned int length, unsigned int base, unsigned int offset)
+{
+
+    unsigned int value = 0;
+    unsigned int m = 1;
     unsigned int i;
 
-    for (i = 0; i < length; i++)
+    for (i = length; i > 0; i--)
     {
 
-        if (data[i] == '|')
-            count++;
+        int v = input[offset + i - 1] - '0';
+
+        value += v * m;
+        m *= base;
 
     }
 
-    return count + 1;
+    return value;
 
 }
 
@@ -307,8 +650,25 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
         {
 
         case STATE_BEGIN:
-            name.offset = i;
-            state = STATE_NAME;
+            switch (c)
+            {
+
+            case '|':
+            case ',':
+            case '\n':
+            case '\0':
+                state = STATE_END;
+
+                break;
+
+            default:
+                name.offset = i;
+                name.end = i + 1;
+                state = STATE_NAME;
+
+                break;
+
+            }
 
             break;
 
@@ -337,7 +697,7 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
                 break;
 
             default:
-                name.end = i;
+                name.end = i + 1;
 
                 break;
 
@@ -364,7 +724,7 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
                 break;
 
             default:
-                arch.end = i;
+                arch.end = i + 1;
 
                 break;
 
@@ -379,12 +739,13 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
             case '=':
             case '<':
             case '>':
-                relation.end = i;
+                relation.end = i + 1;
 
                 break;
 
             default:
                 version.offset = i;
+                version.end = i + 1;
                 state = STATE_VERSION;
 
                 break;
@@ -403,7 +764,7 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
                 break;
 
             default:
-                version.end = i;
+                version.end = i + 1;
 
                 break;
 
@@ -417,124 +778,69 @@ static unsigned int parsevstring(struct vstring *vstring, char *data, unsigned i
 
     vstring_init(vstring, data, length, &name, &arch, &relation, &version);
 
-    return 1;
+    return vstring->name.length > 0;
 
 }
 
-static unsigned int eachnewline(char *data, unsigned int length, unsigned int offset)
+static unsigned int eachcomma(char *data, unsigned int length, unsigned int offset)
 {
 
-    unsigned int i;
+    unsigned int i = scan_find(data, offset, length, SCAN_COMMA);
 
-    for (i = offset; i < length; i++)
-    {
+    return (i < length) ? i + 1 - offset : 0;
 
-        if (data[i] == '\n' || data[i] == '\0')
-            return i + 1 - offset;
+}
 
-    }
+static unsigned int eachpipe(char *data, unsigned int length, unsigned int offset)
+{
 
-    return 0;
+    unsigned int i = scan_find(data, offset, length, SCAN_PIPE);
+
+    return (i < length) ? i + 1 - offset : 0;
 
 }
 
-static unsigned int eachcomma(char *data, unsigned int length, unsigned int offset)
+static unsigned int readfield(struct index *index, struct entry *entry, struct snippet *snippet, char *field)
 {
 
-    unsigned int i;
+    char *data = index->files[entry->file].data + entry->offset;
+    unsigned int length = strlen(field);
+    struct scan scan;
+    unsigned int length2;
+    unsigned int offset2;
+
+    snippet_init(snippet, data, 0);
+    scan_init(&scan, data, 0, entry->count, SCAN_NEWLINE);
 
-    for (i = offset; i < length; i++)
+    for (offset2 = 0; (length2 = scan_next(&scan)); offset2 += length2)
     {
 
-        if (data[i] == ',' || data[i] == '\n' || data[i] == '\0')
-            return i + 1 - offset;
+        if (length < length2 && data[offset2 + length] == ':' && !memcmp(data + offset2, field, length))
+        {
+
+            snippet_init(snippet, data + offset2 + length + 1, length2 - length - 1);
+
+            break;
+
+        }
 
     }
 
-    return 0;
+    return snippet->length;
 
 }
 
-static unsigned int eachpipe(char *data, unsigned int length, unsigned int offset)
+static void dprintvstring(unsigned int fd, char *fmt, struct vstring *vstring)
 {
 
+    unsigned int length = strlen(fmt);
     unsigned int i;
 
-    for (i = offset; i < length; i++)
+    for (i = 0; i < length; i++)
     {
 
-        if (data[i] == '|' || data[i] == ',' || data[i] == '\n' || data[i] == '\0')
-            return i + 1 - offset;
-
-    }
-
-    return 0;
-
-}
-
-static unsigned int readfield(struct entry *entry, char *data, unsigned int count, char *field)
-{
-
-    unsigned int fd = sys_open(entry->filename);
-    unsigned int offset = 0;
-
-    if (fd)
-    {
-
-        char buffer[FIELDBUFFER_SIZE];
-        unsigned int count;
-
-        sys_seek(fd, entry->offset);
-
-        count = sys_read(fd, buffer, entry->count);
-
-        if (count)
-        {
-
-            unsigned int length = strlen(field);
-            unsigned int length2;
-            unsigned int offset2;
-
-            for (offset2 = 0; (length2 = eachnewline(buffer, count, offset2)); offset2 += length2)
-            {
-
-                if (length2 == 1 && buffer[offset2] == '\n')
-                    break;
-
-                if (length < length2 && buffer[offset2 + length] == ':' && !memcmp(buffer + offset2, field, length))
-                {
-
-                    offset = append(data, buffer + offset2 + length + 1, length2 - length - 1, offset);
-
-                    break;
-
-                }
-
-            }
-
-        }
-
-        sys_close(fd);
-
-    }
-
-    return offset;
-
-}
-
-static void dprintvstring(unsigned int fd, char *fmt, struct vstring *vstring)
-{
-
-    unsigned int length = strlen(fmt);
-    unsigned int offset = 0;
-    char result[4096];
-    unsigned int i;
-
-    for (i = 0; i < length; i++)
-    {
-
-        if (fmt[i] == '%')
-        {
+        if (fmt[i] == '%')
+        {
 
             i++;
 
@@ -542,44 +848,44 @@ static void dprintvstring(unsigned int fd, char *fmt, struct vstring *vstring)
             {
 
             case 'n':
-                offset = append(result, vstring->name.data, vstring->name.length, offset);
+                output_write(fd, vstring->name.data, vstring->name.length);
 
                 break;
 
             case 'a':
-                offset = append(result, vstring->arch.data, vstring->arch.length, offset);
+                output_write(fd, vstring->arch.data, vstring->arch.length);
 
                 break;
 
             case 'r':
-                offset = append(result, vstring->relation.data, vstring->relation.length, offset);
+                output_write(fd, vstring->relation.data, vstring->relation.length);
 
                 break;
 
             case 'v':
-                offset = append(result, vstring->version.data, vstring->version.length, offset);
+                output_write(fd, vstring->version.data, vstring->version.length);
 
                 break;
 
             case 'A':
-                offset = append(result, vstring->name.data, vstring->name.length, offset);
+                output_write(fd, vstring->name.data, vstring->name.length);
 
                 if (vstring->arch.length)
                 {
 
-                    offset = append(result, ":", 1, offset);
-                    offset = append(result, vstring->arch.data, vstring->arch.length, offset);
+                    output_write(fd, ":", 1);
+                    output_write(fd, vstring->arch.data, vstring->arch.length);
 
                 }
 
                 if (vstring->relation.length && vstring->version.length)
                 {
 
-                    offset = append(result, " (", 2, offset);
-                    offset = append(result, vstring->relation.data, vstring->relation.length, offset);
-                    offset = append(result, " ", 1, offset);
-                    offset = append(result, vstring->version.data, vstring->version.length, offset);
-                    offset = append(result, ")", 1, offset);
+                    output_write(fd, " (", 2);
+                    output_write(fd, vstring->relation.data, vstring->relation.length);
+                    output_write(fd, " ", 1);
+                    output_write(fd, vstring->version.data, vstring->version.length);
+                    output_write(fd, ")", 1);
 
                 }
 
@@ -592,15 +898,16 @@ static void dprintvstring(unsigned int fd, char *fmt, struct vstring *vstring)
         else
         {
 
-            offset = append(result, fmt + i, 1, offset);
+            unsigned int start = i;
 
-        }
+            while (i + 1 < length && fmt[i + 1] != '%')
+                i++;
 
-    }
+            output_write(fd, fmt + start, i - start + 1);
 
-    offset = append(result, "\0", 1, offset);
+        }
 
-    dprintf(fd, "%s", result);
+    }
 
 }
 
@@ -658,68 +965,85 @@ static unsigned int getrelation(char *relation, unsigned int length)
 
 }
 
-static unsigned int readnumerical(char *version, unsigned int length, unsigned int offset)
+static unsigned int getfield(char *field, unsigned int length)
 {
 
-    unsigned int i;
+    if (length == 11 && !memcmp(field, "Pre-Depends", 11))
+        return FIELD_PREDEPENDS;
 
-    for (i = offset; i <= length; i++)
-    {
+    if (length == 7 && !memcmp(field, "Depends", 7))
+        return FIELD_DEPENDS;
 
-        if (!isnumerical(version[i]))
-            return i - offset;
+    if (length == 10 && !memcmp(field, "Recommends", 10))
+        return FIELD_RECOMMENDS;
 
-    }
+    if (length == 8 && !memcmp(field, "Suggests", 8))
+        return FIELD_SUGGESTS;
+
+    if (length == 9 && !memcmp(field, "Conflicts", 9))
+        return FIELD_CONFLICTS;
+
+    if (length == 6 && !memcmp(field, "Breaks", 6))
+        return FIELD_BREAKS;
 
-    return length - offset + 1;
+    return 0;
 
 }
 
-static unsigned int readlexical(char *version, unsigned int length, unsigned int offset, char *letters)
+static unsigned int getfields(char *data, unsigned int count)
 {
 
-    unsigned int i;
+    unsigned int fields = 0;
+    unsigned int offset;
+    unsigned int length;
 
-    for (i = offset; i <= length; i++)
+    for (offset = 0; (length = eachcomma(data, count + 1, offset)); offset += length)
     {
 
-        if (!isalphabetical(version[i]) && !isspecial(version[i], letters))
-            return i - offset;
+        struct vstring vstring;
+        unsigned int field;
+
+        parsevstring(&vstring, data + offset, length);
+
+        field = getfield(vstring.name.data, vstring.name.length);
+
+        if (!field)
+            return 0;
+
+        fields |= field;
 
     }
 
-    return length - offset + 1;
+    return fields;
 
 }
 
-static int comparelexical(char *data1, unsigned int offset1, unsigned int length1, char *data2, unsigned int offset2, unsigned int length2, char *letters)
+static char *getoption(char *arg, char *name)
 {
 
-    unsigned int length = (length1 > length2) ? length1 : length2;
-    unsigned int i;
+    unsigned int length = strlen(name);
 
-    for (i = 0; i < length; i++)
-    {
+    return (!strncmp(arg, name, length) && arg[length] == '=') ? arg + length + 1 : 0;
 
-        unsigned int p1 = tolexical(i < length1 ? data1[offset1 + i] : 0, letters);
-        unsigned int p2 = tolexical(i < length2 ? data2[offset2 + i] : 0, letters);
+}
 
-        if (p1 != p2)
-            return p1 - p2;
+static unsigned int getnumber(char *data, unsigned int *value)
+{
 
-    }
+    unsigned int length = strlen(data);
+    unsigned int i;
 
-    return 0;
+    for (i = 0; i < length; i++)
+    {
 
-}
+        if (!isnumerical(data[i]))
+            return 0;
 
-static int comparenumerical(char *data1, unsigned int offset1, unsigned int length1, char *data2, unsigned int offset2, unsigned int length2)
-{
+    }
 
-    unsigned int n1 = tonumerical(data1, length1, 10, offset1);
-    unsigned int n2 = tonumerical(data2, length2, 10, offset2);
+    *value = tonumerical(data, length, 10, 0);
 
-    return n1 - n2;
+    return length > 0;
 
 }
 
@@ -730,490 +1054,5868 @@ static unsigned int checkrelation(unsigned int relation, int c)
     {
 
     case RELATION_EQ:
-        if (c < 0)
-            return COMPARE_INVALID;
+        return (c == 0) ? COMPARE_VALID : COMPARE_INVALID;
 
-        if (c > 0)
-            return COMPARE_INVALID;
+    case RELATION_GT:
+        return (c > 0) ? COMPARE_VALID : COMPARE_INVALID;
 
-        break;
+    case RELATION_GTEQ:
+        return (c >= 0) ? COMPARE_VALID : COMPARE_INVALID;
 
     case RELATION_LT:
+        return (c < 0) ? COMPARE_VALID : COMPARE_INVALID;
+
     case RELATION_LTEQ:
-        if (c < 0)
-            return COMPARE_VALID;
+        return (c <= 0) ? COMPARE_VALID : COMPARE_INVALID;
 
-        if (c > 0)
-            return COMPARE_INVALID;
+    case RELATION_NONE:
+        return COMPARE_VALID;
 
-        break;
+    }
 
-    case RELATION_GT:
-    case RELATION_GTEQ:
-        if (c < 0)
-            return COMPARE_INVALID;
+    return COMPARE_INVALID;
 
-        if (c > 0)
-            return COMPARE_VALID;
+}
 
-        break;
+static unsigned int hashname(struct snippet *name)
+{
+
+    unsigned int hash = 2166136261u;
+    unsigned int i;
+
+    for (i = 0; i < name->length; i++)
+    {
+
+        hash ^= (unsigned char)name->data[i];
+        hash *= 16777619;
 
     }
 
-    return COMPARE_CONTINUE;
+    return hash;
 
 }
 
-static unsigned int compareversions(unsigned int relation, char *version1, unsigned int length1, char *version2, unsigned int length2)
+static unsigned long hashdata(char *data, unsigned int count)
 {
 
-    unsigned int offset1 = 0;
-    unsigned int offset2 = 0;
-    unsigned int colon1 = findfirst(version1, length1, ':', offset1);
-    unsigned int colon2 = findfirst(version2, length2, ':', offset2);
-    unsigned int dash1 = findlast(version1, length1, '-', offset1);
-    unsigned int dash2 = findlast(version2, length2, '-', offset2);
-    unsigned int lex1;
-    unsigned int lex2;
-    unsigned int num1;
-    unsigned int num2;
-    unsigned int v;
+    unsigned long hash = 0x9e3779b97f4a7c15UL;
+    unsigned int i;
 
-    if (relation == RELATION_NONE)
-        return 1;
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+
+        unsigned long word;
 
-    v = checkrelation(RELATION_EQ, comparenumerical(version1, offset1, colon1, version2, offset2, colon2));
+        memcpy(&word, data + i, 8);
 
-    if (v != COMPARE_CONTINUE)
-        return v;
+        hash = (hash ^ word) * 0xff51afd7ed558ccdUL;
+        hash ^= hash >> 32;
 
-    offset1 += colon1;
-    offset2 += colon2;
+    }
 
-    do
+    for (; i < count; i++)
     {
 
-        lex1 = readlexical(version1, dash1, offset1, LETTERS_UPSTREAM);
-        lex2 = readlexical(version2, dash2, offset2, LETTERS_UPSTREAM);
+        hash = (hash ^ (unsigned char)data[i]) * 0xff51afd7ed558ccdUL;
+        hash ^= hash >> 32;
 
-        v = checkrelation(relation, comparelexical(version1, offset1, lex1, version2, offset2, lex2, LETTERS_UPSTREAM));
+    }
 
-        if (v != COMPARE_CONTINUE)
-            return v;
+    return hash ^ count;
 
-        offset1 += lex1;
-        offset2 += lex2;
-        num1 = readnumerical(version1, dash1, offset1);
-        num2 = readnumerical(version2, dash2, offset2);
+}
 
-        v = checkrelation(relation, comparenumerical(version1, offset1, num1, version2, offset2, num2));
+static char *entry_base(struct index *index, struct entry *entry)
+{
 
-        if (v != COMPARE_CONTINUE)
-            return v;
+    return index->files[entry->file].data;
 
-        offset1 += num1;
-        offset2 += num2;
+}
 
-    } while (lex1 || lex2 || num1 || num2);
+static void entry_vstring(struct index *index, struct entry *entry, struct vstring *vstring)
+{
 
-    offset1 = dash1 + 1;
-    offset2 = dash2 + 1;
+    vstring_load(vstring, entry_base(index, entry), &entry->vslice);
+    snippet_init(&vstring->relation, "=", 1);
 
-    do
-    {
+}
 
-        lex1 = readlexical(version1, length1, offset1, LETTERS_REVISION);
-        lex2 = readlexical(version2, length2, offset2, LETTERS_REVISION);
+static void provide_vstring(struct index *index, struct provide *provide, struct vstring *vstring)
+{
+
+    vstring_load(vstring, entry_base(index, &index->entries[provide->entry - 1]), &provide->vslice);
 
-        v = checkrelation(relation, comparelexical(version1, offset1, lex1, version2, offset2, lex2, LETTERS_REVISION));
+}
 
-        if (v != COMPARE_CONTINUE)
-            return v;
+static void edge_vstring(struct index *index, struct edge *edge, struct vstring *vstring)
+{
 
-        offset1 += lex1;
-        offset2 += lex2;
-        num1 = readnumerical(version1, length1, offset1);
-        num2 = readnumerical(version2, length2, offset2);
-        v = checkrelation(relation, comparenumerical(version1, offset1, num1, version2, offset2, num2));
+    vstring_load(vstring, entry_base(index, &index->entries[edge->entry - 1]), &edge->vslice);
 
-        if (v != COMPARE_CONTINUE)
-            return v;
+}
 
-        offset1 += num1;
-        offset2 += num2;
+static unsigned int findnameslot(struct index *index, struct snippet *name)
+{
 
-    } while (lex1 || lex2 || num1 || num2);
+    unsigned int mask = index->maxnames - 1;
+    unsigned int slot;
 
-    switch (relation)
+    for (slot = hashname(name) & mask; index->names[slot]; slot = (slot + 1) & mask)
     {
 
-    case RELATION_EQ:
-    case RELATION_LTEQ:
-    case RELATION_GTEQ:
-        return COMPARE_VALID;
+        struct entry *current = &index->entries[index->names[slot] - 1];
+        struct snippet name2;
+
+        snippet_load(&name2, entry_base(index, current), &current->vslice.name);
+
+        if (snippet_match(name, &name2))
+            break;
 
     }
 
-    return COMPARE_INVALID;
+    return slot;
 
 }
 
-static struct entry *findentry(struct vstring *vstring, struct entry *entries, unsigned int nentries)
+static unsigned int findname(struct index *index, struct snippet *name)
 {
 
-    unsigned int relation = getrelation(vstring->relation.data, vstring->relation.length);
-    unsigned int i;
-
-    for (i = 0; i < nentries; i++)
-    {
-
-        struct entry *current = &entries[i];
+    return index->names[findnameslot(index, name)];
 
-        if (snippet_match(&vstring->name, &current->vstring.name))
-        {
+}
 
-            if (compareversions(relation, current->vstring.version.data, current->vstring.version.length, vstring->version.data, vstring->version.length) == COMPARE_VALID)
-                return current;
+static void addname(struct index *index, unsigned int id)
+{
 
-        }
+    struct entry *entry = &index->entries[id - 1];
+    struct snippet name;
+    unsigned int slot;
 
-    }
+    snippet_load(&name, entry_base(index, entry), &entry->vslice.name);
 
-    return 0;
+    slot = findnameslot(index, &name);
+    entry->next = index->names[slot];
+    index->names[slot] = id;
 
 }
 
-static struct entry *findentryprovides(struct vstring *vstring, struct entry *entries, unsigned int nentries)
+static unsigned int findvirtualslot(struct index *index, struct snippet *name)
 {
 
-    unsigned int relation = getrelation(vstring->relation.data, vstring->relation.length);
-    unsigned int i;
+    unsigned int mask = index->maxvirtuals - 1;
+    unsigned int slot;
 
-    for (i = 0; i < nentries; i++)
+    for (slot = hashname(name) & mask; index->virtuals[slot]; slot = (slot + 1) & mask)
     {
 
-        struct entry *current = &entries[i];
-        char fieldbuffer[FIELDBUFFER_SIZE];
-        unsigned int count = readfield(current, fieldbuffer, FIELDBUFFER_SIZE, "Provides");
-        unsigned int offset;
-        unsigned int length;
-
-        for (offset = 0; (length = eachcomma(fieldbuffer, count, offset)); offset += length)
-        {
-
-            struct vstring provided;
-
-            if (parsevstring(&provided, fieldbuffer + offset, length))
-            {
+        struct provide *current = &index->provides[index->virtuals[slot] - 1];
+        struct vstring vstring;
 
-                if (snippet_match(&vstring->name, &provided.name))
-                {
+        provide_vstring(index, current, &vstring);
 
-                    if (compareversions(relation, provided.version.data, provided.version.length, vstring->version.data, vstring->version.length) == COMPARE_VALID)
-                        return current;
+        if (snippet_match(name, &vstring.name))
+            break;
 
-                }
+    }
 
-            }
+    return slot;
 
-        }
+}
 
-    }
+static unsigned int findvirtual(struct index *index, struct snippet *name)
+{
 
-    return 0;
+    return index->virtuals[findvirtualslot(index, name)];
 
 }
 
-static struct entry *findmatch(char *data, unsigned int length, struct entry *entries, unsigned int nentries)
+static void addvirtual(struct index *index, unsigned int id)
 {
 
+    struct provide *provide = &index->provides[id - 1];
     struct vstring vstring;
+    unsigned int slot;
 
-    return (parsevstring(&vstring, data, length)) ? findentry(&vstring, entries, nentries) : 0;
+    provide_vstring(index, provide, &vstring);
+
+    slot = findvirtualslot(index, &vstring.name);
+    provide->next = index->virtuals[slot];
+    index->virtuals[slot] = id;
 
 }
 
-static struct entry *findmatchincludeprovides(char *data, unsigned int length, struct entry *entries, unsigned int nentries)
+static void *allocarray(unsigned int count, unsigned int size)
 {
 
-    struct vstring vstring;
+    void *data = calloc(count ? count : 1, size);
 
-    if (parsevstring(&vstring, data, length))
+    if (!data)
     {
 
-        struct entry *entry = findentry(&vstring, entries, nentries);
-
-        if (!entry)
-            entry = findentryprovides(&vstring, entries, nentries);
-
-        return entry;
+        output_printf(SYS_FD_STDERR, "ERROR: Out of memory\n");
+        exit(EXIT_FAILURE);
 
     }
 
-    return 0;
+    return data;
 
 }
 
-static unsigned int addmatched(struct entry *entry, struct entry **matched, unsigned int maxmatched, unsigned int nmatched)
+static char *vstring_key(struct vstring *vstring, char *buffer, unsigned int *length)
 {
 
-    if (nmatched < maxmatched)
-    {
-
-        if (!entry->matched)
-        {
+    char *key = (VERSION_KEYSIZE(vstring->version.length) > KEY_BUFFER) ? allocarray(VERSION_KEYSIZE(vstring->version.length), 1) : buffer;
 
-            matched[nmatched] = entry;
-            nmatched++;
+    *length = version_key(key, vstring->version.data, vstring->version.length);
 
-            entry->matched = 1;
+    return key;
 
-        }
+}
 
-    }
+static char *index_key(struct index *index, struct slice *key)
+{
 
-    return nmatched;
+    return index->keys + key->offset;
 
 }
 
-static unsigned int resolve(struct entry *entry, struct entry *entries, unsigned int nentries, char *field, struct entry **matched, unsigned int maxmatched, unsigned int nmatched)
+static unsigned int findentrykey(struct index *index, struct snippet *name, unsigned int relation, char *key, unsigned int length)
 {
 
-    unsigned int i;
-
-    nmatched = addmatched(entry, matched, maxmatched, nmatched);
+    unsigned int id;
 
-    for (i = 0; i < nmatched; i++)
+    for (id = findname(index, name); id; id = index->entries[id - 1].next)
     {
 
-        char fieldbuffer[FIELDBUFFER_SIZE];
-        unsigned int count = readfield(matched[i], fieldbuffer, FIELDBUFFER_SIZE, field);
-        unsigned int offset;
-        unsigned int length;
+        struct entry *current = &index->entries[id - 1];
 
-        for (offset = 0; (length = eachcomma(fieldbuffer, count, offset)); offset += length)
-        {
+        if (checkrelation(relation, version_comparekeys(index_key(index, &current->key), current->key.length, key, length)) == COMPARE_VALID)
+            return id;
+
+    }
 
-            char *data = fieldbuffer + offset;
-            unsigned int noptions = numoptions(data, length);
+    return 0;
 
-            if (noptions > 1)
-            {
+}
 
-                unsigned int offset2;
-                unsigned int length2;
-                unsigned int found = 0;
+static struct entry *findentry(struct index *index, struct vstring *vstring)
+{
 
-                for (offset2 = 0; (length2 = eachpipe(data, length, offset2)); offset2 += length2)
-                {
+    unsigned int relation = getrelation(vstring->relation.data, vstring->relation.length);
+    char buffer[KEY_BUFFER];
+    unsigned int length;
+    char *key = vstring_key(vstring, buffer, &length);
+    unsigned int id = findentrykey(index, &vstring->name, relation, key, length);
 
-                    struct entry *child = findmatchincludeprovides(data + offset2, length2, entries, nentries);
+    if (key != buffer)
+        free(key);
 
-                    if (child && child->matched)
-                    {
+    return (id) ? &index->entries[id - 1] : 0;
 
-                        found = 1;
+}
 
-                        break;
+static struct entry *findmatch(struct index *index, char *data, unsigned int length)
+{
 
-                    }
+    struct vstring vstring;
 
-                }
+    return (parsevstring(&vstring, data, length)) ? findentry(index, &vstring) : 0;
 
-                if (found)
-                    continue;
+}
 
-                dprintf(SYS_FD_STDERR, "WARNING: found no match for [");
+static void dprintentry(struct index *index, unsigned int fd, char *fmt, struct entry *entry)
+{
 
-                for (offset2 = 0; (length2 = eachpipe(data, length, offset2)); offset2 += length2)
-                {
+    struct vstring vstring;
 
-                    struct vstring vstring;
+    entry_vstring(index, entry, &vstring);
+    dprintvstring(fd, fmt, &vstring);
 
-                    if (parsevstring(&vstring, data + offset2, length2))
-                        dprintvstring(SYS_FD_STDERR, offset2 ? " | %A" : "%A", &vstring);
+}
 
-                }
+static unsigned int isvisited(struct query *query, unsigned int id)
+{
 
-                dprintf(SYS_FD_STDERR, "]\n");
+    return (query->visited[id / BITS_LONG] >> (id % BITS_LONG)) & 1;
 
-            }
+}
 
-            else
-            {
+static void addmatched(struct query *query, unsigned int id)
+{
 
-                struct entry *child = findmatchincludeprovides(data, length, entries, nentries);
+    if (query->nmatched < query->maxmatched && !isvisited(query, id))
+    {
 
-                if (child)
-                    nmatched = addmatched(child, matched, maxmatched, nmatched);
-                else
-                    dprintf(SYS_FD_STDERR, "WARNING: found no match for %.*s\n", length, data);
+        query->matched[query->nmatched] = id;
+        query->nmatched++;
+        query->visited[id / BITS_LONG] |= 1UL << (id % BITS_LONG);
 
-            }
+    }
 
-        }
+}
+
+static void dprintgroup(struct index *index, unsigned int fd, char *fmt, unsigned int group)
+{
+
+    unsigned int i;
+
+    for (i = index->groups[group].start; i < index->groups[group + 1].start; i++)
+    {
+
+        struct vstring vstring;
+
+        edge_vstring(index, &index->edges[i], &vstring);
+        dprintvstring(fd, (i > index->groups[group].start) ? " | %A" : "%A", &vstring);
 
     }
 
-    return nmatched;
+    output_write(fd, fmt, strlen(fmt));
 
 }
 
-static void entry_init(struct entry *current, char *filename, unsigned int offset)
+static void entry_init(struct entry *current, unsigned int file, unsigned int offset)
 {
 
-    snippet_init(&current->vstring.name, current->namedata, 0);
-    snippet_init(&current->vstring.version, current->versiondata, 0);
-    snippet_init(&current->vstring.relation, "=", 1);
-    snippet_init(&current->vstring.arch, current->archdata, 0);
+    slice_init(&current->vslice.name, offset, 0);
+    slice_init(&current->vslice.arch, offset, 0);
+    slice_init(&current->vslice.relation, offset, 0);
+    slice_init(&current->vslice.version, offset, 0);
 
-    current->filename = filename;
+    current->size = 0;
+    current->isize = 0;
+    current->file = file;
     current->offset = offset;
+    current->count = 0;
+    current->next = 0;
 
 }
 
-static unsigned int parsefile(char *filename, struct entry *entries, unsigned int maxentries)
+static void *growarray(void *data, unsigned int *max, unsigned int size)
 {
 
-    unsigned int fd = sys_open(filename);
+    *max = (*max) ? *max * 2 : 256;
+    data = realloc(data, *max * size);
 
-    if (fd)
+    if (!data)
     {
 
-        struct entry *current = &entries[0];
-        unsigned int offset = 0;
-        unsigned int nentries = 0;
-        unsigned int count;
-        char buffer[FIELDBUFFER_SIZE];
-
-        entry_init(current, filename, 0);
+        output_printf(SYS_FD_STDERR, "ERROR: Out of memory\n");
+        exit(EXIT_FAILURE);
 
-        while ((count = sys_read(fd, buffer, FIELDBUFFER_SIZE)))
-        {
+    }
 
-            unsigned int length2;
-            unsigned int offset2;
+    return data;
 
-            for (offset2 = 0; (length2 = eachnewline(buffer, count, offset2)); offset2 += length2)
-            {
+}
 
-                if (length2 == 1 && buffer[offset2] == '\n')
-                {
+static struct entry *arena_entry(struct arena *arena)
+{
 
-                    if (nentries < maxentries)
-                    {
+    if (arena->nentries == arena->maxentries)
+        arena->entries = growarray(arena->entries, &arena->maxentries, sizeof (struct entry));
 
-                        current->count = offset2;
+    return &arena->entries[arena->nentries];
 
-                        current++;
-                        nentries++;
+}
 
-                        offset += offset2 + length2;
+static void arena_key(struct arena *arena, struct slice *key, char *data, unsigned int length)
+{
 
-                        entry_init(current, filename, offset);
-                        sys_seek(fd, offset);
+    while (arena->nkeys + VERSION_KEYSIZE(length) > arena->maxkeys)
+        arena->keys = growarray(arena->keys, &arena->maxkeys, 1);
 
-                        break;
+    slice_init(key, arena->nkeys, version_key(arena->keys + arena->nkeys, data, length));
 
-                    }
+    arena->nkeys += key->length;
 
-                    else
-                    {
+}
 
-                        dprintf(SYS_FD_STDERR, "WARNING: max number of entries reached (%u)\n", nentries);
+static void addprovides(struct arena *arena, unsigned int entry, char *base, char *data, unsigned int count)
+{
 
-                        return nentries;
+    unsigned int offset;
+    unsigned int length;
 
-                    }
+    for (offset = 0; (length = eachcomma(data, count, offset)); offset += length)
+    {
 
-                }
+        struct vstring vstring;
 
-                else if (!memcmp(buffer + offset2, "Package: ", 9))
-                {
+        if (parsevstring(&vstring, data + offset, length))
+        {
 
-                    snippet_init(&current->vstring.name, current->namedata, append(current->namedata, buffer + offset2 + 9, length2 - 10, 0));
+            struct provide *provide;
 
-                }
+            if (arena->nprovides == arena->maxprovides)
+                arena->provides = growarray(arena->provides, &arena->maxprovides, sizeof (struct provide));
 
-                else if (!memcmp(buffer + offset2, "Version: ", 9))
-                {
+            provide = &arena->provides[arena->nprovides];
 
-                    snippet_init(&current->vstring.version, current->versiondata, append(current->versiondata, buffer + offset2 + 9, length2 - 10, 0));
+            vslice_init(&provide->vslice, base, &vstring);
+            arena_key(arena, &provide->key, vstring.version.data, vstring.version.length);
 
-                }
+            provide->entry = entry;
+            provide->next = 0;
+            arena->nprovides++;
 
-                else if (!memcmp(buffer + offset2, "Architecture: ", 14))
-                {
+        }
 
-                    snippet_init(&current->vstring.arch, current->archdata, append(current->archdata, buffer + offset2 + 14, length2 - 15, 0));
+    }
 
-                }
+}
 
-                else if (!memcmp(buffer + offset2, "Size: ", 6))
-                {
+static void addedges(struct arena *arena, unsigned int entry, unsigned int field, char *base, char *data, unsigned int count)
+{
 
-                    current->size = tonumerical(buffer + offset2, length2 - 7, 10, 6);
+    unsigned int offset;
+    unsigned int length;
+
+    for (offset = 0; (length = eachcomma(data, count, offset)); offset += length)
+    {
+
+        unsigned int alternative = 0;
+        unsigned int offset2;
+        unsigned int length2;
+
+        for (offset2 = 0; (length2 = eachpipe(data + offset, length, offset2)); offset2 += length2)
+        {
+
+            struct vstring vstring;
+
+            if (parsevstring(&vstring, data + offset + offset2, length2))
+            {
+
+                struct edge *edge;
+
+                if (arena->nedges == arena->maxedges)
+                    arena->edges = growarray(arena->edges, &arena->maxedges, sizeof (struct edge));
+
+                edge = &arena->edges[arena->nedges];
+
+                vslice_init(&edge->vslice, base, &vstring);
+                arena_key(arena, &edge->key, vstring.version.data, vstring.version.length);
+
+                edge->entry = entry;
+                edge->field = field;
+                edge->alternative = alternative++;
+                arena->nedges++;
+
+            }
+
+        }
+
+    }
+
+}
+
+static void parsechunk(struct arena *arena)
+{
+
+    char *data = arena->data;
+    struct entry *current = arena_entry(arena);
+    unsigned int offset = arena->start;
+    struct scan scan;
+    unsigned int length2;
+    unsigned int offset2;
+
+    entry_init(current, arena->file, offset);
+    scan_init(&scan, data, arena->start, arena->end, SCAN_NEWLINE);
+
+    for (offset2 = arena->start; (length2 = scan_next(&scan)); offset2 += length2)
+    {
+
+        char *line = data + offset2;
+
+        if (length2 == 1 && line[0] == '\n')
+        {
+
+            current->count = offset2 - offset;
+            arena_key(arena, &current->key, data + current->vslice.version.offset, current->vslice.version.length);
+            arena->nentries++;
+            offset = offset2 + length2;
+            current = arena_entry(arena);
+
+            entry_init(current, arena->file, offset);
+
+        }
+
+        else if (length2 > 9 && !memcmp(line, "Package: ", 9))
+        {
+
+            slice_init(&current->vslice.name, offset2 + 9, length2 - 10);
+
+        }
+
+        else if (length2 > 9 && !memcmp(line, "Version: ", 9))
+        {
+
+            slice_init(&current->vslice.version, offset2 + 9, length2 - 10);
+
+        }
+
+        else if (length2 > 14 && !memcmp(line, "Architecture: ", 14))
+        {
+
+            slice_init(&current->vslice.arch, offset2 + 14, length2 - 15);
+
+        }
+
+        else if (length2 > 6 && !memcmp(line, "Size: ", 6))
+        {
+
+            current->size = tonumerical(line, length2 - 7, 10, 6);
+
+        }
+
+        else if (length2 > 16 && !memcmp(line, "Installed-Size: ", 16))
+        {
+
+            current->isize = tonumerical(line, length2 - 17, 10, 16);
+
+        }
+
+        else if (length2 > 10 && !memcmp(line, "Provides: ", 10))
+        {
+
+            addprovides(arena, arena->nentries + 1, data, line + 9, length2 - 9);
+
+        }
+
+        else if (length2 > 13 && !memcmp(line, "Pre-Depends: ", 13))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_PREDEPENDS, data, line + 12, length2 - 12);
+
+        }
+
+        else if (length2 > 9 && !memcmp(line, "Depends: ", 9))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_DEPENDS, data, line + 8, length2 - 8);
+
+        }
+
+        else if (length2 > 12 && !memcmp(line, "Recommends: ", 12))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_RECOMMENDS, data, line + 11, length2 - 11);
+
+        }
+
+        else if (length2 > 10 && !memcmp(line, "Suggests: ", 10))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_SUGGESTS, data, line + 9, length2 - 9);
+
+        }
+
+        else if (length2 > 11 && !memcmp(line, "Conflicts: ", 11))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_CONFLICTS, data, line + 10, length2 - 10);
+
+        }
+
+        else if (length2 > 8 && !memcmp(line, "Breaks: ", 8))
+        {
+
+            addedges(arena, arena->nentries + 1, FIELD_BREAKS, data, line + 7, length2 - 7);
+
+        }
+
+    }
+
+    if (offset < arena->end && current->vslice.name.length)
+    {
+
+        current->count = arena->end - offset;
+        arena_key(arena, &current->key, data + current->vslice.version.offset, current->vslice.version.length);
+        arena->nentries++;
+
+    }
+
+}
+
+static void *parsethread(void *arg)
+{
+
+    struct loader *loader = arg;
+
+    while (1)
+    {
+
+        unsigned int i;
+
+        pthread_mutex_lock(&loader->lock);
+
+        i = loader->next++;
+
+        pthread_mutex_unlock(&loader->lock);
+
+        if (i >= loader->narenas)
+            break;
+
+        parsechunk(&loader->arenas[i]);
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int nextstanza(char *data, unsigned int count, unsigned int offset)
+{
+
+    unsigned int i;
+
+    for (i = offset - 1; i + 1 < count; i++)
+    {
+
+        if (data[i] == '\n' && data[i + 1] == '\n')
+            return i + 2;
+
+    }
+
+    return count;
+
+}
+
+static unsigned int laststanza(char *data, unsigned int start, unsigned int count)
+{
+
+    unsigned int i;
+
+    for (i = count; i >= start + 2; i--)
+    {
+
+        if (data[i - 1] == '\n' && data[i - 2] == '\n')
+            return i;
+
+    }
+
+    return start;
+
+}
+
+static char *decompressor(char *data, unsigned int count)
+{
+
+    if (count >= 2 && !memcmp(data, "\x1f\x8b", 2))
+        return "gzip";
+
+    if (count >= 6 && !memcmp(data, "\xfd" "7zXZ\0", 6))
+        return "xz";
+
+    if (count >= 4 && !memcmp(data, "\x28\xb5\x2f\xfd", 4))
+        return "zstd";
+
+    return 0;
+
+}
+
+static void *readthread(void *arg)
+{
+
+    struct stream *stream = arg;
+    unsigned int count = 0;
+    unsigned int block = 0;
+
+    while (1)
+    {
+
+        unsigned int n = (STREAM_SIZE - count < CHUNK_SIZE) ? STREAM_SIZE - count : CHUNK_SIZE;
+
+        if (!n)
+        {
+
+            output_printf(SYS_FD_STDERR, "ERROR: Decompressed size of %s is too large\n", stream->name);
+            exit(EXIT_FAILURE);
+
+        }
+
+        n = sys_read(stream->fd, stream->data + count, n);
+        count += n;
+        block += n;
+
+        if (n && block < CHUNK_SIZE)
+            continue;
+
+        pthread_mutex_lock(&stream->lock);
+
+        stream->count = count;
+        stream->done = !n;
+
+        pthread_cond_signal(&stream->cond);
+        pthread_mutex_unlock(&stream->lock);
+
+        if (!n)
+            break;
+
+        block = 0;
+
+    }
+
+    sys_close(stream->fd);
+
+    return 0;
+
+}
+
+static void *streamthread(void *arg)
+{
+
+    struct stream *stream = arg;
+    unsigned int start = 0;
+    unsigned int seen = 0;
+
+    while (1)
+    {
+
+        unsigned int count;
+        unsigned int done;
+        unsigned int end;
+
+        pthread_mutex_lock(&stream->lock);
+
+        while (!stream->done && stream->count <= seen)
+            pthread_cond_wait(&stream->cond, &stream->lock);
+
+        count = stream->count;
+        done = stream->done;
+
+        pthread_mutex_unlock(&stream->lock);
+
+        end = (done) ? count : laststanza(stream->data, start, count);
+        seen = count;
+
+        if (end > start)
+        {
+
+            struct arena *arena;
+
+            if (stream->narenas == stream->maxarenas)
+                stream->arenas = growarray(stream->arenas, &stream->maxarenas, sizeof (struct arena));
+
+            arena = &stream->arenas[stream->narenas++];
+
+            memset(arena, 0, sizeof (struct arena));
+
+            arena->file = stream->file;
+            arena->data = stream->data;
+            arena->start = start;
+            arena->end = end;
+
+            parsechunk(arena);
+
+            start = end;
+
+        }
+
+        if (done)
+            break;
+
+    }
+
+    return 0;
+
+}
+
+static void openstream(struct stream *stream, char *program, unsigned int fd)
+{
+
+    char *argv[3];
+
+    argv[0] = program;
+    argv[1] = "-dc";
+    argv[2] = 0;
+    stream->pid = sys_spawn(argv, fd, &stream->fd);
+
+    if (stream->pid < 0)
+    {
+
+        output_printf(SYS_FD_STDERR, "ERROR: Could not run %s for %s\n", program, stream->name);
+        exit(EXIT_FAILURE);
+
+    }
+
+    stream->data = sys_reserve(STREAM_SIZE);
+
+    pthread_mutex_init(&stream->lock, 0);
+    pthread_cond_init(&stream->cond, 0);
+
+    if (pthread_create(&stream->reader, 0, readthread, stream) || pthread_create(&stream->parser, 0, streamthread, stream))
+    {
+
+        output_printf(SYS_FD_STDERR, "ERROR: Could not start decompression of %s\n", stream->name);
+        exit(EXIT_FAILURE);
+
+    }
+
+}
+
+static void closestream(struct stream *stream, struct file *file)
+{
+
+    pthread_join(stream->reader, 0);
+    pthread_join(stream->parser, 0);
+    pthread_cond_destroy(&stream->cond);
+    pthread_mutex_destroy(&stream->lock);
+
+    if (sys_wait(stream->pid))
+    {
+
+        output_printf(SYS_FD_STDERR, "ERROR: Could not decompress %s\n", stream->name);
+        exit(EXIT_FAILURE);
+
+    }
+
+    file->data = stream->data;
+    file->count = stream->count;
+
+}
+
+static void mergearena(struct index *index, struct arena *arena)
+{
+
+    unsigned int base = index->nentries;
+    unsigned int keybase = index->nkeys;
+    unsigned int i;
+
+    for (i = 0; i < arena->nentries; i++)
+    {
+
+        index->entries[index->nentries] = arena->entries[i];
+        index->entries[index->nentries].key.offset += keybase;
+        index->nentries++;
+
+    }
+
+    for (i = 0; i < arena->nprovides; i++)
+    {
+
+        index->provides[index->nprovides] = arena->provides[i];
+        index->provides[index->nprovides].key.offset += keybase;
+        index->provides[index->nprovides].entry += base;
+        index->nprovides++;
+
+    }
+
+    for (i = 0; i < arena->nedges; i++)
+    {
+
+        index->edges[index->nedges] = arena->edges[i];
+        index->edges[index->nedges].key.offset += keybase;
+        index->edges[index->nedges].entry += base;
+        index->nedges++;
+
+    }
+
+    memcpy(index->keys + index->nkeys, arena->keys, arena->nkeys);
+
+    index->nkeys += arena->nkeys;
+
+    free(arena->entries);
+    free(arena->provides);
+    free(arena->edges);
+    free(arena->keys);
+
+}
+
+static unsigned int hashsize(unsigned int count)
+{
+
+    unsigned int size = 16;
+
+    while (size < count * 2)
+        size <<= 1;
+
+    return size;
+
+}
+
+static unsigned long cachealign(unsigned long offset)
+{
+
+    return (offset + 7) & ~7UL;
+
+}
+
+static unsigned long cachelayout(struct cacheheader *header)
+{
+
+    header->names = cachealign(header->entries + sizeof (struct entry) * header->nentries);
+    header->provides = cachealign(header->names + sizeof (unsigned int) * header->maxnames);
+    header->virtuals = cachealign(header->provides + sizeof (struct provide) * header->nprovides);
+    header->edges = cachealign(header->virtuals + sizeof (unsigned int) * header->maxvirtuals);
+    header->nodes = cachealign(header->edges + sizeof (struct edge) * header->nedges);
+    header->groups = cachealign(header->nodes + sizeof (unsigned int) * (header->nentries + 1UL));
+    header->alternatives = cachealign(header->groups + sizeof (struct group) * (header->ngroups + 1UL));
+    header->candidates = cachealign(header->alternatives + sizeof (struct alternative) * (header->nedges + 1UL));
+    header->rnodes = cachealign(header->candidates + sizeof (unsigned int) * header->ncandidates);
+    header->rdeps = cachealign(header->rnodes + sizeof (unsigned int) * (header->nentries + 1UL));
+    header->keys = cachealign(header->rdeps + sizeof (unsigned int) * header->nrdeps);
+
+    return cachealign((unsigned long)header->keys + header->nkeys);
+
+}
+
+static unsigned int checkcache(struct cacheheader *header)
+{
+
+    struct cachefile *cachefiles = (struct cachefile *)((char *)header + header->files);
+    struct cacheheader expected = *header;
+    unsigned long offset;
+    unsigned int i;
+
+    if (header->files != cachealign(sizeof (struct cacheheader)))
+        return 0;
+
+    offset = cachealign(header->files + sizeof (struct cachefile) * header->nfiles);
+
+    if (offset > header->count)
+        return 0;
+
+    for (i = 0; i < header->nfiles; i++)
+    {
+
+        if (cachefiles[i].data != offset)
+            return 0;
+
+        offset = cachealign(offset + cachefiles[i].count);
+
+    }
+
+    if (offset != header->entries)
+        return 0;
+
+    return cachelayout(&expected) == header->count && !memcmp(&expected, header, sizeof (struct cacheheader));
+
+}
+
+static unsigned int cachepath(char *path, unsigned int length, char *cachedir, unsigned int nfiles, char **filenames)
+{
+
+    unsigned long hash = 0;
+    unsigned int i;
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        char *name = realpath(filenames[i], 0);
+
+        if (!name)
+            return 0;
+
+        hash = hashdata(name, strlen(name)) ^ (hash * 31);
+
+        free(name);
+
+    }
+
+    return snprintf(path, length, "%s/%016lx.cache", cachedir, hash) < length;
+
+}
+
+static unsigned long hashfile(char *name, unsigned int size)
+{
+
+    unsigned int fd = sys_open(name);
+    unsigned long hash = hashdata(0, 0);
+
+    if (size)
+    {
+
+        char *data = sys_map(fd, size);
+
+        hash = hashdata(data, size);
+
+        sys_unmap(data, size);
+
+    }
+
+    sys_close(fd);
+
+    return hash;
+
+}
+
+static unsigned int loadcache(struct index *index, char *path, unsigned int nfiles, char **filenames)
+{
+
+    int fd = sys_tryopen(path);
+    struct cacheheader *header;
+    struct cachefile *cachefiles;
+    unsigned int count;
+    unsigned int i;
+
+    if (fd < 0)
+        return 0;
+
+    count = sys_size(fd);
+
+    if (count < sizeof (struct cacheheader))
+    {
+
+        sys_close(fd);
+
+        return 0;
+
+    }
+
+    index->cache = sys_map(fd, count);
+    index->ncache = count;
+    header = (struct cacheheader *)index->cache;
+    cachefiles = (struct cachefile *)(index->cache + header->files);
+
+    sys_close(fd);
+
+    if (header->magic != CACHE_MAGIC || header->version != CACHE_VERSION || header->count != count || header->nfiles != nfiles || !checkcache(header))
+    {
+
+        sys_unmap(index->cache, index->ncache);
+
+        index->cache = 0;
+
+        return 0;
+
+    }
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        struct cachefile *cachefile = &cachefiles[i];
+        unsigned int fd2 = sys_open(filenames[i]);
+        unsigned int size = sys_size(fd2);
+        unsigned int fresh = size == cachefile->size && sys_mtime(fd2) == cachefile->mtime;
+
+        sys_close(fd2);
+
+        if (fresh)
+            fresh = hashfile(filenames[i], size) == cachefile->hash;
+
+        if (!fresh)
+        {
+
+            sys_unmap(index->cache, index->ncache);
+
+            index->cache = 0;
+
+            return 0;
+
+        }
+
+    }
+
+    index->files = allocarray(header->nfiles, sizeof (struct file));
+
+    for (i = 0; i < header->nfiles; i++)
+    {
+
+        index->files[i].name = filenames[i];
+        index->files[i].data = index->cache + cachefiles[i].data;
+        index->files[i].count = cachefiles[i].count;
+        index->files[i].size = cachefiles[i].size;
+        index->files[i].mtime = cachefiles[i].mtime;
+
+    }
+
+    index->nfiles = header->nfiles;
+    index->entries = (struct entry *)(index->cache + header->entries);
+    index->nentries = header->nentries;
+    index->names = (unsigned int *)(index->cache + header->names);
+    index->maxnames = header->maxnames;
+    index->provides = (struct provide *)(index->cache + header->provides);
+    index->nprovides = header->nprovides;
+    index->virtuals = (unsigned int *)(index->cache + header->virtuals);
+    index->maxvirtuals = header->maxvirtuals;
+    index->edges = (struct edge *)(index->cache + header->edges);
+    index->nedges = header->nedges;
+    index->nodes = (unsigned int *)(index->cache + header->nodes);
+    index->groups = (struct group *)(index->cache + header->groups);
+    index->ngroups = header->ngroups;
+    index->alternatives = (struct alternative *)(index->cache + header->alternatives);
+    index->candidates = (unsigned int *)(index->cache + header->candidates);
+    index->ncandidates = header->ncandidates;
+    index->rnodes = (unsigned int *)(index->cache + header->rnodes);
+    index->rdeps = (unsigned int *)(index->cache + header->rdeps);
+    index->nrdeps = header->nrdeps;
+    index->keys = index->cache + header->keys;
+    index->nkeys = header->nkeys;
+
+    return 1;
+
+}
+
+static unsigned int writecache(unsigned int fd, void *data, unsigned int count, unsigned int offset)
+{
+
+    static char padding[8];
+    unsigned int written;
+    int n;
+
+    for (written = 0; written < count; written += n)
+    {
+
+        n = sys_trywrite(fd, (char *)data + written, count - written);
+
+        if (n <= 0)
+            return cachealign(offset + count);
+
+    }
+
+    if (cachealign(offset + count) > offset + count)
+        sys_trywrite(fd, padding, cachealign(offset + count) - (offset + count));
+
+    return cachealign(offset + count);
+
+}
+
+static void makedirs(char *path)
+{
+
+    char buffer[4096];
+    unsigned int length = strlen(path);
+    unsigned int i;
+
+    if (length >= 4096)
+        return;
+
+    memcpy(buffer, path, length + 1);
+
+    for (i = 1; i < length; i++)
+    {
+
+        if (buffer[i] == '/')
+        {
+
+            buffer[i] = '\0';
+
+            sys_mkdir(buffer);
+
+            buffer[i] = '/';
+
+        }
+
+    }
+
+    sys_mkdir(buffer);
+
+}
+
+static unsigned int savecache(struct index *index, char *cachedir, char *path)
+{
+
+    struct cacheheader header;
+    struct cachefile cachefiles[MAX_FILES];
+    char temppath[4096];
+    unsigned int complete;
+    unsigned int offset;
+    unsigned int i;
+    int fd;
+
+    if (snprintf(temppath, 4096, "%s.%u", path, sys_pid()) >= 4096)
+        return 0;
+
+    makedirs(cachedir);
+
+    fd = sys_create(temppath);
+
+    if (fd < 0)
+        return 0;
+
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.nfiles = index->nfiles;
+    header.files = cachealign(sizeof (struct cacheheader));
+    offset = cachealign(header.files + sizeof (struct cachefile) * index->nfiles);
+
+    for (i = 0; i < index->nfiles; i++)
+    {
+
+        cachefiles[i].size = index->files[i].size;
+        cachefiles[i].mtime = index->files[i].mtime;
+        cachefiles[i].hash = hashfile(index->files[i].name, index->files[i].size);
+        cachefiles[i].data = offset;
+        cachefiles[i].count = index->files[i].count;
+        offset = cachealign(offset + index->files[i].count);
+
+    }
+
+    header.nentries = index->nentries;
+    header.entries = offset;
+    header.maxnames = index->maxnames;
+    header.nprovides = index->nprovides;
+    header.maxvirtuals = index->maxvirtuals;
+    header.nedges = index->nedges;
+    header.ngroups = index->ngroups;
+    header.ncandidates = index->ncandidates;
+    header.nrdeps = index->nrdeps;
+    header.nkeys = index->nkeys;
+    header.count = cachelayout(&header);
+
+    offset = writecache(fd, &header, sizeof (struct cacheheader), 0);
+    offset = writecache(fd, cachefiles, sizeof (struct cachefile) * index->nfiles, offset);
+
+    for (i = 0; i < index->nfiles; i++)
+        offset = writecache(fd, index->files[i].data, index->files[i].count, offset);
+
+    offset = writecache(fd, index->entries, sizeof (struct entry) * index->nentries, offset);
+    offset = writecache(fd, index->names, sizeof (unsigned int) * index->maxnames, offset);
+    offset = writecache(fd, index->provides, sizeof (struct provide) * index->nprovides, offset);
+    offset = writecache(fd, index->virtuals, sizeof (unsigned int) * index->maxvirtuals, offset);
+    offset = writecache(fd, index->edges, sizeof (struct edge) * index->nedges, offset);
+    offset = writecache(fd, index->nodes, sizeof (unsigned int) * (index->nentries + 1), offset);
+    offset = writecache(fd, index->groups, sizeof (struct group) * (index->ngroups + 1), offset);
+    offset = writecache(fd, index->alternatives, sizeof (struct alternative) * (index->nedges + 1), offset);
+    offset = writecache(fd, index->candidates, sizeof (unsigned int) * index->ncandidates, offset);
+    offset = writecache(fd, index->rnodes, sizeof (unsigned int) * (index->nentries + 1), offset);
+    offset = writecache(fd, index->rdeps, sizeof (unsigned int) * index->nrdeps, offset);
+    offset = writecache(fd, index->keys, index->nkeys, offset);
+
+    complete = sys_size(fd) == header.count;
+
+    if (sys_tryclose(fd) < 0 || !complete || sys_rename(temppath, path) < 0)
+    {
+
+        sys_unlink(temppath);
+
+        return 0;
+
+    }
+
+    return 1;
+
+}
+
+static void addcandidate(struct index *index, unsigned int *maxcandidates, unsigned int start, unsigned int entry)
+{
+
+    unsigned int i;
+
+    for (i = start; i < index->ncandidates; i++)
+    {
+
+        if (index->candidates[i] == entry)
+            return;
+
+    }
+
+    if (index->ncandidates == *maxcandidates)
+        index->candidates = growarray(index->candidates, maxcandidates, sizeof (unsigned int));
+
+    index->candidates[index->ncandidates] = entry;
+    index->ncandidates++;
+
+}
+
+static void buildgraph(struct index *index)
+{
+
+    unsigned int *rentries = 0;
+    unsigned int *redges = 0;
+    unsigned int maxrdeps = 0;
+    unsigned int maxcandidates = 0;
+    unsigned int ngroups = 0;
+    unsigned int i;
+
+    for (i = 0; i < index->nedges; i++)
+    {
+
+        if (!index->edges[i].alternative)
+            ngroups++;
+
+    }
+
+    index->nodes = allocarray(index->nentries + 1, sizeof (unsigned int));
+    index->groups = allocarray(ngroups + 1, sizeof (struct group));
+    index->alternatives = allocarray(index->nedges + 1, sizeof (struct alternative));
+    index->rnodes = allocarray(index->nentries + 1, sizeof (unsigned int));
+
+    for (i = 0; i < index->nedges; i++)
+    {
+
+        struct edge *edge = &index->edges[i];
+        struct alternative *alternative = &index->alternatives[i];
+        char *key = index_key(index, &edge->key);
+        struct vstring vstring;
+        unsigned int id;
+
+        if (!edge->alternative)
+        {
+
+            index->groups[index->ngroups].field = edge->field;
+            index->groups[index->ngroups].start = i;
+            index->ngroups++;
+            index->nodes[edge->entry]++;
+
+        }
+
+        edge_vstring(index, edge, &vstring);
+
+        alternative->relation = getrelation(vstring.relation.data, vstring.relation.length);
+        alternative->key = edge->key;
+        alternative->start = index->ncandidates;
+
+        for (id = findname(index, &vstring.name); id; id = index->entries[id - 1].next)
+        {
+
+            struct entry *current = &index->entries[id - 1];
+
+            if (checkrelation(alternative->relation, version_comparekeys(index_key(index, &current->key), current->key.length, key, edge->key.length)) != COMPARE_VALID)
+                continue;
+
+            addcandidate(index, &maxcandidates, alternative->start, id - 1);
+
+        }
+
+        for (id = findvirtual(index, &vstring.name); id; id = index->provides[id - 1].next)
+        {
+
+            struct provide *current = &index->provides[id - 1];
+
+            if (checkrelation(alternative->relation, version_comparekeys(index_key(index, &current->key), current->key.length, key, edge->key.length)) == COMPARE_VALID)
+                addcandidate(index, &maxcandidates, alternative->start, current->entry - 1);
+
+        }
+
+        for (id = alternative->start; id < index->ncandidates; id++)
+        {
+
+            if (index->nrdeps == maxrdeps)
+            {
+
+                unsigned int max = maxrdeps;
+
+                rentries = growarray(rentries, &max, sizeof (unsigned int));
+                redges = growarray(redges, &maxrdeps, sizeof (unsigned int));
+
+            }
+
+            rentries[index->nrdeps] = index->candidates[id];
+            redges[index->nrdeps] = i;
+            index->nrdeps++;
+            index->rnodes[index->candidates[id] + 1]++;
+
+        }
+
+        alternative->target = (index->ncandidates > alternative->start) ? index->candidates[alternative->start] + 1 : 0;
+
+    }
+
+    index->groups[index->ngroups].start = index->nedges;
+    index->alternatives[index->nedges].start = index->ncandidates;
+
+    for (i = 0; i < index->nentries; i++)
+    {
+
+        index->nodes[i + 1] += index->nodes[i];
+        index->rnodes[i + 1] += index->rnodes[i];
+
+    }
+
+    index->rdeps = allocarray(index->nrdeps, sizeof (unsigned int));
+
+    for (i = 0; i < index->nrdeps; i++)
+        index->rdeps[index->rnodes[rentries[i]]++] = redges[i];
+
+    for (i = index->nentries; i > 0; i--)
+        index->rnodes[i] = index->rnodes[i - 1];
+
+    index->rnodes[0] = 0;
+
+    free(rentries);
+    free(redges);
+
+}
+
+static unsigned int jobs = 1;
+
+static void buildindex(struct index *index, unsigned int nfiles, char **filenames)
+{
+
+    struct loader loader;
+    pthread_t threads[MAX_JOBS];
+    struct stream *streams[MAX_FILES];
+    unsigned int maxarenas = 0;
+    unsigned int nthreads;
+    unsigned int nentries = 0;
+    unsigned int nprovides = 0;
+    unsigned int nedges = 0;
+    unsigned int nkeys = 0;
+    unsigned int total = 0;
+    unsigned int chunksize;
+    unsigned int i;
+    unsigned int j;
+
+    if (nfiles > MAX_FILES)
+    {
+
+        nfiles = MAX_FILES;
+
+        output_printf(SYS_FD_STDERR, "WARNING: max number of files reached (%u)\n", MAX_FILES);
+
+    }
+
+    index->files = allocarray(nfiles, sizeof (struct file));
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        struct file *file = &index->files[i];
+        unsigned int fd = sys_open(filenames[i]);
+        char *program;
+
+        file->name = filenames[i];
+        file->count = sys_size(fd);
+        file->size = file->count;
+        file->data = (file->count) ? sys_map(fd, file->count) : 0;
+        file->mapped = file->count;
+        file->mtime = sys_mtime(fd);
+        program = decompressor(file->data, file->count);
+        streams[i] = 0;
+
+        if (program)
+        {
+
+            sys_unmap(file->data, file->count);
+
+            file->mapped = STREAM_SIZE;
+            streams[i] = allocarray(1, sizeof (struct stream));
+            streams[i]->name = file->name;
+            streams[i]->file = i;
+            file->data = 0;
+            file->count = 0;
+
+            openstream(streams[i], program, fd);
+
+        }
+
+        else if (file->count)
+        {
+
+            sys_advise(file->data, file->count, SYS_ADVISE_SEQUENTIAL);
+
+        }
+
+        sys_close(fd);
+
+        total += file->count;
+
+    }
+
+    index->nfiles = nfiles;
+    chunksize = (jobs > 1 && total / (jobs * 4) > CHUNK_SIZE) ? total / (jobs * 4) : CHUNK_SIZE;
+
+    if (jobs == 1)
+        chunksize = total;
+
+    loader.arenas = 0;
+    loader.narenas = 0;
+    loader.next = 0;
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        struct file *file = &index->files[i];
+        unsigned int offset;
+        unsigned int end;
+
+        for (offset = 0; offset < file->count; offset = end)
+        {
+
+            struct arena *arena;
+
+            end = (file->count - offset > chunksize) ? nextstanza(file->data, file->count, offset + chunksize) : file->count;
+
+            if (loader.narenas == maxarenas)
+                loader.arenas = growarray(loader.arenas, &maxarenas, sizeof (struct arena));
+
+            arena = &loader.arenas[loader.narenas++];
+
+            memset(arena, 0, sizeof (struct arena));
+
+            arena->file = i;
+            arena->data = file->data;
+            arena->start = offset;
+            arena->end = end;
+
+        }
+
+    }
+
+    nthreads = (jobs < loader.narenas) ? jobs : loader.narenas;
+
+    if (nthreads > MAX_JOBS)
+        nthreads = MAX_JOBS;
+
+    pthread_mutex_init(&loader.lock, 0);
+
+    for (i = 1; i < nthreads; i++)
+    {
+
+        if (pthread_create(&threads[i], 0, parsethread, &loader))
+            break;
+
+    }
+
+    nthreads = i;
+
+    parsethread(&loader);
+
+    for (i = 1; i < nthreads; i++)
+        pthread_join(threads[i], 0);
+
+    pthread_mutex_destroy(&loader.lock);
+
+    for (i = 0; i < loader.narenas; i++)
+    {
+
+        nentries += loader.arenas[i].nentries;
+        nprovides += loader.arenas[i].nprovides;
+        nedges += loader.arenas[i].nedges;
+        nkeys += loader.arenas[i].nkeys;
+
+    }
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        unsigned int j;
+
+        if (!streams[i])
+            continue;
+
+        closestream(streams[i], &index->files[i]);
+
+        for (j = 0; j < streams[i]->narenas; j++)
+        {
+
+            nentries += streams[i]->arenas[j].nentries;
+            nprovides += streams[i]->arenas[j].nprovides;
+            nedges += streams[i]->arenas[j].nedges;
+            nkeys += streams[i]->arenas[j].nkeys;
+
+        }
+
+    }
+
+    index->entries = allocarray(nentries, sizeof (struct entry));
+    index->provides = allocarray(nprovides, sizeof (struct provide));
+    index->edges = allocarray(nedges, sizeof (struct edge));
+    index->keys = allocarray(nkeys, 1);
+    index->maxnames = hashsize(nentries);
+    index->names = allocarray(index->maxnames, sizeof (unsigned int));
+    index->maxvirtuals = hashsize(nprovides);
+    index->virtuals = allocarray(index->maxvirtuals, sizeof (unsigned int));
+
+    for (i = 0, j = 0; i < nfiles; i++)
+    {
+
+        unsigned int k;
+
+        for (; j < loader.narenas && loader.arenas[j].file == i; j++)
+            mergearena(index, &loader.arenas[j]);
+
+        if (!streams[i])
+            continue;
+
+        for (k = 0; k < streams[i]->narenas; k++)
+            mergearena(index, &streams[i]->arenas[k]);
+
+        free(streams[i]->arenas);
+        free(streams[i]);
+
+    }
+
+    free(loader.arenas);
+
+    for (i = 0; i < nfiles; i++)
+    {
+
+        if (index->files[i].count)
+            sys_advise(index->files[i].data, index->files[i].count, SYS_ADVISE_RANDOM);
+
+    }
+
+    for (i = index->nentries; i > 0; i--)
+        addname(index, i);
+
+    for (i = index->nprovides; i > 0; i--)
+        addvirtual(index, i);
+
+    buildgraph(index);
+
+}
+
+static char *cachedir;
+static char cachedirdata[4096];
+
+static unsigned int parsefiles(struct index *index, unsigned int nfiles, char **filenames)
+{
+
+    char path[4096];
+
+    if (cachedir && cachepath(path, 4096, cachedir, nfiles, filenames))
+    {
+
+        if (!loadcache(index, path, nfiles, filenames))
+        {
+
+            buildindex(index, nfiles, filenames);
+            savecache(index, cachedir, path);
+
+        }
+
+    }
+
+    else
+    {
+
+        buildindex(index, nfiles, filenames);
+
+    }
+
+    return index->nentries;
+
+}
+
+static void freeindex(struct index *index)
+{
+
+    unsigned int i;
+
+    for (i = 0; i < index->nfiles; i++)
+    {
+
+        if (index->files[i].mapped)
+            sys_unmap(index->files[i].data, index->files[i].mapped);
+
+    }
+
+    if (index->cache)
+    {
+
+        sys_unmap(index->cache, index->ncache);
+
+    }
+
+    else
+    {
+
+        free(index->entries);
+        free(index->names);
+        free(index->provides);
+        free(index->virtuals);
+        free(index->edges);
+        free(index->nodes);
+        free(index->groups);
+        free(index->alternatives);
+        free(index->candidates);
+        free(index->rnodes);
+        free(index->rdeps);
+        free(index->keys);
+
+    }
+
+    free(index->files);
+    free(index);
+
+}
+
+static struct index packages;
+
+static unsigned int loadindex(struct query *query, unsigned int nfiles, char **filenames)
+{
+
+    if (!query->index->nfiles)
+        parsefiles(query->index, nfiles, filenames);
+
+    return query->index->nentries;
+
+}
+
+static void query_init(struct query *query, struct index *index)
+{
+
+    query->index = index;
+    query->out = SYS_FD_STDOUT;
+    query->err = SYS_FD_STDERR;
+    query->matched = 0;
+    query->visited = 0;
+    query->maxmatched = 0;
+    query->nmatched = 0;
+    query->server = 0;
+
+}
+
+static void query_reset(struct query *query)
+{
+
+    unsigned int i;
+
+    if (query->maxmatched < query->index->nentries)
+    {
+
+        free(query->matched);
+        free(query->visited);
+
+        query->maxmatched = query->index->nentries;
+        query->matched = allocarray(query->maxmatched, sizeof (unsigned int));
+        query->visited = allocarray(query->maxmatched / BITS_LONG + 1, sizeof (unsigned long));
+        query->nmatched = 0;
+
+    }
+
+    for (i = 0; i < query->nmatched; i++)
+        query->visited[query->matched[i] / BITS_LONG] = 0;
+
+    query->nmatched = 0;
+
+}
+
+static unsigned int findconflicts(struct index *index, unsigned int edge, unsigned int *matches, unsigned int max)
+{
+
+    struct alternative *alternative = &index->alternatives[edge];
+    char *key = index_key(index, &alternative->key);
+    unsigned int entry = index->edges[edge].entry;
+    struct vstring vstring;
+    unsigned int count = 0;
+    unsigned int id;
+
+    edge_vstring(index, &index->edges[edge], &vstring);
+
+    for (id = findname(index, &vstring.name); id && count < max; id = index->entries[id - 1].next)
+    {
+
+        struct entry *current = &index->entries[id - 1];
+
+        if (id != entry && checkrelation(alternative->relation, version_comparekeys(index_key(index, &current->key), current->key.length, key, alternative->key.length)) == COMPARE_VALID)
+            matches[count++] = id - 1;
+
+    }
+
+    for (id = findvirtual(index, &vstring.name); id && count < max; id = index->provides[id - 1].next)
+    {
+
+        struct provide *current = &index->provides[id - 1];
+
+        if (current->entry == entry || (alternative->relation != RELATION_NONE && !current->vslice.version.length))
+            continue;
+
+        if (checkrelation(alternative->relation, version_comparekeys(index_key(index, &current->key), current->key.length, key, alternative->key.length)) == COMPARE_VALID)
+            matches[count++] = current->entry - 1;
+
+    }
+
+    return count;
+
+}
+
+static void solver_init(struct solver *solver, struct query *query, unsigned int fields, unsigned int maxroots)
+{
+
+    solver->query = query;
+    solver->index = query->index;
+    solver->fields = fields;
+    solver->roots = allocarray(maxroots, sizeof (unsigned int));
+    solver->nroots = 0;
+    solver->forbidden = allocarray(query->index->nentries, sizeof (unsigned int));
+    solver->forbidder = allocarray(query->index->nentries, sizeof (unsigned int));
+    solver->watches = allocarray(query->index->nentries, sizeof (unsigned int));
+    solver->parents = allocarray(query->index->nentries, sizeof (unsigned int));
+    solver->positions = allocarray(query->index->nentries, sizeof (unsigned int));
+    solver->decisions = 0;
+    solver->ndecisions = 0;
+    solver->maxdecisions = 0;
+    solver->clauses = 0;
+    solver->nclauses = 0;
+    solver->maxclauses = 0;
+    solver->members = 0;
+    solver->nmembers = 0;
+    solver->maxmembers = 0;
+    solver->backtracks = 0;
+    solver->failnode = 0;
+    solver->failgroup = 0;
+    solver->strict = 0;
+    solver->minimize = 0;
+    solver->cost = 0;
+
+}
+
+static void solver_destroy(struct solver *solver)
+{
+
+    free(solver->roots);
+    free(solver->forbidden);
+    free(solver->forbidder);
+    free(solver->watches);
+    free(solver->parents);
+    free(solver->positions);
+    free(solver->decisions);
+    free(solver->clauses);
+    free(solver->members);
+
+}
+
+static void solver_mark(struct solver *solver, unsigned int node, unsigned int install)
+{
+
+    struct index *index = solver->index;
+    unsigned int group;
+
+    for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
+    {
+
+        unsigned int i;
+
+        if (!(index->groups[group].field & (FIELD_CONFLICTS | FIELD_BREAKS)))
+            continue;
+
+        for (i = index->groups[group].start; i < index->groups[group + 1].start; i++)
+        {
+
+            unsigned int matches[MAX_CONFLICTS];
+            unsigned int count = findconflicts(index, i, matches, MAX_CONFLICTS);
+            unsigned int j;
+
+            for (j = 0; j < count; j++)
+            {
+
+                unsigned int match = matches[j];
+
+                if (install)
+                {
+
+                    if (!solver->forbidden[match]++)
+                        solver->forbidder[match] = i + 1;
+
+                }
+
+                else
+                {
+
+                    if (!--solver->forbidden[match])
+                        solver->forbidder[match] = 0;
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
+
+static unsigned long solver_cost(struct solver *solver, unsigned int node)
+{
+
+    struct entry *entry = &solver->index->entries[node];
+
+    return (solver->minimize == MINIMIZE_SIZE) ? entry->size : entry->isize;
+
+}
+
+static void solver_install(struct solver *solver, unsigned int node, unsigned int parent)
+{
+
+    solver->parents[node] = parent;
+    solver->positions[node] = solver->query->nmatched;
+    solver->cost += solver_cost(solver, node);
+
+    addmatched(solver->query, node);
+    solver_mark(solver, node, 1);
+
+}
+
+static void solver_undo(struct solver *solver, unsigned int ntrail)
+{
+
+    struct query *query = solver->query;
+
+    while (query->nmatched > ntrail)
+    {
+
+        unsigned int node = query->matched[--query->nmatched];
+
+        query->visited[node / BITS_LONG] &= ~(1UL << (node % BITS_LONG));
+        solver->cost -= solver_cost(solver, node);
+
+        solver_mark(solver, node, 0);
+
+    }
+
+}
+
+static void solver_clear(struct solver *solver)
+{
+
+    unsigned int i;
+
+    solver_undo(solver, 0);
+
+    for (i = 0; i < solver->nmembers; i++)
+        solver->watches[solver->members[i].entry] = 0;
+
+    solver->nroots = 0;
+    solver->ndecisions = 0;
+    solver->nclauses = 0;
+    solver->nmembers = 0;
+    solver->backtracks = 0;
+    solver->cost = 0;
+
+}
+
+static unsigned int solver_conflict(struct solver *solver, unsigned int node, unsigned int *culprit)
+{
+
+    struct index *index = solver->index;
+    unsigned int group;
+
+    if (solver->forbidden[node])
+    {
+
+        *culprit = index->edges[solver->forbidder[node] - 1].entry - 1;
+
+        return solver->forbidder[node];
+
+    }
+
+    for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
+    {
+
+        unsigned int i;
+
+        if (!(index->groups[group].field & (FIELD_CONFLICTS | FIELD_BREAKS)))
+            continue;
+
+        for (i = index->groups[group].start; i < index->groups[group + 1].start; i++)
+        {
+
+            unsigned int matches[MAX_CONFLICTS];
+            unsigned int count = findconflicts(index, i, matches, MAX_CONFLICTS);
+            unsigned int j;
+
+            for (j = 0; j < count; j++)
+            {
+
+                if (isvisited(solver->query, matches[j]))
+                {
+
+                    *culprit = matches[j];
+
+                    return i + 1;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int solver_clause(struct solver *solver, unsigned int node)
+{
+
+    unsigned int id;
+
+    for (id = solver->watches[node]; id; id = solver->members[id - 1].next)
+    {
+
+        struct clause *clause = &solver->clauses[solver->members[id - 1].clause];
+        unsigned int i;
+
+        for (i = clause->start; i < clause->start + clause->count; i++)
+        {
+
+            unsigned int entry = solver->members[i].entry;
+
+            if (entry != node && !isvisited(solver->query, entry))
+                break;
+
+        }
+
+        if (i == clause->start + clause->count)
+            return solver->members[id - 1].clause + 1;
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int solver_viable(struct solver *solver, unsigned int node)
+{
+
+    unsigned int culprit;
+
+    return !solver_conflict(solver, node, &culprit) && !solver_clause(solver, node);
+
+}
+
+static unsigned int solver_first(struct solver *solver, unsigned int group)
+{
+
+    return solver->index->alternatives[solver->index->groups[group].start].start;
+
+}
+
+static unsigned int solver_end(struct solver *solver, unsigned int group)
+{
+
+    return solver->index->alternatives[solver->index->groups[group + 1].start].start;
+
+}
+
+static unsigned int solver_satisfied(struct solver *solver, unsigned int group)
+{
+
+    unsigned int end = solver_end(solver, group);
+    unsigned int i;
+
+    for (i = solver_first(solver, group); i < end; i++)
+    {
+
+        if (isvisited(solver->query, solver->index->candidates[i]))
+            return 1;
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int solver_available(struct solver *solver, unsigned int group)
+{
+
+    return solver_first(solver, group) < solver_end(solver, group);
+
+}
+
+static unsigned int solver_next(struct solver *solver, unsigned int group, unsigned int from)
+{
+
+    unsigned int end = solver_end(solver, group);
+    unsigned int i;
+
+    for (i = from; i < end; i++)
+    {
+
+        if (solver_viable(solver, solver->index->candidates[i]))
+            break;
+
+    }
+
+    return i;
+
+}
+
+static void solver_addmember(struct solver *solver, unsigned int entry)
+{
+
+    struct member *member;
+    unsigned int i;
+
+    for (i = solver->clauses[solver->nclauses].start; i < solver->nmembers; i++)
+    {
+
+        if (solver->members[i].entry == entry)
+            return;
+
+    }
+
+    if (solver->nmembers == solver->maxmembers)
+        solver->members = growarray(solver->members, &solver->maxmembers, sizeof (struct member));
+
+    member = &solver->members[solver->nmembers];
+    member->entry = entry;
+    member->clause = solver->nclauses;
+    member->next = solver->watches[entry];
+    solver->nmembers++;
+    solver->watches[entry] = solver->nmembers;
+
+}
+
+static void solver_addreason(struct solver *solver, unsigned int node)
+{
+
+    unsigned int culprit;
+    unsigned int clause;
+
+    if (solver_conflict(solver, node, &culprit))
+    {
+
+        solver_addmember(solver, culprit);
+
+    }
+
+    else if ((clause = solver_clause(solver, node)))
+    {
+
+        unsigned int start = solver->clauses[clause - 1].start;
+        unsigned int count = solver->clauses[clause - 1].count;
+        unsigned int i;
+
+        for (i = start; i < start + count; i++)
+        {
+
+            if (solver->members[i].entry != node)
+                solver_addmember(solver, solver->members[i].entry);
+
+        }
+
+    }
+
+}
+
+static void solver_learn(struct solver *solver, unsigned int node, unsigned int group)
+{
+
+    struct index *index = solver->index;
+
+    if (solver->nclauses == solver->maxclauses)
+        solver->clauses = growarray(solver->clauses, &solver->maxclauses, sizeof (struct clause));
+
+    solver->clauses[solver->nclauses].start = solver->nmembers;
+
+    if (group < index->ngroups)
+    {
+
+        unsigned int i;
+
+        solver_addmember(solver, node);
+
+        for (i = solver_first(solver, group); i < solver_end(solver, group); i++)
+            solver_addreason(solver, index->candidates[i]);
+
+    }
+
+    else
+    {
+
+        solver_addreason(solver, node);
+
+    }
+
+    solver->clauses[solver->nclauses].count = solver->nmembers - solver->clauses[solver->nclauses].start;
+    solver->nclauses++;
+    solver->failnode = node;
+    solver->failgroup = group;
+
+}
+
+static void solver_decide(struct solver *solver, unsigned int group, unsigned int candidate, unsigned int position)
+{
+
+    struct decision *decision;
+
+    if (solver->ndecisions == solver->maxdecisions)
+        solver->decisions = growarray(solver->decisions, &solver->maxdecisions, sizeof (struct decision));
+
+    decision = &solver->decisions[solver->ndecisions];
+    decision->group = group;
+    decision->candidate = candidate;
+    decision->position = position;
+    decision->ntrail = solver->query->nmatched;
+    solver->ndecisions++;
+
+}
+
+static unsigned int solver_limit(struct solver *solver)
+{
+
+    struct clause *clause = &solver->clauses[solver->nclauses - 1];
+    unsigned int limit = 0;
+    unsigned int i;
+
+    for (i = clause->start; i < clause->start + clause->count; i++)
+    {
+
+        unsigned int position = solver->positions[solver->members[i].entry] + 1;
+
+        if (limit < position)
+            limit = position;
+
+    }
+
+    return limit;
+
+}
+
+static unsigned int solver_backtrack(struct solver *solver, unsigned int *position, unsigned int *group)
+{
+
+    struct index *index = solver->index;
+
+    while (solver->backtracks < MAX_BACKTRACKS)
+    {
+
+        unsigned int limit = solver_limit(solver);
+        struct decision *decision;
+        unsigned int candidate;
+        unsigned int end;
+
+        while (solver->ndecisions && solver->decisions[solver->ndecisions - 1].ntrail >= limit)
+            solver->ndecisions--;
+
+        if (!solver->ndecisions)
+            return 0;
+
+        decision = &solver->decisions[solver->ndecisions - 1];
+        end = solver_end(solver, decision->group);
+        solver->backtracks++;
+
+        solver_undo(solver, decision->ntrail);
+
+        candidate = solver_next(solver, decision->group, decision->candidate + 1);
+
+        if (candidate < end)
+        {
+
+            decision->candidate = candidate;
+            *position = decision->position;
+            *group = decision->group + 1;
+
+            if (solver_next(solver, decision->group, candidate + 1) == end)
+                solver->ndecisions--;
+
+            solver_install(solver, index->candidates[candidate], solver->query->matched[decision->position] + 1);
+
+            return 1;
+
+        }
+
+        solver->ndecisions--;
+
+        solver_learn(solver, solver->query->matched[decision->position], decision->group);
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int solve(struct solver *solver)
+{
+
+    struct query *query = solver->query;
+    struct index *index = solver->index;
+    unsigned int position = 0;
+    unsigned int group = 0;
+
+    while (1)
+    {
+
+        unsigned int node;
+        unsigned int candidate;
+        unsigned int end;
+
+        if (position == query->nmatched)
+        {
+
+            unsigned int i;
+
+            for (i = 0; i < solver->nroots && isvisited(query, solver->roots[i]); i++);
+
+            if (i == solver->nroots)
+                return 1;
+
+            if (solver_viable(solver, solver->roots[i]))
+            {
+
+                solver_install(solver, solver->roots[i], 0);
+
+                group = index->nodes[solver->roots[i]];
+
+            }
+
+            else
+            {
+
+                solver_learn(solver, solver->roots[i], index->ngroups);
+
+                if (!solver_backtrack(solver, &position, &group))
+                    return 0;
+
+            }
+
+            continue;
+
+        }
+
+        node = query->matched[position];
+
+        if (group == index->nodes[node + 1])
+        {
+
+            position++;
+
+            if (position < query->nmatched)
+                group = index->nodes[query->matched[position]];
+
+            continue;
+
+        }
+
+        if (!(index->groups[group].field & solver->fields) || solver_satisfied(solver, group))
+        {
+
+            group++;
+
+            continue;
+
+        }
+
+        end = solver_end(solver, group);
+        candidate = solver_next(solver, group, solver_first(solver, group));
+
+        if (candidate < end)
+        {
+
+            if (solver_next(solver, group, candidate + 1) < end)
+                solver_decide(solver, group, candidate, position);
+
+            solver_install(solver, index->candidates[candidate], node + 1);
+
+            group++;
+
+            continue;
+
+        }
+
+        if (!solver->strict && !solver_available(solver, group))
+        {
+
+            group++;
+
+            continue;
+
+        }
+
+        solver_learn(solver, node, group);
+
+        if (!solver_backtrack(solver, &position, &group))
+            return 0;
+
+    }
+
+}
+
+static void bounds_init(struct bounds *bounds, unsigned int nentries)
+{
+
+    bounds->starts = allocarray(nentries, sizeof (unsigned int));
+    bounds->counts = allocarray(nentries, sizeof (unsigned int));
+    bounds->pool = 0;
+    bounds->npool = 0;
+    bounds->maxpool = 0;
+    bounds->stamps = allocarray(nentries, sizeof (unsigned int));
+    bounds->stamp = 0;
+    bounds->stack = allocarray(nentries, sizeof (unsigned int));
+
+}
+
+static void bounds_destroy(struct bounds *bounds)
+{
+
+    free(bounds->starts);
+    free(bounds->counts);
+    free(bounds->pool);
+    free(bounds->stamps);
+    free(bounds->stack);
+
+}
+
+static void bounds_build(struct bounds *bounds, struct solver *solver, unsigned int node)
+{
+
+    struct index *index = solver->index;
+    unsigned int nstack = 0;
+
+    bounds->stamp++;
+    bounds->starts[node] = bounds->npool + 1;
+    bounds->stamps[node] = bounds->stamp;
+    bounds->stack[nstack++] = node;
+
+    while (nstack)
+    {
+
+        unsigned int current = bounds->stack[--nstack];
+        unsigned int group;
+
+        if (bounds->npool == bounds->maxpool)
+            bounds->pool = growarray(bounds->pool, &bounds->maxpool, sizeof (unsigned int));
+
+        bounds->pool[bounds->npool] = current;
+        bounds->npool++;
+
+        for (group = index->nodes[current]; group < index->nodes[current + 1]; group++)
+        {
+
+            unsigned int end = solver_end(solver, group);
+            unsigned int target;
+            unsigned int i;
+
+            if (!(index->groups[group].field & solver->fields) || !solver_available(solver, group))
+                continue;
+
+            target = index->candidates[solver_first(solver, group)];
+
+            for (i = solver_first(solver, group); i < end && index->candidates[i] == target; i++);
+
+            if (i < end || bounds->stamps[target] == bounds->stamp)
+                continue;
+
+            bounds->stamps[target] = bounds->stamp;
+            bounds->stack[nstack++] = target;
+
+        }
+
+    }
+
+    bounds->counts[node] = bounds->npool - (bounds->starts[node] - 1);
+
+}
+
+static unsigned long bounds_cost(struct bounds *bounds, struct solver *solver, unsigned int node)
+{
+
+    unsigned long cost = 0;
+    unsigned int i;
+
+    if (!bounds->starts[node])
+        bounds_build(bounds, solver, node);
+
+    for (i = bounds->starts[node] - 1; i < bounds->starts[node] - 1 + bounds->counts[node]; i++)
+    {
+
+        if (!isvisited(solver->query, bounds->pool[i]))
+            cost += solver_cost(solver, bounds->pool[i]);
+
+    }
+
+    return cost;
+
+}
+
+static unsigned int solver_cheapest(struct solver *solver, struct bounds *bounds, unsigned int group, unsigned char *tried, unsigned long best, unsigned int *candidate)
+{
+
+    unsigned int start = solver_first(solver, group);
+    unsigned int end = solver_end(solver, group);
+    unsigned long lowest = best;
+    unsigned int i;
+
+    for (i = start; i < end; i++)
+    {
+
+        unsigned int target = solver->index->candidates[i];
+        unsigned long cost;
+
+        if (tried[i] || !solver_viable(solver, target))
+            continue;
+
+        cost = solver->cost + bounds_cost(bounds, solver, target);
+
+        if (cost < lowest)
+        {
+
+            lowest = cost;
+            *candidate = i;
+
+        }
+
+    }
+
+    return lowest < best;
+
+}
+
+static unsigned int solver_retry(struct solver *solver, struct bounds *bounds, unsigned char *tried, unsigned long best, unsigned int *position, unsigned int *group)
+{
+
+    struct index *index = solver->index;
+
+    while (solver->ndecisions)
+    {
+
+        struct decision *decision = &solver->decisions[solver->ndecisions - 1];
+        unsigned int candidate;
+
+        solver_undo(solver, decision->ntrail);
+
+        if (solver_cheapest(solver, bounds, decision->group, tried, best, &candidate))
+        {
+
+            tried[candidate] = 1;
+            *position = decision->position;
+            *group = decision->group + 1;
+
+            solver_install(solver, index->candidates[candidate], solver->query->matched[decision->position] + 1);
+
+            return 1;
+
+        }
+
+        solver->ndecisions--;
+
+    }
+
+    return 0;
+
+}
+
+static unsigned int solver_minimize(struct solver *solver, unsigned long budget)
+{
+
+    struct query *query = solver->query;
+    struct index *index = solver->index;
+    unsigned int *best = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned int *parents = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned char *tried = allocarray(index->ncandidates + 1, sizeof (unsigned char));
+    unsigned int nbest = query->nmatched;
+    unsigned long bestcost = solver->cost;
+    unsigned long deadline = sys_clock() + budget * 1000000;
+    unsigned int position = 0;
+    unsigned int group = 0;
+    unsigned int steps = 0;
+    unsigned int finished = 0;
+    struct bounds bounds;
+    unsigned int i;
+
+    bounds_init(&bounds, index->nentries);
+
+    for (i = 0; i < nbest; i++)
+    {
+
+        best[i] = query->matched[i];
+        parents[i] = solver->parents[best[i]];
+
+    }
+
+    solver_undo(solver, 0);
+
+    solver->ndecisions = 0;
+
+    while (!finished)
+    {
+
+        unsigned int node;
+        unsigned int candidate;
+
+        if (!(++steps % 256) && sys_clock() > deadline)
+            break;
+
+        if (solver->cost >= bestcost)
+        {
+
+            finished = !solver_retry(solver, &bounds, tried, bestcost, &position, &group);
+
+            continue;
+
+        }
+
+        if (position == query->nmatched)
+        {
+
+            for (i = 0; i < solver->nroots && isvisited(query, solver->roots[i]); i++);
+
+            if (i == solver->nroots)
+            {
+
+                nbest = query->nmatched;
+                bestcost = solver->cost;
+
+                for (i = 0; i < nbest; i++)
+                {
+
+                    best[i] = query->matched[i];
+                    parents[i] = solver->parents[best[i]];
+
+                }
+
+                finished = !solver_retry(solver, &bounds, tried, bestcost, &position, &group);
+
+            }
+
+            else if (solver_viable(solver, solver->roots[i]))
+            {
+
+                solver_install(solver, solver->roots[i], 0);
+
+                group = index->nodes[solver->roots[i]];
+
+            }
+
+            else
+            {
+
+                finished = !solver_retry(solver, &bounds, tried, bestcost, &position, &group);
+
+            }
+
+            continue;
+
+        }
+
+        node = query->matched[position];
+
+        if (group == index->nodes[node + 1])
+        {
+
+            position++;
+
+            if (position < query->nmatched)
+                group = index->nodes[query->matched[position]];
+
+            continue;
+
+        }
+
+        if (!(index->groups[group].field & solver->fields) || solver_satisfied(solver, group))
+        {
+
+            group++;
+
+            continue;
+
+        }
+
+        memset(tried + solver_first(solver, group), 0, solver_end(solver, group) - solver_first(solver, group));
+
+        if (solver_cheapest(solver, &bounds, group, tried, bestcost, &candidate))
+        {
+
+            solver_decide(solver, group, candidate, position);
+
+            tried[candidate] = 1;
+
+            solver_install(solver, index->candidates[candidate], node + 1);
+
+            group++;
+
+            continue;
+
+        }
+
+        if (!solver->strict && !solver_available(solver, group))
+        {
+
+            group++;
+
+            continue;
+
+        }
+
+        finished = !solver_retry(solver, &bounds, tried, bestcost, &position, &group);
+
+    }
+
+    solver_undo(solver, 0);
+
+    solver->ndecisions = 0;
+
+    for (i = 0; i < nbest; i++)
+        solver_install(solver, best[i], parents[i]);
+
+    bounds_destroy(&bounds);
+    free(best);
+    free(parents);
+    free(tried);
+
+    return finished;
+
+}
+
+static void solver_explainnode(struct solver *solver, unsigned int fd, unsigned int node)
+{
+
+    struct index *index = solver->index;
+    unsigned int culprit;
+    unsigned int edge;
+    unsigned int clause;
+
+    if ((edge = solver_conflict(solver, node, &culprit)))
+    {
+
+        struct edge *current = &index->edges[edge - 1];
+        unsigned int source = current->entry - 1;
+
+        dprintentry(index, fd, "    %A ", &index->entries[source]);
+        output_printf(fd, (current->field == FIELD_BREAKS) ? "breaks " : "conflicts with ");
+        dprintentry(index, fd, "%A\n", &index->entries[(source == node) ? culprit : node]);
+
+    }
+
+    else if ((clause = solver_clause(solver, node)))
+    {
+
+        unsigned int start = solver->clauses[clause - 1].start;
+        unsigned int count = solver->clauses[clause - 1].count;
+        unsigned int first = 1;
+        unsigned int i;
+
+        if (count == 1)
+        {
+
+            dprintentry(index, fd, "    %A can not be installed\n", &index->entries[node]);
+
+            return;
+
+        }
+
+        dprintentry(index, fd, "    %A can not be installed together with ", &index->entries[node]);
+
+        for (i = start; i < start + count; i++)
+        {
+
+            if (solver->members[i].entry == node)
+                continue;
+
+            dprintentry(index, fd, first ? "%A" : ", %A", &index->entries[solver->members[i].entry]);
+
+            first = 0;
+
+        }
+
+        output_printf(fd, "\n");
+
+    }
+
+}
+
+static void solver_explainchain(struct solver *solver, unsigned int fd, unsigned int node)
+{
+
+    struct index *index = solver->index;
+    unsigned int *chain;
+    unsigned int length = 0;
+    unsigned int current;
+
+    for (current = node + 1; current; current = solver->parents[current - 1])
+        length++;
+
+    chain = allocarray(length, sizeof (unsigned int));
+    length = 0;
+
+    for (current = node + 1; current; current = solver->parents[current - 1])
+        chain[length++] = current - 1;
+
+    dprintentry(index, fd, "  %A", &index->entries[chain[length - 1]]);
+
+    while (--length)
+        dprintentry(index, fd, "\n  -> %A", &index->entries[chain[length - 1]]);
+
+    free(chain);
+
+}
+
+static void solver_explain(struct solver *solver, unsigned int fd)
+{
+
+    struct index *index = solver->index;
+    unsigned int i;
+
+    if (solver->backtracks >= MAX_BACKTRACKS)
+    {
+
+        output_printf(fd, "  Gave up after %u backtracks\n", MAX_BACKTRACKS);
+
+        return;
+
+    }
+
+    if (solver->failgroup >= index->ngroups)
+    {
+
+        dprintentry(index, fd, "  %A is requested\n", &index->entries[solver->failnode]);
+        solver_explainnode(solver, fd, solver->failnode);
+
+        return;
+
+    }
+
+    solver_explainchain(solver, fd, solver->failnode);
+    output_printf(fd, " depends on ");
+    dprintgroup(index, fd, "\n", solver->failgroup);
+
+    for (i = index->groups[solver->failgroup].start; i < index->groups[solver->failgroup + 1].start; i++)
+    {
+
+        unsigned int j;
+
+        if (index->alternatives[i].start == index->alternatives[i + 1].start)
+        {
+
+            struct vstring vstring;
+
+            edge_vstring(index, &index->edges[i], &vstring);
+            dprintvstring(fd, "    %A is not available\n", &vstring);
+
+        }
+
+        for (j = index->alternatives[i].start; j < index->alternatives[i + 1].start; j++)
+            solver_explainnode(solver, fd, index->candidates[j]);
+
+    }
+
+}
+
+static void solver_warn(struct solver *solver)
+{
+
+    struct query *query = solver->query;
+    struct index *index = solver->index;
+    unsigned int i;
+
+    for (i = 0; i < query->nmatched; i++)
+    {
+
+        unsigned int node = query->matched[i];
+        unsigned int group;
+
+        for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
+        {
+
+            if (!(index->groups[group].field & solver->fields) || solver_available(solver, group))
+                continue;
+
+            output_printf(query->err, "WARNING: found no match for ");
+
+            if (index->groups[group + 1].start - index->groups[group].start > 1)
+            {
+
+                output_printf(query->err, "[");
+                dprintgroup(index, query->err, "]\n", group);
+
+            }
+
+            else
+            {
+
+                dprintgroup(index, query->err, "\n", group);
+
+            }
+
+        }
+
+    }
+
+}
+
+static unsigned int solver_addroots(struct solver *solver, char *expression)
+{
+
+    struct query *query = solver->query;
+    unsigned int offset;
+    unsigned int length;
+
+    for (offset = 0; (length = eachcomma(expression, strlen(expression) + 1, offset)); offset += length)
+    {
+
+        struct entry *entry = findmatch(query->index, expression + offset, length);
+
+        if (!entry)
+        {
+
+            output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, expression + offset);
+
+            return 0;
+
+        }
+
+        solver->roots[solver->nroots] = entry - query->index->entries;
+        solver->nroots++;
+
+    }
+
+    return 1;
+
+}
+
+static unsigned int *solver_graph(struct solver *solver, unsigned int all, unsigned int *offsets)
+{
+
+    struct query *query = solver->query;
+    struct index *index = solver->index;
+    unsigned int *targets = 0;
+    unsigned int maxtargets = 0;
+    unsigned int i;
+
+    for (i = 0; i < query->nmatched; i++)
+    {
+
+        unsigned int node = query->matched[i];
+        unsigned int group;
+
+        offsets[i + 1] = offsets[i];
+
+        for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
+        {
+
+            unsigned int j;
+
+            if (!(index->groups[group].field & solver->fields))
+                continue;
+
+            for (j = solver_first(solver, group); j < solver_end(solver, group); j++)
+            {
+
+                unsigned int target = index->candidates[j];
+
+                if (!isvisited(query, target))
+                    continue;
+
+                if (offsets[i + 1] == maxtargets)
+                    targets = growarray(targets, &maxtargets, sizeof (unsigned int));
+
+                targets[offsets[i + 1]] = solver->positions[target];
+                offsets[i + 1]++;
+
+                if (!all)
+                    break;
+
+            }
+
+        }
+
+    }
+
+    return targets;
+
+}
+
+static void reversegraph(unsigned int count, unsigned int *offsets, unsigned int *targets, unsigned int *roffsets, unsigned int *sources)
+{
+
+    unsigned int *fill = allocarray(count, sizeof (unsigned int));
+    unsigned int i;
+
+    for (i = 0; i < offsets[count]; i++)
+        roffsets[targets[i] + 1]++;
+
+    for (i = 0; i < count; i++)
+        roffsets[i + 1] += roffsets[i];
+
+    for (i = 0; i < count; i++)
+    {
+
+        unsigned int j;
+
+        for (j = offsets[i]; j < offsets[i + 1]; j++)
+            sources[roffsets[targets[j]] + fill[targets[j]]++] = i;
+
+    }
+
+    free(fill);
+
+}
+
+static unsigned int findcomponents(unsigned int count, unsigned int *offsets, unsigned int *targets, unsigned int *components, unsigned int *order)
+{
+
+    unsigned int *indexes = allocarray(count, sizeof (unsigned int));
+    unsigned int *lowlinks = allocarray(count, sizeof (unsigned int));
+    unsigned int *stack = allocarray(count, sizeof (unsigned int));
+    unsigned int *calls = allocarray(count, sizeof (unsigned int));
+    unsigned int *next = allocarray(count, sizeof (unsigned int));
+    unsigned char *onstack = allocarray(count, sizeof (unsigned char));
+    unsigned int ncomponents = 0;
+    unsigned int nstack = 0;
+    unsigned int norder = 0;
+    unsigned int counter = 0;
+    unsigned int i;
+
+    for (i = 0; i < count; i++)
+    {
+
+        unsigned int ncalls = 0;
+
+        if (indexes[i])
+            continue;
+
+        indexes[i] = lowlinks[i] = ++counter;
+        next[i] = offsets[i];
+        stack[nstack++] = i;
+        onstack[i] = 1;
+        calls[ncalls++] = i;
+
+        while (ncalls)
+        {
+
+            unsigned int v = calls[ncalls - 1];
+
+            if (next[v] < offsets[v + 1])
+            {
+
+                unsigned int w = targets[next[v]++];
+
+                if (!indexes[w])
+                {
+
+                    indexes[w] = lowlinks[w] = ++counter;
+                    next[w] = offsets[w];
+                    stack[nstack++] = w;
+                    onstack[w] = 1;
+                    calls[ncalls++] = w;
+
+                }
+
+                else if (onstack[w] && indexes[w] < lowlinks[v])
+                {
+
+                    lowlinks[v] = indexes[w];
+
+                }
+
+                continue;
+
+            }
+
+            ncalls--;
+
+            if (ncalls && lowlinks[v] < lowlinks[calls[ncalls - 1]])
+                lowlinks[calls[ncalls - 1]] = lowlinks[v];
+
+            if (lowlinks[v] == indexes[v])
+            {
+
+                unsigned int w;
+
+                do
+                {
+
+                    w = stack[--nstack];
+                    onstack[w] = 0;
+                    components[w] = ncomponents;
+                    order[norder++] = w;
+
+                } while (w != v);
+
+                ncomponents++;
+
+            }
+
+        }
+
+    }
+
+    free(indexes);
+    free(lowlinks);
+    free(stack);
+    free(calls);
+    free(next);
+    free(onstack);
+
+    return ncomponents;
+
+}
+
+static unsigned int splitargs(char *line, char **args, unsigned int max)
+{
+
+    char *out = line;
+    unsigned int count = 0;
+
+    while (*line)
+    {
+
+        while (*line == ' ' || *line == '\t' || *line == '\r')
+            line++;
+
+        if (!*line || count == max)
+            break;
+
+        args[count++] = out;
+
+        while (*line && *line != ' ' && *line != '\t' && *line != '\r')
+        {
+
+            if (*line == '\'' || *line == '"')
+            {
+
+                char quote = *line++;
+
+                while (*line && *line != quote)
+                    *out++ = *line++;
+
+                if (*line)
+                    line++;
+
+            }
+
+            else
+            {
+
+                *out++ = *line++;
+
+            }
+
+        }
+
+        if (*line)
+            line++;
+
+        *out++ = '\0';
+
+    }
+
+    return count;
+
+}
+
+static struct command commands[NUM_CMDS];
+
+static struct command *findcommand(char *name)
+{
+
+    unsigned int i;
+
+    for (i = 0; i < NUM_CMDS; i++)
+    {
+
+        if (!strcmp(name, commands[i].name))
+            return &commands[i];
+
+    }
+
+    return 0;
+
+}
+
+static int runquery(struct query *query, char **args, unsigned int count, unsigned int nfiles, char **filenames)
+{
+
+    struct command *command = findcommand(args[0]);
+
+    if (!command)
+    {
+
+        output_printf(query->err, "ERROR: Unknown command %s\n", args[0]);
+
+        return EXIT_FAILURE;
+
+    }
+
+    if (command->scope == SCOPE_PROCESS)
+    {
+
+        output_printf(query->err, "ERROR: Command %s can not be used on a loaded index\n", args[0]);
+
+        return EXIT_FAILURE;
+
+    }
+
+    if (command->scope == SCOPE_INDEX)
+    {
+
+        memcpy(args + count, filenames, sizeof (char *) * nfiles);
+
+        count += nfiles;
+
+    }
+
+    return command->handle(query, count - 1, args + 1);
+
+}
+
+static void runbatch(struct query *query, char *line, unsigned int nfiles, char **filenames)
+{
+
+    char *args[BATCH_ARGS + MAX_FILES];
+    unsigned int count = splitargs(line, args, BATCH_ARGS);
+
+    if (count)
+        runquery(query, args, count, nfiles, filenames);
+
+}
+
+static int command_batch(struct query *query, int argc, char **argv)
+{
+
+    char *separator = "\036";
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--separator")))
+        {
+
+            separator = value;
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 1)
+    {
+
+        unsigned int nentries = loadindex(query, argc, argv);
+
+        if (nentries)
+        {
+
+            char *buffer = 0;
+            unsigned int maxbuffer = 0;
+            unsigned int count = 0;
+            unsigned int start = 0;
+
+            if (argc > MAX_FILES)
+                argc = MAX_FILES;
+
+            while (1)
+            {
+
+                char *newline = memchr(buffer + start, '\n', count - start);
+                unsigned int n;
+
+                if (newline)
+                {
+
+                    *newline = '\0';
+
+                    runbatch(query, buffer + start, argc, argv);
+                    output_printf(query->out, "%s\n", separator);
+                    output_flush(query->out);
+
+                    start = newline - buffer + 1;
+
+                    continue;
+
+                }
+
+                memmove(buffer, buffer + start, count - start);
+
+                count -= start;
+                start = 0;
+
+                if (count + 1 >= maxbuffer)
+                    buffer = growarray(buffer, &maxbuffer, 1);
+
+                n = sys_read(SYS_FD_STDIN, buffer + count, maxbuffer - count - 1);
+
+                if (!n)
+                    break;
+
+                count += n;
+
+            }
+
+            if (count)
+            {
+
+                buffer[count] = '\0';
+
+                runbatch(query, buffer, argc, argv);
+                output_printf(query->out, "%s\n", separator);
+
+            }
+
+            free(buffer);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "batch [--separator=<string>] <index-file>...\n\n");
+        output_printf(query->out, "Read commands without their index files from standard input, one per line, and run them against the index files\n");
+        output_printf(query->out, "  separator: Printed on a line of its own after the output of each command (default \\036)\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static struct index *server_enter(struct server *server, unsigned int slot)
+{
+
+    __atomic_store_n(&server->epochs[slot], __atomic_load_n(&server->epoch, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+
+    return __atomic_load_n(&server->current, __ATOMIC_SEQ_CST);
+
+}
+
+static void server_leave(struct server *server, unsigned int slot)
+{
+
+    __atomic_store_n(&server->epochs[slot], 0, __ATOMIC_RELEASE);
+
+}
+
+static void server_publish(struct server *server, struct index *index)
+{
+
+    struct index *old = __atomic_exchange_n(&server->current, index, __ATOMIC_SEQ_CST);
+    unsigned long epoch = __atomic_add_fetch(&server->epoch, 1, __ATOMIC_SEQ_CST);
+    unsigned int nworkers = __atomic_load_n(&server->nworkers, __ATOMIC_SEQ_CST);
+    unsigned int i;
+
+    for (i = 0; i < nworkers; i++)
+    {
+
+        unsigned long current;
+
+        while ((current = __atomic_load_n(&server->epochs[i], __ATOMIC_SEQ_CST)) && current < epoch)
+            sys_sleep(1);
+
+    }
+
+    freeindex(old);
+
+}
+
+static void reload(struct server *server)
+{
+
+    unsigned long start = sys_clock();
+    struct index *index;
+    unsigned int i;
+
+    for (i = 0; i < server->nfiles; i++)
+    {
+
+        int fd = sys_tryopen(server->filenames[i]);
+
+        if (fd < 0)
+        {
+
+            output_printf(SYS_FD_STDERR, "WARNING: Could not reload %s, keeping the loaded index\n", server->filenames[i]);
+            pthread_mutex_lock(&server->lock);
+
+            server->failures++;
+
+            pthread_mutex_unlock(&server->lock);
+
+            return;
+
+        }
+
+        sys_tryclose(fd);
+
+    }
+
+    index = allocarray(1, sizeof (struct index));
+
+    if (!parsefiles(index, server->nfiles, server->filenames))
+    {
+
+        output_printf(SYS_FD_STDERR, "WARNING: No entries found after reload, keeping the loaded index\n");
+        freeindex(index);
+        pthread_mutex_lock(&server->lock);
+
+        server->failures++;
+
+        pthread_mutex_unlock(&server->lock);
+
+        return;
+
+    }
+
+    server_publish(server, index);
+    pthread_mutex_lock(&server->lock);
+
+    server->generation++;
+    server->reloads++;
+    server->lastreload = sys_clock() - start;
+    server->totalreload += server->lastreload;
+
+    pthread_mutex_unlock(&server->lock);
+
+}
+
+static void *reloadthread(void *arg)
+{
+
+    struct server *server = arg;
+    int fd = sys_watch(server->filenames, server->nfiles);
+
+    if (fd < 0)
+    {
+
+        output_printf(SYS_FD_STDERR, "WARNING: Could not watch the index files, reloading is disabled\n");
+
+        return 0;
+
+    }
+
+    while (1)
+    {
+
+        if (!sys_waitwatch(fd, server->filenames, server->nfiles, -1))
+            continue;
+
+        while (sys_waitwatch(fd, server->filenames, server->nfiles, RELOAD_DELAY));
+
+        reload(server);
+
+    }
+
+    return 0;
+
+}
+
+static void serveclient(struct server *server, struct query *query, unsigned int slot, unsigned int fd)
+{
+
+    char request[REQUEST_SIZE];
+    int count;
+    int fds[4];
+    unsigned int nfds;
+
+    while ((count = sys_recvfds(fd, request, REQUEST_SIZE - 1, fds, &nfds)) > 0)
+    {
+
+        char *args[BATCH_ARGS + MAX_FILES];
+        unsigned int nargs = 0;
+        int status = EXIT_FAILURE;
+        unsigned int closed = 1;
+        unsigned int offset;
+        unsigned int i;
+
+        request[count] = '\0';
+
+        for (offset = 0; offset < count && nargs < BATCH_ARGS; offset += strlen(request + offset) + 1)
+            args[nargs++] = request + offset;
+
+        if (nfds == 2 && nargs && output_open(fds[0], fds[1]))
+        {
+
+            query->out = fds[0];
+            query->err = fds[1];
+            query->index = server_enter(server, slot);
+            status = runquery(query, args, nargs, server->nfiles, server->filenames);
+
+            server_leave(server, slot);
+            output_close(query->out, query->err);
+
+        }
+
+        for (i = 0; i < nfds; i++)
+        {
+
+            if (sys_tryclose(fds[i]) < 0)
+                closed = 0;
+
+        }
+
+        if (!closed || sys_send(fd, &status, sizeof (int)) < 0)
+            break;
+
+    }
+
+}
+
+static void *servethread(void *arg)
+{
+
+    struct server *server = arg;
+    unsigned int slot = __atomic_fetch_add(&server->nworkers, 1, __ATOMIC_SEQ_CST);
+    struct query query;
+
+    query_init(&query, 0);
+
+    query.server = server;
+
+    while (1)
+    {
+
+        int fd = sys_accept(server->fd);
+
+        if (fd < 0)
+            continue;
+
+        serveclient(server, &query, slot, fd);
+        sys_tryclose(fd);
+
+    }
+
+    return 0;
+
+}
+
+static int command_serve(struct query *query, int argc, char **argv)
+{
+
+    char *socketpath = 0;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--socket")))
+        {
+
+            socketpath = value;
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (socketpath && argc >= 1)
+    {
+
+        struct index *index = allocarray(1, sizeof (struct index));
+        unsigned int nfiles = (argc < MAX_FILES) ? argc : MAX_FILES;
+
+        if (parsefiles(index, nfiles, argv))
+        {
+
+            pthread_t threads[MAX_JOBS];
+            pthread_t reloader;
+            static struct server server;
+            unsigned int nthreads = (jobs < MAX_JOBS) ? jobs : MAX_JOBS;
+            int fd = sys_listen(socketpath);
+            unsigned int i;
+
+            if (fd < 0)
+            {
+
+                output_printf(query->err, "ERROR: Could not listen on %s\n", socketpath);
+
+                return EXIT_FAILURE;
+
+            }
+
+            sys_ignorepipe();
+
+            server.fd = fd;
+            server.current = index;
+            server.nfiles = nfiles;
+            server.filenames = argv;
+            server.epoch = 1;
+            server.generation = 1;
+
+            pthread_mutex_init(&server.lock, 0);
+
+            if (pthread_create(&reloader, 0, reloadthread, &server))
+                output_printf(SYS_FD_STDERR, "WARNING: Could not start the reload thread, reloading is disabled\n");
+
+            for (i = 1; i < nthreads; i++)
+            {
+
+                if (pthread_create(&threads[i], 0, servethread, &server))
+                    break;
+
+            }
+
+            servethread(&server);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "serve --socket=<path> <index-file>...\n\n");
+        output_printf(query->out, "Load the index files once and answer commands from clients connecting to the socket <path>\n");
+        output_printf(query->out, "Use aptinfo --socket=<path> <command> [<args>] without the index files to send a command\n");
+        output_printf(query->out, "The index is reloaded in the background when one of the index files is replaced\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int runclient(char *socketpath, int argc, char **argv)
+{
+
+    char request[REQUEST_SIZE];
+    unsigned int count = 0;
+    int fds[2];
+    int status;
+    int fd;
+    int i;
+
+    for (i = 0; i < argc; i++)
+    {
+
+        unsigned int length = strlen(argv[i]) + 1;
+
+        if (count + length > REQUEST_SIZE)
+        {
+
+            output_printf(SYS_FD_STDERR, "ERROR: Command is too long\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+        memcpy(request + count, argv[i], length);
+
+        count += length;
+
+    }
+
+    fd = sys_connect(socketpath);
+
+    if (fd < 0)
+    {
+
+        output_printf(SYS_FD_STDERR, "ERROR: Could not connect to %s\n", socketpath);
+
+        return EXIT_FAILURE;
+
+    }
+
+    fds[0] = SYS_FD_STDOUT;
+    fds[1] = SYS_FD_STDERR;
+
+    if (sys_sendfds(fd, request, count, fds, 2) < 0 || sys_recv(fd, &status, sizeof (int)) != sizeof (int))
+    {
+
+        output_printf(SYS_FD_STDERR, "ERROR: No answer from %s\n", socketpath);
+        sys_close(fd);
+
+        return EXIT_FAILURE;
+
+    }
+
+    sys_close(fd);
+
+    return status;
+
+}
+
+static int command_cache(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 2 && !strcmp(argv[0], "build"))
+    {
+
+        char path[4096];
+
+        if (!cachedir)
+        {
+
+            output_printf(query->err, "ERROR: Cache is disabled\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+        if (!cachepath(path, 4096, cachedir, argc - 1, argv + 1))
+        {
+
+            output_printf(query->err, "ERROR: Could not create cache path for index file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+        buildindex(query->index, argc - 1, argv + 1);
+
+        if (!query->index->nentries)
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+        if (!savecache(query->index, cachedir, path))
+        {
+
+            output_printf(query->err, "ERROR: Could not write cache %s\n", path);
+
+            return EXIT_FAILURE;
+
+        }
+
+        output_printf(query->out, "%s\n", path);
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "cache build <index-file>...\n\n");
+        output_printf(query->out, "Build the cache for the index files\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static void *sizethread(void *arg)
+{
+
+    struct sizer *sizer = arg;
+    unsigned int *stamps = allocarray(sizer->ncomponents, sizeof (unsigned int));
+    unsigned int *stack = allocarray(sizer->ncomponents, sizeof (unsigned int));
+    unsigned int start;
+
+    while ((start = __atomic_fetch_add(&sizer->next, SIZE_CHUNK, __ATOMIC_RELAXED)) < sizer->nitems)
+    {
+
+        unsigned int end = (start + SIZE_CHUNK < sizer->nitems) ? start + SIZE_CHUNK : sizer->nitems;
+        unsigned int item;
+
+        for (item = start; item < end; item++)
+        {
+
+            unsigned int component = sizer->items[item];
+            unsigned int nstack = 0;
+            unsigned int count = 0;
+            unsigned long size = 0;
+            unsigned long isize = 0;
+
+            stamps[component] = component + 1;
+            stack[nstack++] = component;
+
+            while (nstack)
+            {
+
+                unsigned int current = stack[--nstack];
+                unsigned int i;
+
+                count += sizer->counts[current];
+                size += sizer->sizes[current];
+                isize += sizer->isizes[current];
+
+                for (i = sizer->offsets[current]; i < sizer->offsets[current + 1]; i++)
+                {
+
+                    unsigned int target = sizer->targets[i];
+
+                    if (stamps[target] == component + 1)
+                        continue;
+
+                    stamps[target] = component + 1;
+                    stack[nstack++] = target;
+
+                }
+
+            }
+
+            sizer->closures[component] = count;
+            sizer->totals[component] = size;
+            sizer->itotals[component] = isize;
+
+        }
+
+    }
+
+    free(stamps);
+    free(stack);
+
+    return 0;
+
+}
+
+static void runsizer(struct sizer *sizer)
+{
+
+    pthread_t threads[MAX_JOBS];
+    unsigned int nthreads = (jobs < sizer->nitems / SIZE_CHUNK + 1) ? jobs : sizer->nitems / SIZE_CHUNK + 1;
+    unsigned int i;
+
+    if (nthreads > MAX_JOBS)
+        nthreads = MAX_JOBS;
+
+    sizer->next = 0;
+
+    for (i = 1; i < nthreads; i++)
+    {
+
+        if (pthread_create(&threads[i], 0, sizethread, sizer))
+            break;
+
+    }
+
+    nthreads = i;
+
+    sizethread(sizer);
+
+    for (i = 1; i < nthreads; i++)
+        pthread_join(threads[i], 0);
+
+}
+
+static void computeclosures(struct index *index, unsigned int fields, struct closure *closures)
+{
+
+    unsigned int *offsets = allocarray(index->nentries + 1, sizeof (unsigned int));
+    unsigned int *targets = allocarray(index->ngroups + 1, sizeof (unsigned int));
+    unsigned int *components = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned int *order = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned int *last;
+    struct sizer sizer;
+    unsigned int start;
+    unsigned int i;
+
+    for (i = 0; i < index->nentries; i++)
+    {
+
+        unsigned int group;
+
+        offsets[i + 1] = offsets[i];
+
+        for (group = index->nodes[i]; group < index->nodes[i + 1]; group++)
+        {
+
+            unsigned int j;
+
+            if (!(index->groups[group].field & fields))
+                continue;
+
+            for (j = index->groups[group].start; j < index->groups[group + 1].start; j++)
+            {
+
+                if (index->alternatives[j].target)
+                {
+
+                    targets[offsets[i + 1]] = index->alternatives[j].target - 1;
+                    offsets[i + 1]++;
+
+                    break;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    sizer.ncomponents = findcomponents(index->nentries, offsets, targets, components, order);
+    sizer.offsets = allocarray(sizer.ncomponents + 1, sizeof (unsigned int));
+    sizer.targets = allocarray(offsets[index->nentries] + 1, sizeof (unsigned int));
+    sizer.counts = allocarray(sizer.ncomponents, sizeof (unsigned int));
+    sizer.sizes = allocarray(sizer.ncomponents, sizeof (unsigned long));
+    sizer.isizes = allocarray(sizer.ncomponents, sizeof (unsigned long));
+    sizer.closures = allocarray(sizer.ncomponents, sizeof (unsigned int));
+    sizer.totals = allocarray(sizer.ncomponents, sizeof (unsigned long));
+    sizer.itotals = allocarray(sizer.ncomponents, sizeof (unsigned long));
+    sizer.items = allocarray(sizer.ncomponents, sizeof (unsigned int));
+    sizer.nitems = 0;
+    last = allocarray(sizer.ncomponents, sizeof (unsigned int));
+
+    for (start = 0; start < index->nentries; )
+    {
+
+        unsigned int component = components[order[start]];
+        unsigned int end;
+
+        sizer.offsets[component + 1] = sizer.offsets[component];
+
+        for (end = start; end < index->nentries && components[order[end]] == component; end++)
+        {
+
+            struct entry *entry = &index->entries[order[end]];
+            unsigned int j;
+
+            sizer.counts[component]++;
+            sizer.sizes[component] += entry->size;
+            sizer.isizes[component] += entry->isize;
+
+            for (j = offsets[order[end]]; j < offsets[order[end] + 1]; j++)
+            {
+
+                unsigned int target = components[targets[j]];
+
+                if (target == component || last[target] == component + 1)
+                    continue;
+
+                last[target] = component + 1;
+                sizer.targets[sizer.offsets[component + 1]] = target;
+                sizer.offsets[component + 1]++;
+
+            }
+
+        }
+
+        if (sizer.offsets[component + 1] - sizer.offsets[component] > 1)
+        {
+
+            sizer.items[sizer.nitems] = component;
+            sizer.nitems++;
+
+        }
+
+        start = end;
+
+    }
+
+    runsizer(&sizer);
+
+    for (i = 0; i < sizer.ncomponents; i++)
+    {
+
+        unsigned int degree = sizer.offsets[i + 1] - sizer.offsets[i];
+
+        if (degree > 1)
+            continue;
+
+        sizer.closures[i] = sizer.counts[i];
+        sizer.totals[i] = sizer.sizes[i];
+        sizer.itotals[i] = sizer.isizes[i];
+
+        if (degree)
+        {
+
+            unsigned int target = sizer.targets[sizer.offsets[i]];
+
+            sizer.closures[i] += sizer.closures[target];
+            sizer.totals[i] += sizer.totals[target];
+            sizer.itotals[i] += sizer.itotals[target];
+
+        }
+
+    }
+
+    for (i = 0; i < index->nentries; i++)
+    {
+
+        closures[i].entry = i;
+        closures[i].count = sizer.closures[components[i]];
+        closures[i].size = sizer.totals[components[i]];
+        closures[i].isize = sizer.itotals[components[i]];
+
+    }
+
+    free(offsets);
+    free(targets);
+    free(components);
+    free(order);
+    free(last);
+    free(sizer.offsets);
+    free(sizer.targets);
+    free(sizer.counts);
+    free(sizer.sizes);
+    free(sizer.isizes);
+    free(sizer.closures);
+    free(sizer.totals);
+    free(sizer.itotals);
+    free(sizer.items);
+
+}
+
+static int compareclosures(const void *a, const void *b)
+{
+
+    const struct closure *x = a;
+    const struct closure *y = b;
+
+    if (x->isize != y->isize)
+        return (x->isize < y->isize) ? 1 : -1;
+
+    if (x->size != y->size)
+        return (x->size < y->size) ? 1 : -1;
+
+    return (x->entry > y->entry) - (x->entry < y->entry);
+
+}
+
+static int command_closuresize(struct query *query, int argc, char **argv)
+{
+
+    unsigned int top = 10;
+    unsigned int tsv = 0;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--top")))
+        {
+
+            if (!getnumber(value, &top))
+            {
+
+                output_printf(query->err, "ERROR: Invalid number %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else if (!strcmp(argv[0], "--tsv"))
+        {
+
+            tsv = 1;
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 1)
+    {
+
+        unsigned int nentries = loadindex(query, argc, argv);
+
+        if (nentries)
+        {
+
+            struct closure *closures = allocarray(nentries, sizeof (struct closure));
+            unsigned int i;
+
+            computeclosures(query->index, FIELD_PREDEPENDS | FIELD_DEPENDS, closures);
+
+            if (tsv)
+            {
+
+                output_printf(query->out, "Package\tArchitecture\tVersion\tPackages\tSize\tInstalled-Size\n");
+
+                for (i = 0; i < nentries; i++)
+                {
+
+                    dprintentry(query->index, query->out, "%n\t%a\t%v\t", &query->index->entries[i]);
+                    output_printf(query->out, "%u\t%lu\t%lu\n", closures[i].count, closures[i].size, closures[i].isize);
+
+                }
+
+            }
+
+            else
+            {
+
+                qsort(closures, nentries, sizeof (struct closure), compareclosures);
+
+                for (i = 0; i < nentries && i < top; i++)
+                {
+
+                    dprintentry(query->index, query->out, (i) ? "\n%A\n" : "%A\n", &query->index->entries[closures[i].entry]);
+                    output_printf(query->out, "Packages: %u\n", closures[i].count);
+                    output_printf(query->out, "Size: %lu\n", closures[i].size);
+                    output_printf(query->out, "Installed-Size: %lu\n", closures[i].isize);
+
+                }
+
+            }
+
+            free(closures);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "closure-size [--top=<n>] [--tsv] <index-file>...\n\n");
+        output_printf(query->out, "Show the packages with the largest total size including everything they depend on\n");
+        output_printf(query->out, "Dependencies follow the first available alternative, --tsv shows every package as tab separated values\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_compare(struct query *query, int argc, char **argv)
+{
+
+    if (argc == 3)
+    {
+
+        unsigned int relation = getrelation(argv[1], strlen(argv[1]));
+
+        if (relation)
+        {
+
+            unsigned int valid = checkrelation(relation, version_compare(argv[0], strlen(argv[0]), argv[2], strlen(argv[2])));
+
+            output_printf(query->out, "%s %s %s [%s]\n", argv[0], argv[1], argv[2], valid == COMPARE_VALID ? "OK" : "NOT OK");
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown comparison operator %s\n", argv[1]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "compare <v1> <op> <v2>\n\n");
+        output_printf(query->out, "Compare the two debian version strings <v1> and <v2> using the comparison operator <op>\n");
+        output_printf(query->out, "  v1: [epoch:]upstream-version[-debian-revision]\n");
+        output_printf(query->out, "  v2: [epoch:]upstream-version[-debian-revision]\n");
+        output_printf(query->out, "  op: One of =, <<, >>, <=, >=\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static void printcycles(struct index *index, unsigned int fd, unsigned int fields)
+{
+
+    unsigned int *offsets = allocarray(index->nentries + 1, sizeof (unsigned int));
+    unsigned int *targets = allocarray(index->ncandidates + 1, sizeof (unsigned int));
+    unsigned int *components = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned int *order = allocarray(index->nentries, sizeof (unsigned int));
+    unsigned int ncycles = 0;
+    unsigned int start;
+    unsigned int i;
+
+    for (i = 0; i < index->nentries; i++)
+    {
+
+        unsigned int group;
+
+        offsets[i + 1] = offsets[i];
+
+        for (group = index->nodes[i]; group < index->nodes[i + 1]; group++)
+        {
+
+            unsigned int j;
+
+            if (!(index->groups[group].field & fields))
+                continue;
+
+            for (j = index->alternatives[index->groups[group].start].start; j < index->alternatives[index->groups[group + 1].start].start; j++)
+            {
+
+                targets[offsets[i + 1]] = index->candidates[j];
+                offsets[i + 1]++;
+
+            }
+
+        }
+
+    }
+
+    findcomponents(index->nentries, offsets, targets, components, order);
+
+    for (start = 0; start < index->nentries; )
+    {
+
+        unsigned int component = components[order[start]];
+        unsigned int end;
+        unsigned int closed = 0;
+
+        for (end = start; end < index->nentries && components[order[end]] == component; end++)
+        {
+
+            unsigned int j;
+
+            for (j = offsets[order[end]]; j < offsets[order[end] + 1]; j++)
+            {
+
+                if (components[targets[j]] == component)
+                    closed++;
+
+            }
+
+        }
+
+        if (end - start > 1 || closed)
+        {
+
+            output_printf(fd, "%sCycle: %u\n", (ncycles) ? "\n" : "", ncycles + 1);
+            output_printf(fd, "Packages:\n");
+
+            for (i = start; i < end; i++)
+                dprintentry(index, fd, " %A\n", &index->entries[order[i]]);
+
+            output_printf(fd, "Edges:\n");
+
+            for (i = start; i < end; i++)
+            {
+
+                unsigned int group;
+
+                for (group = index->nodes[order[i]]; group < index->nodes[order[i] + 1]; group++)
+                {
+
+                    unsigned int j;
+
+                    if (!(index->groups[group].field & fields))
+                        continue;
+
+                    for (j = index->alternatives[index->groups[group].start].start; j < index->alternatives[index->groups[group + 1].start].start; j++)
+                    {
+
+                        unsigned int target = index->candidates[j];
+
+                        if (components[target] != component)
+                            continue;
+
+                        dprintentry(index, fd, " %A ", &index->entries[order[i]]);
+                        output_printf(fd, (index->groups[group].field == FIELD_PREDEPENDS) ? "pre-depends on " : "depends on ");
+                        dprintentry(index, fd, "%A\n", &index->entries[target]);
+
+                    }
+
+                }
+
+            }
+
+            ncycles++;
+
+        }
+
+        start = end;
+
+    }
+
+    free(offsets);
+    free(targets);
+    free(components);
+    free(order);
+
+}
+
+static int command_cycles(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 1)
+    {
+
+        unsigned int nentries = loadindex(query, argc, argv);
+
+        if (nentries)
+        {
+
+            printcycles(query->index, query->out, FIELD_PREDEPENDS | FIELD_DEPENDS);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "cycles <index-file>...\n\n");
+        output_printf(query->out, "Show every group of packages that depend on each other through Pre-Depends and Depends\n");
+        output_printf(query->out, "Each cycle lists its packages and the dependencies that close it\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_depends(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            unsigned int offset;
+            unsigned int length;
+
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct entry *entry = findmatch(query->index, argv[0] + offset, length);
+
+                if (entry)
+                {
+
+                    struct index *index = query->index;
+                    unsigned int node = entry - index->entries;
+                    unsigned int group;
+
+                    for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
+                    {
+
+                        struct vstring vstring;
+
+                        if (index->groups[group].field != FIELD_DEPENDS)
+                            continue;
+
+                        edge_vstring(index, &index->edges[index->groups[group].start], &vstring);
+                        dprintvstring(query->out, "%A\n", &vstring);
+
+                    }
+
+                }
+
+                else
+                {
+
+                    output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+
+                    return EXIT_FAILURE;
+
+                }
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "depends <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show dependencies of packages that matches the package expression\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static unsigned int checker_take(struct checker *checker, unsigned int slot, unsigned int *item)
+{
+
+    struct range *own = &checker->ranges[slot];
+    unsigned int i;
+
+    pthread_mutex_lock(&own->lock);
+
+    if (own->next < own->end)
+    {
+
+        *item = own->next++;
+
+        pthread_mutex_unlock(&own->lock);
+
+        return 1;
+
+    }
+
+    pthread_mutex_unlock(&own->lock);
+
+    for (i = 1; i < checker->nranges; i++)
+    {
+
+        struct range *victim = &checker->ranges[(slot + i) % checker->nranges];
+        unsigned int start;
+        unsigned int end;
+
+        pthread_mutex_lock(&victim->lock);
+
+        start = victim->next + (victim->end - victim->next) / 2;
+        end = victim->end;
+
+        if (start < end)
+            victim->end = start;
+
+        pthread_mutex_unlock(&victim->lock);
+
+        if (start < end)
+        {
+
+            pthread_mutex_lock(&own->lock);
+
+            own->next = start + 1;
+            own->end = end;
+
+            pthread_mutex_unlock(&own->lock);
+
+            *item = start;
+
+            return 1;
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+static void *checkthread(void *arg)
+{
+
+    struct checker *checker = arg;
+    unsigned int slot = __atomic_fetch_add(&checker->nworkers, 1, __ATOMIC_SEQ_CST);
+    struct query query;
+    struct solver solver;
+    unsigned int item;
+
+    query_init(&query, checker->index);
+    query_reset(&query);
+    solver_init(&solver, &query, FIELD_PREDEPENDS | FIELD_DEPENDS, 1);
+    solver.strict = 1;
+
+    while (checker_take(checker, slot, &item))
+    {
+
+        unsigned int i;
+
+        if (__atomic_load_n(&checker->installable[checker->items[item]], __ATOMIC_RELAXED))
+            continue;
+
+        solver_clear(&solver);
+
+        solver.roots[0] = checker->items[item];
+        solver.nroots = 1;
+        checker->failed[item] = !solve(&solver);
+
+        if (checker->failed[item])
+            continue;
+
+        for (i = 0; i < query.nmatched; i++)
+            __atomic_store_n(&checker->installable[query.matched[i]], 1, __ATOMIC_RELAXED);
+
+    }
+
+    solver_destroy(&solver);
+    free(query.matched);
+    free(query.visited);
+
+    return 0;
+
+}
+
+static void runchecker(struct checker *checker)
+{
+
+    pthread_t threads[MAX_JOBS];
+    unsigned int nthreads = (jobs < checker->nitems) ? jobs : checker->nitems;
+    unsigned int i;
+
+    if (nthreads > MAX_JOBS)
+        nthreads = MAX_JOBS;
+
+    if (!nthreads)
+        nthreads = 1;
+
+    checker->nranges = nthreads;
+    checker->nworkers = 0;
+
+    for (i = 0; i < nthreads; i++)
+    {
+
+        pthread_mutex_init(&checker->ranges[i].lock, 0);
+
+        checker->ranges[i].next = (unsigned long)checker->nitems * i / nthreads;
+        checker->ranges[i].end = (unsigned long)checker->nitems * (i + 1) / nthreads;
+
+    }
+
+    for (i = 1; i < nthreads; i++)
+    {
+
+        if (pthread_create(&threads[i], 0, checkthread, checker))
+            break;
+
+    }
+
+    nthreads = i;
+
+    checkthread(checker);
+
+    for (i = 1; i < nthreads; i++)
+        pthread_join(threads[i], 0);
+
+    for (i = 0; i < checker->nranges; i++)
+        pthread_mutex_destroy(&checker->ranges[i].lock);
+
+}
+
+static int command_distcheck(struct query *query, int argc, char **argv)
+{
+
+    char *packages = 0;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--packages")))
+        {
+
+            packages = value;
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 1)
+    {
+
+        unsigned int nentries = loadindex(query, argc, argv);
+
+        if (nentries)
+        {
+
+            struct checker checker;
+            struct solver solver;
+            unsigned int nfailed = 0;
+            unsigned int i;
+
+            checker.index = query->index;
+            checker.items = allocarray(nentries, sizeof (unsigned int));
+            checker.nitems = 0;
+            checker.failed = allocarray(nentries, sizeof (unsigned char));
+            checker.installable = allocarray(nentries, sizeof (unsigned char));
+
+            if (packages)
+            {
+
+                unsigned int offset;
+                unsigned int length;
+
+                for (offset = 0; (length = eachcomma(packages, strlen(packages) + 1, offset)); offset += length)
+                {
+
+                    struct entry *entry = findmatch(query->index, packages + offset, length);
+
+                    if (!entry)
+                    {
+
+                        output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, packages + offset);
+                        free(checker.items);
+                        free(checker.failed);
+                        free(checker.installable);
+
+                        return EXIT_FAILURE;
+
+                    }
+
+                    if (checker.nitems < nentries)
+                    {
+
+                        checker.items[checker.nitems] = entry - query->index->entries;
+                        checker.nitems++;
+
+                    }
+
+                }
+
+            }
+
+            else
+            {
+
+                for (i = 0; i < nentries; i++)
+                    checker.items[i] = i;
+
+                checker.nitems = nentries;
+
+            }
+
+            runchecker(&checker);
+            query_reset(query);
+            solver_init(&solver, query, FIELD_PREDEPENDS | FIELD_DEPENDS, 1);
+            solver.strict = 1;
+
+            for (i = 0; i < checker.nitems; i++)
+            {
+
+                if (!checker.failed[i])
+                    continue;
+
+                solver_clear(&solver);
+
+                solver.roots[0] = checker.items[i];
+                solver.nroots = 1;
+
+                solve(&solver);
+                dprintentry(query->index, query->out, "%A is not installable\n", &query->index->entries[checker.items[i]]);
+                solver_explain(&solver, query->out);
+
+                nfailed++;
+
+            }
+
+            solver_clear(&solver);
+            solver_destroy(&solver);
+            free(checker.items);
+            free(checker.failed);
+            free(checker.installable);
+
+            if (nfailed)
+                return EXIT_FAILURE;
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "distcheck [--packages=<package-expression>] <index-file>...\n\n");
+        output_printf(query->out, "Check that every package, or every package that matches the package expression, can be resolved\n");
+        output_printf(query->out, "Packages that can not be installed are shown with the dependency chain that fails\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static unsigned int intersect(unsigned int *idoms, unsigned int *numbers, unsigned int a, unsigned int b)
+{
+
+    while (a != b)
+    {
+
+        while (numbers[a] < numbers[b])
+            a = idoms[a];
+
+        while (numbers[b] < numbers[a])
+            b = idoms[b];
+
+    }
+
+    return a;
+
+}
+
+static void printdominators(struct query *query, struct solver *solver)
+{
+
+    struct index *index = query->index;
+    unsigned int count = query->nmatched;
+    unsigned int root = count;
+    unsigned int *offsets = allocarray(count + 2, sizeof (unsigned int));
+    unsigned int *edges = solver_graph(solver, 1, offsets);
+    unsigned int *targets = allocarray(offsets[count] + solver->nroots + 1, sizeof (unsigned int));
+    unsigned int *roffsets = allocarray(count + 2, sizeof (unsigned int));
+    unsigned int *sources = allocarray(offsets[count] + solver->nroots + 1, sizeof (unsigned int));
+    unsigned int *coffsets = allocarray(count + 2, sizeof (unsigned int));
+    unsigned int *children = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *numbers = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *postorder = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *idoms = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *stack = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *next = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *depths = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *packages = allocarray(count + 1, sizeof (unsigned int));
+    unsigned long *isizes = allocarray(count + 1, sizeof (unsigned long));
+    unsigned int nnumbers = 0;
+    unsigned int nstack = 0;
+    unsigned int changed = 1;
+    unsigned int i;
+
+    if (offsets[count])
+        memcpy(targets, edges, offsets[count] * sizeof (unsigned int));
+
+    for (i = 0; i < solver->nroots; i++)
+        targets[offsets[count] + i] = solver->positions[solver->roots[i]];
+
+    offsets[count + 1] = offsets[count] + solver->nroots;
+
+    reversegraph(count + 1, offsets, targets, roffsets, sources);
+
+    for (i = 0; i <= count; i++)
+        next[i] = offsets[i];
+
+    numbers[root] = 1;
+    stack[nstack++] = root;
+
+    while (nstack)
+    {
+
+        unsigned int v = stack[nstack - 1];
+
+        if (next[v] < offsets[v + 1])
+        {
+
+            unsigned int w = targets[next[v]++];
+
+            if (!numbers[w])
+            {
+
+                numbers[w] = 1;
+                stack[nstack++] = w;
+
+            }
+
+            continue;
+
+        }
+
+        nstack--;
+        postorder[nnumbers++] = v;
+        numbers[v] = nnumbers;
+
+    }
+
+    for (i = 0; i <= count; i++)
+        idoms[i] = count + 1;
+
+    idoms[root] = root;
+
+    while (changed)
+    {
+
+        changed = 0;
+
+        for (i = nnumbers - 1; i > 0; i--)
+        {
+
+            unsigned int v = postorder[i - 1];
+            unsigned int idom = count + 1;
+            unsigned int j;
+
+            for (j = roffsets[v]; j < roffsets[v + 1]; j++)
+            {
+
+                unsigned int p = sources[j];
+
+                if (idoms[p] > count)
+                    continue;
+
+                idom = (idom > count) ? p : intersect(idoms, numbers, p, idom);
+
+            }
+
+            if (idoms[v] != idom)
+            {
+
+                idoms[v] = idom;
+                changed = 1;
+
+            }
+
+        }
+
+    }
+
+    for (i = 0; i + 1 < nnumbers; i++)
+    {
+
+        unsigned int v = postorder[i];
+
+        packages[v]++;
+        isizes[v] += index->entries[query->matched[v]].isize;
+        packages[idoms[v]] += packages[v];
+        isizes[idoms[v]] += isizes[v];
+        coffsets[idoms[v] + 1]++;
+
+    }
+
+    for (i = 0; i <= count; i++)
+    {
+
+        coffsets[i + 1] += coffsets[i];
+        next[i] = coffsets[i];
+
+    }
+
+    for (i = nnumbers - 1; i > 0; i--)
+    {
+
+        unsigned int v = postorder[i - 1];
+
+        children[next[idoms[v]]++] = v;
+
+    }
+
+    nstack = 0;
+
+    for (i = coffsets[root + 1]; i > coffsets[root]; i--)
+        stack[nstack++] = children[i - 1];
+
+    while (nstack)
+    {
+
+        unsigned int v = stack[--nstack];
+
+        output_printf(query->out, "%*s", depths[v] * 2, "");
+        dprintentry(index, query->out, "%A", &index->entries[query->matched[v]]);
+        output_printf(query->out, " - Packages: %u, Installed-Size: %lu\n", packages[v], isizes[v]);
+
+        for (i = coffsets[v + 1]; i > coffsets[v]; i--)
+        {
+
+            depths[children[i - 1]] = depths[v] + 1;
+            stack[nstack++] = children[i - 1];
+
+        }
+
+    }
+
+    free(offsets);
+    free(edges);
+    free(targets);
+    free(roffsets);
+    free(sources);
+    free(coffsets);
+    free(children);
+    free(numbers);
+    free(postorder);
+    free(idoms);
+    free(stack);
+    free(next);
+    free(depths);
+    free(packages);
+    free(isizes);
+
+}
+
+static int command_dominators(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            struct solver solver;
+
+            query_reset(query);
+            solver_init(&solver, query, FIELD_PREDEPENDS | FIELD_DEPENDS, strlen(argv[0]) + 1);
+
+            if (!solver_addroots(&solver, argv[0]))
+            {
+
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            if (!solve(&solver))
+            {
+
+                output_printf(query->err, "ERROR: Could not resolve the dependencies\n");
+                solver_explain(&solver, query->err);
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            solver_warn(&solver);
+            printdominators(query, &solver);
+            solver_destroy(&solver);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "dominators <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Resolve packages that matches the package expression and show which packages each package pulls in on its own\n");
+        output_printf(query->out, "Every package is followed by the packages that would no longer be needed without it\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_list(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 1)
+    {
+
+        unsigned int nentries = loadindex(query, argc, argv);
+
+        if (nentries)
+        {
+
+            unsigned int i;
+
+            for (i = 0; i < nentries; i++)
+            {
+
+                struct entry *current = &query->index->entries[i];
+
+                dprintentry(query->index, query->out, "%A\n", current);
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "list <index-file>...\n\n");
+        output_printf(query->out, "List all packages\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static void printplan(struct query *query, struct solver *solver)
+{
+
+    struct index *index = query->index;
+    unsigned int count = query->nmatched;
+    unsigned int *offsets = allocarray(count + 1, sizeof (unsigned int));
+    unsigned int *targets = solver_graph(solver, 0, offsets);
+    unsigned int *components = allocarray(count, sizeof (unsigned int));
+    unsigned int *order = allocarray(count, sizeof (unsigned int));
+    unsigned int *waves;
+    unsigned int ncomponents;
+    unsigned int nwaves = 0;
+    unsigned int wave;
+    unsigned int i;
+
+    ncomponents = findcomponents(count, offsets, targets, components, order);
+    waves = allocarray(ncomponents, sizeof (unsigned int));
+
+    for (i = 0; i < count; i++)
+    {
+
+        unsigned int v = order[i];
+        unsigned int j;
+
+        for (j = offsets[v]; j < offsets[v + 1]; j++)
+        {
+
+            unsigned int w = targets[j];
+
+            if (components[w] != components[v] && waves[components[v]] < waves[components[w]] + 1)
+                waves[components[v]] = waves[components[w]] + 1;
+
+        }
+
+        if (nwaves < waves[components[v]] + 1)
+            nwaves = waves[components[v]] + 1;
+
+    }
+
+    for (wave = 0; wave < nwaves; wave++)
+    {
+
+        unsigned long size = 0;
+        unsigned long isize = 0;
+
+        for (i = 0; i < count; i++)
+        {
+
+            struct entry *entry = &index->entries[query->matched[order[i]]];
+
+            if (waves[components[order[i]]] != wave)
+                continue;
+
+            size += entry->size;
+            isize += entry->isize;
+
+        }
+
+        output_printf(query->out, "%sWave: %u\n", (wave) ? "\n" : "", wave + 1);
+        output_printf(query->out, "Size: %lu\n", size);
+        output_printf(query->out, "Installed-Size: %lu\n", isize);
+
+        for (i = 0; i < count; i++)
+        {
+
+            if (waves[components[order[i]]] == wave)
+                dprintentry(index, query->out, " %A\n", &index->entries[query->matched[order[i]]]);
+
+        }
+
+    }
+
+    free(offsets);
+    free(targets);
+    free(components);
+    free(order);
+    free(waves);
+
+}
+
+static int command_plan(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            struct solver solver;
+
+            query_reset(query);
+            solver_init(&solver, query, FIELD_PREDEPENDS | FIELD_DEPENDS, strlen(argv[0]) + 1);
+
+            if (!solver_addroots(&solver, argv[0]))
+            {
+
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            if (!solve(&solver))
+            {
+
+                output_printf(query->err, "ERROR: Could not resolve the dependencies\n");
+                solver_explain(&solver, query->err);
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            solver_warn(&solver);
+            printplan(query, &solver);
+            solver_destroy(&solver);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "plan <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Resolve packages that matches the package expression and show them in install order\n");
+        output_printf(query->out, "Packages are grouped in waves that only depend on earlier waves, packages that depend on each other share a wave\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_raw(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            unsigned int offset;
+            unsigned int length;
+
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct entry *entry = findmatch(query->index, argv[0] + offset, length);
+
+                if (entry)
+                {
+
+                    output_write(query->out, entry_base(query->index, entry) + entry->offset, entry->count);
+
+                }
+
+                else
+                {
+
+                    output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+
+                    return EXIT_FAILURE;
+
+                }
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "raw <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show raw data of packages that matches the package expression\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_rdepends(struct query *query, int argc, char **argv)
+{
+
+    unsigned int fields = FIELD_DEPENDS;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--fields")))
+        {
+
+            fields = getfields(value, strlen(value));
+
+            if (!fields)
+            {
+
+                output_printf(query->err, "ERROR: Unknown field in %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            unsigned int offset;
+            unsigned int length;
+
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct entry *entry = findmatch(query->index, argv[0] + offset, length);
+
+                if (entry)
+                {
+
+                    struct index *index = query->index;
+                    unsigned int node = entry - index->entries;
+                    unsigned int i;
+
+                    for (i = index->rnodes[node]; i < index->rnodes[node + 1]; i++)
+                    {
+
+                        struct edge *current = &index->edges[index->rdeps[i]];
+
+                        if (current->field & fields)
+                            dprintentry(index, query->out, "%A\n", &index->entries[current->entry - 1]);
+
+                    }
+
+                }
+
+                else
+                {
+
+                    output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+
+                    return EXIT_FAILURE;
 
                 }
 
-                else if (!memcmp(buffer + offset2, "Installed-Size: ", 16))
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "rdepends [--fields=<field>,...] <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show packages having dependencies that matches the package expression\n");
+        output_printf(query->out, "  field: One of Pre-Depends, Depends, Recommends, Suggests, Conflicts, Breaks (default Depends)\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_resolve(struct query *query, int argc, char **argv)
+{
+
+    unsigned int minimize = 0;
+    unsigned int budget = MINIMIZE_BUDGET;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--minimize")))
+        {
+
+            if (!strcmp(value, "size"))
+            {
+
+                minimize = MINIMIZE_SIZE;
+
+            }
+
+            else if (!strcmp(value, "isize"))
+            {
+
+                minimize = MINIMIZE_ISIZE;
+
+            }
+
+            else
+            {
+
+                output_printf(query->err, "ERROR: Unknown cost %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else if ((value = getoption(argv[0], "--budget")))
+        {
+
+            if (!getnumber(value, &budget))
+            {
+
+                output_printf(query->err, "ERROR: Invalid number %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            struct solver solver;
+            unsigned int i;
+
+            query_reset(query);
+            solver_init(&solver, query, FIELD_PREDEPENDS | FIELD_DEPENDS, strlen(argv[0]) + 1);
+            solver.minimize = minimize;
+
+            if (!solver_addroots(&solver, argv[0]))
+            {
+
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            if (!solve(&solver))
+            {
+
+                output_printf(query->err, "ERROR: Could not resolve the dependencies\n");
+                solver_explain(&solver, query->err);
+                solver_destroy(&solver);
+
+                return EXIT_FAILURE;
+
+            }
+
+            solver_warn(&solver);
+
+            if (minimize && !solver_minimize(&solver, budget))
+                output_printf(query->err, "WARNING: Search stopped after %u ms, the result may not be minimal\n", budget);
+
+            for (i = query->nmatched; i > 0; i--)
+                dprintentry(query->index, query->out, "%A\n", &query->index->entries[query->matched[i - 1]]);
+
+            solver_destroy(&solver);
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "resolve [--minimize=size|isize] [--budget=<ms>] <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Recursively resolve all dependencies of packages that matches the package expression\n");
+        output_printf(query->out, "Alternatives are tried in order and packages that conflict with or break each other are never combined\n");
+        output_printf(query->out, "With --minimize the alternatives are chosen to make the total Size or Installed-Size as small as possible within the time budget\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static void *walkthread(void *arg)
+{
+
+    struct walker *walker = arg;
+    struct index *index = walker->index;
+    struct frontier *frontier = &walker->frontiers[__atomic_fetch_add(&walker->nworkers, 1, __ATOMIC_SEQ_CST)];
+    unsigned int start;
+
+    while ((start = __atomic_fetch_add(&walker->next, WALK_CHUNK, __ATOMIC_RELAXED)) < walker->ncurrent)
+    {
+
+        unsigned int end = (start + WALK_CHUNK < walker->ncurrent) ? start + WALK_CHUNK : walker->ncurrent;
+        unsigned int item;
+
+        for (item = start; item < end; item++)
+        {
+
+            unsigned int node = walker->current[item];
+            unsigned int i;
+
+            for (i = index->rnodes[node]; i < index->rnodes[node + 1]; i++)
+            {
+
+                struct edge *edge = &index->edges[index->rdeps[i]];
+                unsigned int source = edge->entry - 1;
+                unsigned long bit = 1UL << (source % BITS_LONG);
+
+                if (!(edge->field & walker->fields))
+                    continue;
+
+                if (__atomic_load_n(&walker->visited[source / BITS_LONG], __ATOMIC_RELAXED) & bit)
+                    continue;
+
+                if (__atomic_fetch_or(&walker->visited[source / BITS_LONG], bit, __ATOMIC_RELAXED) & bit)
+                    continue;
+
+                if (frontier->count == frontier->max)
+                    frontier->nodes = growarray(frontier->nodes, &frontier->max, sizeof (unsigned int));
+
+                frontier->nodes[frontier->count] = source;
+                frontier->count++;
+
+            }
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+static void runwalker(struct walker *walker)
+{
+
+    pthread_t threads[MAX_JOBS];
+    unsigned int nthreads = (jobs < walker->ncurrent / WALK_CHUNK + 1) ? jobs : walker->ncurrent / WALK_CHUNK + 1;
+    unsigned int i;
+
+    if (nthreads > MAX_JOBS)
+        nthreads = MAX_JOBS;
+
+    walker->next = 0;
+    walker->nworkers = 0;
+
+    for (i = 0; i < nthreads; i++)
+        walker->frontiers[i].count = 0;
+
+    for (i = 1; i < nthreads; i++)
+    {
+
+        if (pthread_create(&threads[i], 0, walkthread, walker))
+            break;
+
+    }
+
+    nthreads = i;
+
+    walkthread(walker);
+
+    for (i = 1; i < nthreads; i++)
+        pthread_join(threads[i], 0);
+
+    walker->ncurrent = 0;
+
+    for (i = 0; i < walker->nworkers; i++)
+    {
+
+        if (!walker->frontiers[i].count)
+            continue;
+
+        memcpy(walker->current + walker->ncurrent, walker->frontiers[i].nodes, walker->frontiers[i].count * sizeof (unsigned int));
+
+        walker->ncurrent += walker->frontiers[i].count;
+
+    }
+
+}
+
+static int compareids(const void *a, const void *b)
+{
+
+    unsigned int x = *(const unsigned int *)a;
+    unsigned int y = *(const unsigned int *)b;
+
+    return (x > y) - (x < y);
+
+}
+
+static int command_rrdepends(struct query *query, int argc, char **argv)
+{
+
+    unsigned int fields = FIELD_PREDEPENDS | FIELD_DEPENDS;
+    unsigned int maxdepth = 0;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
+    {
+
+        char *value;
+
+        if ((value = getoption(argv[0], "--fields")))
+        {
+
+            fields = getfields(value, strlen(value));
+
+            if (!fields)
+            {
+
+                output_printf(query->err, "ERROR: Unknown field in %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else if ((value = getoption(argv[0], "--depth")))
+        {
+
+            if (!getnumber(value, &maxdepth) || !maxdepth)
+            {
+
+                output_printf(query->err, "ERROR: Invalid number %s\n", value);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    if (argc >= 2)
+    {
+
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
+
+            struct walker walker;
+            unsigned int offset;
+            unsigned int length;
+            unsigned int depth;
+            unsigned int i;
+
+            walker.index = query->index;
+            walker.fields = fields;
+            walker.visited = allocarray(nentries / BITS_LONG + 1, sizeof (unsigned long));
+            walker.current = allocarray(nentries, sizeof (unsigned int));
+            walker.ncurrent = 0;
+
+            for (i = 0; i < MAX_JOBS; i++)
+            {
+
+                walker.frontiers[i].nodes = 0;
+                walker.frontiers[i].count = 0;
+                walker.frontiers[i].max = 0;
+
+            }
+
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct entry *entry = findmatch(query->index, argv[0] + offset, length);
+                unsigned int node;
+
+                if (!entry)
                 {
 
-                    current->isize = tonumerical(buffer + offset2, length2 - 17, 10, 16);
+                    output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+                    free(walker.visited);
+                    free(walker.current);
+
+                    return EXIT_FAILURE;
 
                 }
 
+                node = entry - query->index->entries;
+
+                if (walker.visited[node / BITS_LONG] & (1UL << (node % BITS_LONG)))
+                    continue;
+
+                walker.visited[node / BITS_LONG] |= 1UL << (node % BITS_LONG);
+                walker.current[walker.ncurrent] = node;
+                walker.ncurrent++;
+
+            }
+
+            for (depth = 1; walker.ncurrent && (!maxdepth || depth <= maxdepth); depth++)
+            {
+
+                runwalker(&walker);
+
+                if (!walker.ncurrent)
+                    break;
+
+                qsort(walker.current, walker.ncurrent, sizeof (unsigned int), compareids);
+                output_printf(query->out, "%sDepth: %u\n", (depth > 1) ? "\n" : "", depth);
+
+                for (i = 0; i < walker.ncurrent; i++)
+                    dprintentry(query->index, query->out, " %A\n", &query->index->entries[walker.current[i]]);
+
             }
 
+            for (i = 0; i < MAX_JOBS; i++)
+                free(walker.frontiers[i].nodes);
+
+            free(walker.visited);
+            free(walker.current);
+
         }
 
-        sys_close(fd);
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
 
-        return nentries;
+        }
 
     }
 
-    return 0;
+    else
+    {
+
+        output_printf(query->out, "rrdepends [--fields=<field>,...] [--depth=<n>] <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show every package that depends on packages that matches the package expression, directly or through other packages\n");
+        output_printf(query->out, "Packages are grouped by the number of dependencies between them and the matched packages, up to --depth\n");
+        output_printf(query->out, "  field: One of Pre-Depends, Depends, Recommends, Suggests, Conflicts, Breaks (default Pre-Depends,Depends)\n");
+
+    }
+
+    return EXIT_SUCCESS;
 
 }
 
-static unsigned int parsefiles(int argc, char **argv, struct entry *entries, unsigned int maxentries)
+static int command_show(struct query *query, int argc, char **argv)
 {
 
-    unsigned int nentries = 0;
-    unsigned int i;
+    if (argc >= 2)
+    {
 
-    for (i = argc - 1; i < argc; i++)
-        nentries += parsefile(argv[i], entries + nentries, maxentries - nentries);
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
+
+        if (nentries)
+        {
 
-    return nentries;
+            struct entry *entry = findmatch(query->index, argv[0], strlen(argv[0]));
 
-}
+            if (entry)
+            {
+
+                char *fields[8] = {
+                    "Pre-Depends",
+                    "Depends",
+                    "Recommends",
+                    "Suggests",
+                    "Conflicts",
+                    "Replaces",
+                    "Breaks",
+                    "Provides",
+                };
+                unsigned int i;
+
+                for (i = 0; i < 8; i++)
+                {
+
+                    struct snippet field;
+
+                    if (readfield(query->index, entry, &field, fields[i]))
+                    {
+
+                        output_printf(query->out, "# %s:\n", fields[i]);
+                        dprintcsv(query->out, field.data, field.length);
+
+                    }
+
+
+                }
 
-static struct entry entries[MAX_ENTRIES];
-static struct entry *matched[MAX_ENTRIES];
+            }
+
+            else
+            {
+
+                output_printf(query->err, "ERROR: No entry with the name '%s' was found\n", argv[0]);
+
+                return EXIT_FAILURE;
+
+            }
+
+        }
+
+        else
+        {
+
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
+
+            return EXIT_FAILURE;
+
+        }
+
+    }
+
+    else
+    {
 
-static int command_compare(int argc, char **argv)
+        output_printf(query->out, "show <package> <index-file>...\n\n");
+        output_printf(query->out, "Show information about a package\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_size(struct query *query, int argc, char **argv)
 {
 
-    if (argc == 3)
+    if (argc >= 2)
     {
 
-        unsigned int relation = getrelation(argv[1], strlen(argv[1]));
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
 
-        if (relation)
+        if (nentries)
         {
 
-            unsigned int valid = compareversions(relation, argv[0], strlen(argv[0]), argv[2], strlen(argv[2]));
+            unsigned int size = 0;
+            unsigned int isize = 0;
+            unsigned int offset;
+            unsigned int length;
+
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct entry *entry = findmatch(query->index, argv[0] + offset, length);
+
+                if (entry)
+                {
+
+                    size += entry->size;
+                    isize += entry->isize;
+
+                }
+
+                else
+                {
+
+                    output_printf(query->err, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
 
-            dprintf(SYS_FD_STDOUT, "%s %s %s [%s]\n", argv[0], argv[1], argv[2], valid == COMPARE_VALID ? "OK" : "NOT OK");
+                    return EXIT_FAILURE;
+
+                }
+
+            }
+
+            output_printf(query->out, "Size: %u\n", size);
+            output_printf(query->out, "Installed-Size: %u\n", isize);
 
         }
 
         else
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: Unknown comparison operator %s\n", argv[1]);
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
 
             return EXIT_FAILURE;
 
@@ -1224,11 +6926,99 @@ static int command_compare(int argc, char **argv)
     else
     {
 
-        dprintf(SYS_FD_STDOUT, "compare <v1> <op> <v2>\n\n");
-        dprintf(SYS_FD_STDOUT, "Compare the two debian version strings <v1> and <v2> using the comparison operator <op>\n");
-        dprintf(SYS_FD_STDOUT, "  v1: [epoch:]upstream-version[-debian-revision]\n");
-        dprintf(SYS_FD_STDOUT, "  v2: [epoch:]upstream-version[-debian-revision]\n");
-        dprintf(SYS_FD_STDOUT, "  op: One of =, <<, >>, <=, >=\n");
+        output_printf(query->out, "size <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show the total size of packages that matches the package expression\n");
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int comparesortkeys(const void *a, const void *b)
+{
+
+    const struct sortkey *sortkey1 = a;
+    const struct sortkey *sortkey2 = b;
+    int c = version_comparekeys(sortkey1->key, sortkey1->length, sortkey2->key, sortkey2->length);
+
+    return (c) ? c : (int)sortkey1->id - (int)sortkey2->id;
+
+}
+
+static int command_stats(struct query *query, int argc, char **argv)
+{
+
+    struct server *server = query->server;
+
+    if (server)
+    {
+
+        pthread_mutex_lock(&server->lock);
+        output_printf(query->out, "Generation: %u\n", server->generation);
+        output_printf(query->out, "Entries: %u\n", query->index->nentries);
+        output_printf(query->out, "Reloads: %u\n", server->reloads);
+        output_printf(query->out, "Failed-Reloads: %u\n", server->failures);
+        output_printf(query->out, "Last-Reload-Time: %lu.%03lu ms\n", server->lastreload / 1000000, server->lastreload / 1000 % 1000);
+        output_printf(query->out, "Total-Reload-Time: %lu.%03lu ms\n", server->totalreload / 1000000, server->totalreload / 1000 % 1000);
+        pthread_mutex_unlock(&server->lock);
+
+    }
+
+    else
+    {
+
+        output_printf(query->err, "ERROR: Statistics are only available from a server, use aptinfo --socket=<path> stats\n");
+
+        return EXIT_FAILURE;
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
+
+static int command_vsort(struct query *query, int argc, char **argv)
+{
+
+    if (argc >= 1)
+    {
+
+        struct sortkey *sortkeys = allocarray(argc, sizeof (struct sortkey));
+        unsigned int count = 0;
+        char *keys;
+        unsigned int i;
+
+        for (i = 0; i < argc; i++)
+            count += VERSION_KEYSIZE(strlen(argv[i]));
+
+        keys = allocarray(count, 1);
+
+        for (count = 0, i = 0; i < argc; i++)
+        {
+
+            sortkeys[i].key = keys + count;
+            sortkeys[i].length = version_key(sortkeys[i].key, argv[i], strlen(argv[i]));
+            sortkeys[i].id = i;
+            count += sortkeys[i].length;
+
+        }
+
+        qsort(sortkeys, argc, sizeof (struct sortkey), comparesortkeys);
+
+        for (i = 0; i < argc; i++)
+            output_printf(query->out, "%s\n", argv[sortkeys[i].id]);
+
+        free(keys);
+        free(sortkeys);
+
+    }
+
+    else
+    {
+
+        output_printf(query->out, "vsort <version>...\n\n");
+        output_printf(query->out, "Sort the debian version strings <version> in ascending order\n");
 
     }
 
@@ -1236,13 +7026,13 @@ static int command_compare(int argc, char **argv)
 
 }
 
-static int command_depends(int argc, char **argv)
+static int command_whatprovides(struct query *query, int argc, char **argv)
 {
 
     if (argc >= 2)
     {
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+        unsigned int nentries = loadindex(query, argc - 1, argv + 1);
 
         if (nentries)
         {
@@ -1250,25 +7040,46 @@ static int command_depends(int argc, char **argv)
             unsigned int offset;
             unsigned int length;
 
-            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
-            {
+            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            {
+
+                struct vstring vstring;
+                unsigned int found = 0;
+
+                if (parsevstring(&vstring, argv[0] + offset, length))
+                {
+
+                    unsigned int relation = getrelation(vstring.relation.data, vstring.relation.length);
+                    char buffer[KEY_BUFFER];
+                    unsigned int keylength;
+                    char *key = vstring_key(&vstring, buffer, &keylength);
+                    unsigned int id;
+
+                    for (id = findvirtual(query->index, &vstring.name); id; id = query->index->provides[id - 1].next)
+                    {
+
+                        struct provide *current = &query->index->provides[id - 1];
+
+                        if (checkrelation(relation, version_comparekeys(index_key(query->index, &current->key), current->key.length, key, keylength)) == COMPARE_VALID)
+                        {
+
+                            dprintentry(query->index, query->out, "%A\n", &query->index->entries[current->entry - 1]);
 
-                struct entry *entry = findmatch(argv[0] + offset, length, entries, nentries);
+                            found++;
 
-                if (entry)
-                {
+                        }
 
-                    char fieldbuffer[FIELDBUFFER_SIZE];
-                    unsigned int count = readfield(entry, fieldbuffer, FIELDBUFFER_SIZE, "Depends");
+                    }
 
-                    dprintcsv(SYS_FD_STDOUT, fieldbuffer, count);
+                    if (key != buffer)
+                        free(key);
 
                 }
 
-                else
+                if (!found)
                 {
 
-                    dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+                    output_printf(query->err, "ERROR: No entry providing '%.*s' was found\n", length, argv[0] + offset);
 
                     return EXIT_FAILURE;
 
@@ -1281,7 +7092,7 @@ static int command_depends(int argc, char **argv)
         else
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
 
             return EXIT_FAILURE;
 
@@ -1292,8 +7103,8 @@ static int command_depends(int argc, char **argv)
     else
     {
 
-        dprintf(SYS_FD_STDOUT, "depends <package-expression> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Show dependencies of packages that matches the package expression\n");
+        output_printf(query->out, "whatprovides <package-expression> <index-file>...\n\n");
+        output_printf(query->out, "Show packages providing names that matches the package expression\n");
 
     }
 
@@ -1301,291 +7112,353 @@ static int command_depends(int argc, char **argv)
 
 }
 
-static int command_list(int argc, char **argv)
+static unsigned int findhop(struct solver *solver, unsigned int node, unsigned int target)
 {
 
-    if (argc >= 1)
+    struct index *index = solver->index;
+    unsigned int group;
+
+    for (group = index->nodes[node]; group < index->nodes[node + 1]; group++)
     {
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+        unsigned int end = solver_end(solver, group);
+        unsigned int i;
 
-        if (nentries)
+        if (!(index->groups[group].field & solver->fields))
+            continue;
+
+        for (i = solver_first(solver, group); i < end; i++)
         {
 
-            unsigned int i;
+            if (index->candidates[i] == target)
+                return group;
 
-            for (i = 0; i < nentries; i++)
-            {
+        }
 
-                struct entry *current = &entries[i];
+    }
 
-                dprintvstring(SYS_FD_STDOUT, "%A\n", &current->vstring);
+    return index->ngroups;
 
-            }
+}
 
-        }
+static void printchain(struct solver *solver, unsigned int fd, unsigned int *chain, unsigned int length)
+{
 
-        else
+    struct query *query = solver->query;
+    struct index *index = solver->index;
+    unsigned int i;
+
+    for (i = 0; i < length; i++)
+    {
+
+        unsigned int node = query->matched[chain[i]];
+
+        if (i + 1 < length)
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
+            unsigned int group = findhop(solver, node, query->matched[chain[i + 1]]);
 
-            return EXIT_FAILURE;
+            dprintentry(index, fd, "%A ", &index->entries[node]);
+            output_printf(fd, (index->groups[group].field == FIELD_PREDEPENDS) ? "pre-depends on " : "depends on ");
+            dprintgroup(index, fd, "\n", group);
 
         }
 
-    }
+        else
+        {
 
-    else
-    {
+            dprintentry(index, fd, "%A\n", &index->entries[node]);
 
-        dprintf(SYS_FD_STDOUT, "list <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "List all packages\n");
+        }
 
     }
 
-    return EXIT_SUCCESS;
-
 }
 
-static int command_raw(int argc, char **argv)
+static unsigned int shortestchain(struct solver *solver, unsigned int *offsets, unsigned int *targets, unsigned int *roffsets, unsigned int *sources, unsigned int goal, unsigned int *chain)
 {
 
-    if (argc >= 2)
-    {
-
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
-
-        if (nentries)
-        {
-
-            unsigned int offset;
-            unsigned int length;
-
-            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
-            {
+    unsigned int count = solver->query->nmatched;
+    unsigned int *fqueue = allocarray(count, sizeof (unsigned int));
+    unsigned int *bqueue = allocarray(count, sizeof (unsigned int));
+    unsigned int *fdists = allocarray(count, sizeof (unsigned int));
+    unsigned int *bdists = allocarray(count, sizeof (unsigned int));
+    unsigned int *fparents = allocarray(count, sizeof (unsigned int));
+    unsigned int *bparents = allocarray(count, sizeof (unsigned int));
+    unsigned int fstart = 0;
+    unsigned int fend = 0;
+    unsigned int bstart = 0;
+    unsigned int bend = 0;
+    unsigned int meet = count;
+    unsigned int best = 0;
+    unsigned int length = 0;
+    unsigned int i;
 
-                struct entry *entry = findmatch(argv[0] + offset, length, entries, nentries);
+    for (i = 0; i < solver->nroots; i++)
+    {
 
-                if (entry)
-                {
+        unsigned int root = solver->positions[solver->roots[i]];
 
-                    unsigned int fd = sys_open(entry->filename);
+        if (fdists[root])
+            continue;
 
-                    if (fd)
-                    {
+        fdists[root] = 1;
+        fqueue[fend++] = root;
 
-                        char buffer[FIELDBUFFER_SIZE];
-                        unsigned int count;
+    }
 
-                        sys_seek(fd, entry->offset);
+    bdists[goal] = 1;
+    bqueue[bend++] = goal;
 
-                        count = sys_read(fd, buffer, entry->count);
+    if (fdists[goal])
+        meet = goal;
 
-                        if (count)
-                        {
+    while (meet == count && fstart < fend && bstart < bend)
+    {
 
-                            unsigned int length2;
-                            unsigned int offset2;
+        unsigned int forward = (fend - fstart <= bend - bstart);
+        unsigned int *queue = (forward) ? fqueue : bqueue;
+        unsigned int *dists = (forward) ? fdists : bdists;
+        unsigned int *parents = (forward) ? fparents : bparents;
+        unsigned int *others = (forward) ? bdists : fdists;
+        unsigned int *edgeoffsets = (forward) ? offsets : roffsets;
+        unsigned int *edges = (forward) ? targets : sources;
+        unsigned int start = (forward) ? fstart : bstart;
+        unsigned int end = (forward) ? fend : bend;
+        unsigned int next = end;
+
+        for (i = start; i < end; i++)
+        {
 
-                            for (offset2 = 0; (length2 = eachnewline(buffer, count, offset2)); offset2 += length2)
-                            {
+            unsigned int v = queue[i];
+            unsigned int j;
 
-                                if (length2 == 1 && buffer[offset2] == '\n')
-                                    break;
+            for (j = edgeoffsets[v]; j < edgeoffsets[v + 1]; j++)
+            {
 
-                                dprintf(SYS_FD_STDOUT, "%.*s", length2, buffer + offset2);
+                unsigned int w = edges[j];
 
-                            }
+                if (dists[w])
+                    continue;
 
-                        }
+                dists[w] = dists[v] + 1;
+                parents[w] = v;
+                queue[next++] = w;
 
-                        sys_close(fd);
+                if (others[w] && (meet == count || fdists[w] + bdists[w] < best))
+                {
 
-                    }
+                    meet = w;
+                    best = fdists[w] + bdists[w];
 
                 }
 
-                else
-                {
-
-                    dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+            }
 
-                    return EXIT_FAILURE;
+        }
 
-                }
+        if (forward)
+        {
 
-            }
+            fstart = end;
+            fend = next;
 
         }
 
         else
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
-
-            return EXIT_FAILURE;
+            bstart = end;
+            bend = next;
 
         }
 
     }
 
-    else
+    if (meet < count)
     {
 
-        dprintf(SYS_FD_STDOUT, "raw <package-expression> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Show raw data of packages that matches the package expression\n");
+        unsigned int v;
+
+        length = fdists[meet];
+
+        for (v = meet, i = length; i > 0; i--, v = fparents[v])
+            chain[i - 1] = v;
+
+        for (v = meet; v != goal; v = bparents[v])
+            chain[length++] = bparents[v];
 
     }
 
-    return EXIT_SUCCESS;
+    free(fqueue);
+    free(bqueue);
+    free(fdists);
+    free(bdists);
+    free(fparents);
+    free(bparents);
+
+    return length;
 
 }
 
-static int command_rdepends(int argc, char **argv)
+static void printchains(struct solver *solver, unsigned int *offsets, unsigned int *targets, unsigned int *roffsets, unsigned int *sources, unsigned int goal, unsigned int k)
 {
 
-    if (argc >= 2)
+    struct query *query = solver->query;
+    unsigned int count = query->nmatched;
+    unsigned char *reaches = allocarray(count, sizeof (unsigned char));
+    unsigned int *queue = allocarray(count, sizeof (unsigned int));
+    unsigned int *pops = allocarray(count, sizeof (unsigned int));
+    unsigned int *chain = allocarray(count, sizeof (unsigned int));
+    struct step *steps = 0;
+    unsigned int nsteps = 0;
+    unsigned int maxsteps = 0;
+    unsigned int nqueue = 0;
+    unsigned int found = 0;
+    unsigned int head;
+    unsigned int i;
+
+    reaches[goal] = 1;
+    queue[nqueue++] = goal;
+
+    for (head = 0; head < nqueue; head++)
     {
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+        unsigned int j;
 
-        if (nentries)
+        for (j = roffsets[queue[head]]; j < roffsets[queue[head] + 1]; j++)
         {
 
-            unsigned int offset;
-            unsigned int length;
-
-            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            if (!reaches[sources[j]])
             {
 
-                struct entry *entry = findmatch(argv[0] + offset, length, entries, nentries);
+                reaches[sources[j]] = 1;
+                queue[nqueue++] = sources[j];
 
-                if (entry)
-                {
+            }
 
-                    unsigned int i;
+        }
 
-                    for (i = 0; i < nentries; i++)
-                    {
+    }
 
-                        struct entry *current = &entries[i];
-                        char fieldbuffer[FIELDBUFFER_SIZE];
-                        unsigned int count = readfield(current, fieldbuffer, FIELDBUFFER_SIZE, "Depends");
-                        unsigned int offset;
-                        unsigned int length;
+    for (i = 0; i < solver->nroots; i++)
+    {
 
-                        for (offset = 0; (length = eachcomma(fieldbuffer, count, offset)); offset += length)
-                        {
+        unsigned int root = solver->positions[solver->roots[i]];
 
-                            struct vstring dependency;
+        if (!reaches[root])
+            continue;
 
-                            if (parsevstring(&dependency, fieldbuffer + offset, length))
-                            {
+        if (nsteps == maxsteps)
+            steps = growarray(steps, &maxsteps, sizeof (struct step));
 
-                                if (snippet_match(&dependency.name, &entry->vstring.name))
-                                {
+        steps[nsteps].node = root;
+        steps[nsteps].parent = 0;
+        nsteps++;
 
-                                    unsigned int relation = getrelation(dependency.relation.data, dependency.relation.length);
+    }
 
-                                    if (compareversions(relation, entry->vstring.version.data, entry->vstring.version.length, dependency.version.data, dependency.version.length) == COMPARE_VALID)
-                                        dprintvstring(SYS_FD_STDOUT, "%A\n", &current->vstring);
+    for (head = 0; head < nsteps && found < k; head++)
+    {
 
-                                }
+        unsigned int v = steps[head].node;
+        unsigned int j;
 
-                            }
+        if (pops[v] >= k)
+            continue;
 
-                        }
+        pops[v]++;
 
-                    }
+        if (v == goal)
+        {
 
-                }
+            unsigned int length = 0;
+            unsigned int step;
 
-                else
-                {
+            for (step = head + 1; step; step = steps[step - 1].parent)
+                length++;
 
-                    dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+            for (step = head + 1, i = length; step; step = steps[step - 1].parent, i--)
+                chain[i - 1] = steps[step - 1].node;
 
-                    return EXIT_FAILURE;
+            if (found)
+                output_printf(query->out, "\n");
 
-                }
+            printchain(solver, query->out, chain, length);
 
-            }
+            found++;
+
+            continue;
 
         }
 
-        else
+        for (j = offsets[v]; j < offsets[v + 1]; j++)
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
+            unsigned int w = targets[j];
+            unsigned int step;
+            unsigned int l;
 
-            return EXIT_FAILURE;
+            if (!reaches[w])
+                continue;
 
-        }
+            for (l = offsets[v]; l < j && targets[l] != w; l++);
 
-    }
+            if (l < j)
+                continue;
 
-    else
-    {
+            for (step = head + 1; step && steps[step - 1].node != w; step = steps[step - 1].parent);
+
+            if (step)
+                continue;
 
-        dprintf(SYS_FD_STDOUT, "rdepends <package-expression> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Show packages having dependencies that matches the package expression\n");
+            if (nsteps == maxsteps)
+                steps = growarray(steps, &maxsteps, sizeof (struct step));
 
+            steps[nsteps].node = w;
+            steps[nsteps].parent = head + 1;
+            nsteps++;
+
+        }
 
     }
 
-    return EXIT_SUCCESS;
+    free(reaches);
+    free(queue);
+    free(pops);
+    free(chain);
+    free(steps);
 
 }
 
-static int command_resolve(int argc, char **argv)
+static int command_why(struct query *query, int argc, char **argv)
 {
 
-    if (argc >= 2)
+    unsigned int chains = 1;
+
+    for (; argc && !strncmp(argv[0], "--", 2); argc--, argv++)
     {
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+        char *value;
 
-        if (nentries)
+        if ((value = getoption(argv[0], "--chains")))
         {
 
-            unsigned int nmatched = 0;
-            unsigned int offset;
-            unsigned int length;
-            unsigned int i;
-
-            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            if (!getnumber(value, &chains) || !chains)
             {
 
-                struct entry *entry = findmatch(argv[0] + offset, length, entries, nentries);
-
-                if (entry)
-                {
-
-                    nmatched = resolve(entry, entries, nentries, "Depends", matched, MAX_ENTRIES, nmatched);
-
-                }
-
-                else
-                {
-
-                    dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
-
-                    return EXIT_FAILURE;
+                output_printf(query->err, "ERROR: Invalid number %s\n", value);
 
-                }
+                return EXIT_FAILURE;
 
             }
 
-            for (i = nmatched; i > 0; i--)
-                dprintvstring(SYS_FD_STDOUT, "%A\n", &matched[i - 1]->vstring);
-
         }
 
         else
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
+            output_printf(query->err, "ERROR: Unknown option %s\n", argv[0]);
 
             return EXIT_FAILURE;
 
@@ -1593,80 +7466,102 @@ static int command_resolve(int argc, char **argv)
 
     }
 
-    else
+    if (argc >= 3)
     {
 
-        dprintf(SYS_FD_STDOUT, "resolve <package-expression> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Recursively resolve all dependencies of packages that matches the package expression\n");
+        unsigned int nentries = loadindex(query, argc - 2, argv + 2);
 
-    }
+        if (nentries)
+        {
 
-    return EXIT_SUCCESS;
+            struct entry *entry = findmatch(query->index, argv[1], strlen(argv[1]));
+            struct solver solver;
+            unsigned int *offsets;
+            unsigned int *targets;
+            unsigned int *roffsets;
+            unsigned int *sources;
+            unsigned int goal;
 
-}
+            if (!entry)
+            {
 
-static int command_show(int argc, char **argv)
-{
+                output_printf(query->err, "ERROR: No entry with the name '%s' was found\n", argv[1]);
 
-    if (argc >= 2)
-    {
+                return EXIT_FAILURE;
+
+            }
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+            query_reset(query);
+            solver_init(&solver, query, FIELD_PREDEPENDS | FIELD_DEPENDS, strlen(argv[0]) + 1);
 
-        if (nentries)
-        {
+            if (!solver_addroots(&solver, argv[0]))
+            {
 
-            struct entry *entry = findmatch(argv[0], strlen(argv[0]), entries, nentries);
+                solver_destroy(&solver);
 
-            if (entry)
+                return EXIT_FAILURE;
+
+            }
+
+            if (!solve(&solver))
             {
 
-                char *fields[8] = {
-                    "Pre-Depends",
-                    "Depends",
-                    "Recommends",
-                    "Suggests",
-                    "Conflicts",
-                    "Replaces",
-                    "Breaks",
-                    "Provides",
-                };
-                unsigned int i;
+                output_printf(query->err, "ERROR: Could not resolve the dependencies\n");
+                solver_explain(&solver, query->err);
+                solver_destroy(&solver);
 
-                for (i = 0; i < 8; i++)
-                {
+                return EXIT_FAILURE;
+
+            }
+
+            if (!isvisited(query, entry - query->index->entries))
+            {
 
-                    char fieldbuffer[FIELDBUFFER_SIZE];
-                    unsigned int count = readfield(entry, fieldbuffer, FIELDBUFFER_SIZE, fields[i]);
+                dprintentry(query->index, query->err, "ERROR: %A is not needed by ", entry);
+                output_printf(query->err, "'%s'\n", argv[0]);
+                solver_destroy(&solver);
 
-                    if (count)
-                    {
+                return EXIT_FAILURE;
 
-                        dprintf(SYS_FD_STDOUT, "# %s:\n", fields[i]);
-                        dprintcsv(SYS_FD_STDOUT, fieldbuffer, count);
+            }
 
-                    }
+            goal = solver.positions[entry - query->index->entries];
+            offsets = allocarray(query->nmatched + 1, sizeof (unsigned int));
+            targets = solver_graph(&solver, 1, offsets);
+            roffsets = allocarray(query->nmatched + 1, sizeof (unsigned int));
+            sources = allocarray(offsets[query->nmatched] + 1, sizeof (unsigned int));
 
+            reversegraph(query->nmatched, offsets, targets, roffsets, sources);
 
-                }
+            if (chains == 1)
+            {
+
+                unsigned int *chain = allocarray(query->nmatched, sizeof (unsigned int));
+
+                printchain(&solver, query->out, chain, shortestchain(&solver, offsets, targets, roffsets, sources, goal, chain));
+                free(chain);
 
             }
 
             else
             {
 
-                dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%s' was found\n", argv[0]);
-
-                return EXIT_FAILURE;
+                printchains(&solver, offsets, targets, roffsets, sources, goal, chains);
 
             }
 
+            free(offsets);
+            free(targets);
+            free(roffsets);
+            free(sources);
+            solver_destroy(&solver);
+
         }
 
         else
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
+            output_printf(query->err, "ERROR: No entries found in package file(s)\n");
 
             return EXIT_FAILURE;
 
@@ -1677,8 +7572,9 @@ static int command_show(int argc, char **argv)
     else
     {
 
-        dprintf(SYS_FD_STDOUT, "show <package> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Show information about a package\n");
+        output_printf(query->out, "why [--chains=<k>] <package-expression> <package> <index-file>...\n\n");
+        output_printf(query->out, "Resolve packages that matches the package expression and show the shortest dependency chain that pulls in the package\n");
+        output_printf(query->out, "With --chains the k shortest distinct chains are shown\n");
 
     }
 
@@ -1686,102 +7582,123 @@ static int command_show(int argc, char **argv)
 
 }
 
-static int command_size(int argc, char **argv)
+static struct command commands[NUM_CMDS] = {
+    {"batch", command_batch, SCOPE_PROCESS},
+    {"cache", command_cache, SCOPE_PROCESS},
+    {"closure-size", command_closuresize, SCOPE_INDEX},
+    {"compare", command_compare, SCOPE_NONE},
+    {"cycles", command_cycles, SCOPE_INDEX},
+    {"depends", command_depends, SCOPE_INDEX},
+    {"distcheck", command_distcheck, SCOPE_INDEX},
+    {"dominators", command_dominators, SCOPE_INDEX},
+    {"list", command_list, SCOPE_INDEX},
+    {"plan", command_plan, SCOPE_INDEX},
+    {"raw", command_raw, SCOPE_INDEX},
+    {"rdepends", command_rdepends, SCOPE_INDEX},
+    {"resolve", command_resolve, SCOPE_INDEX},
+    {"rrdepends", command_rrdepends, SCOPE_INDEX},
+    {"serve", command_serve, SCOPE_PROCESS},
+    {"show", command_show, SCOPE_INDEX},
+    {"size", command_size, SCOPE_INDEX},
+    {"stats", command_stats, SCOPE_NONE},
+    {"vsort", command_vsort, SCOPE_NONE},
+    {"whatprovides", command_whatprovides, SCOPE_INDEX},
+    {"why", command_why, SCOPE_INDEX}
+};
+
+int main(int argc, char **argv)
 {
 
-    if (argc >= 2)
+    struct query query;
+    char *socketpath = 0;
+    unsigned int i;
+
+    if (getenv("XDG_CACHE_HOME") && snprintf(cachedirdata, 4096, "%s/aptinfo", getenv("XDG_CACHE_HOME")) < 4096)
+        cachedir = cachedirdata;
+    else if (getenv("HOME") && snprintf(cachedirdata, 4096, "%s/.cache/aptinfo", getenv("HOME")) < 4096)
+        cachedir = cachedirdata;
+
+    jobs = sys_cpus();
+
+    if (jobs > MAX_JOBS)
+        jobs = MAX_JOBS;
+
+    scan_select(SCAN_AUTO);
+
+    atexit(output_flushall);
+
+    for (; argc > 1 && argv[1][0] == '-'; argc--, argv++)
     {
 
-        unsigned int nentries = parsefiles(argc, argv, entries, MAX_ENTRIES);
+        char *value;
 
-        if (nentries)
+        if (!strncmp(argv[1], "-j", 2))
         {
 
-            unsigned int size = 0;
-            unsigned int isize = 0;
-            unsigned int offset;
-            unsigned int length;
-
-            for (offset = 0; (length = eachcomma(argv[0], strlen(argv[0]) + 1, offset)); offset += length)
+            if (!getnumber(argv[1] + 2, &jobs) || !jobs)
             {
 
-                struct entry *entry = findmatch(argv[0] + offset, length, entries, nentries);
+                output_printf(SYS_FD_STDERR, "ERROR: Invalid number of jobs %s\n", argv[1] + 2);
 
-                if (entry)
-                {
+                return EXIT_FAILURE;
 
-                    size += entry->size;
-                    isize += entry->isize;
+            }
 
-                }
+            if (jobs > MAX_JOBS)
+            {
 
-                else
-                {
+                jobs = MAX_JOBS;
 
-                    dprintf(SYS_FD_STDERR, "ERROR: No entry with the name '%.*s' was found\n", length, argv[0] + offset);
+                output_printf(SYS_FD_STDERR, "WARNING: max number of jobs reached (%u)\n", MAX_JOBS);
 
-                    return EXIT_FAILURE;
+            }
 
-                }
+        }
 
-            }
+        else if ((value = getoption(argv[1], "--cache-dir")))
+        {
 
-            dprintf(SYS_FD_STDOUT, "Size: %u\n", size);
-            dprintf(SYS_FD_STDOUT, "Installed-Size: %u\n", isize);
+            cachedir = value;
 
         }
 
-        else
+        else if (!strcmp(argv[1], "--no-cache"))
         {
 
-            dprintf(SYS_FD_STDERR, "ERROR: No entries found in package file(s)\n");
-
-            return EXIT_FAILURE;
+            cachedir = 0;
 
         }
 
-    }
-
-    else
-    {
+        else if ((value = getoption(argv[1], "--socket")))
+        {
 
-        dprintf(SYS_FD_STDOUT, "size <package-expression> <index-file>...\n\n");
-        dprintf(SYS_FD_STDOUT, "Show the total size of packages that matches the package expression\n");
+            socketpath = value;
 
-    }
+        }
 
-    return EXIT_SUCCESS;
+        else
+        {
 
-}
+            output_printf(SYS_FD_STDERR, "ERROR: Unknown option %s\n", argv[1]);
 
-int main(int argc, char **argv)
-{
+            return EXIT_FAILURE;
 
-    unsigned int i;
+        }
 
-    static struct command commands[NUM_CMDS] = {
-        {"compare", command_compare},
-        {"depends", command_depends},
-        {"list", command_list},
-        {"raw", command_raw},
-        {"rdepends", command_rdepends},
-        {"resolve", command_resolve},
-        {"show", command_show},
-        {"size", command_size}
-    };
+    }
 
     if (argc < 2)
     {
 
-        dprintf(SYS_FD_STDOUT, "aptinfo <command> [<args>]\n\n");
-        dprintf(SYS_FD_STDOUT, "commands:\n");
+        output_printf(SYS_FD_STDOUT, "aptinfo [-j<jobs>] [--cache-dir=<dir>] [--no-cache] [--socket=<path>] <command> [<args>]\n\n");
+        output_printf(SYS_FD_STDOUT, "commands:\n");
 
         for (i = 0; i < NUM_CMDS; i++)
         {
 
             struct command *command = &commands[i];
 
-            dprintf(SYS_FD_STDOUT, "  %s\n", command->name);
+            output_printf(SYS_FD_STDOUT, "  %s\n", command->name);
 
         }
 
@@ -1790,17 +7707,21 @@ int main(int argc, char **argv)
     else
     {
 
-        for (i = 0; i < NUM_CMDS; i++)
+        struct command *command = findcommand(argv[1]);
+
+        if (socketpath)
+            return runclient(socketpath, argc - 1, argv + 1);
+
+        if (command)
         {
 
-            struct command *command = &commands[i];
+            query_init(&query, &packages);
 
-            if (!strcmp(argv[1], command->name))
-                return command->handle(argc - 2, &argv[2]);
+            return command->handle(&query, argc - 2, &argv[2]);
 
         }
 
-        dprintf(SYS_FD_STDERR, "ERROR: Unknown command %s\n", argv[1]);
+        output_printf(SYS_FD_STDERR, "ERROR: Unknown command %s\n", argv[1]);
 
         return EXIT_FAILURE;
 
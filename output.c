@@ -0,0 +1,261 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "output.h"
+
+#define OUTPUT_FDS                      4096
+#define OUTPUT_SIZE                     0x10000
+#define BUFFER_UNBUFFERED               1
+#define BUFFER_BORROWED                 2
+#define BUFFER_FAILED                   4
+
+struct buffer
+{
+
+    char *data;
+    unsigned int count;
+    unsigned int link;
+    unsigned int flags;
+
+};
+
+static struct buffer buffers[OUTPUT_FDS] = {
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, SYS_FD_STDOUT, BUFFER_UNBUFFERED}
+};
+
+static struct buffer *getbuffer(unsigned int fd)
+{
+
+    struct buffer *buffer;
+
+    if (fd >= OUTPUT_FDS)
+        return 0;
+
+    buffer = &buffers[fd];
+
+    if (!buffer->data && !(buffer->flags & BUFFER_UNBUFFERED))
+        buffer->data = malloc(OUTPUT_SIZE);
+
+    return buffer;
+
+}
+
+static void writeall(unsigned int fd, struct buffer *buffer, char *data1, unsigned int count1, char *data2, unsigned int count2)
+{
+
+    if (buffer && buffer->flags & BUFFER_FAILED)
+        return;
+
+    while (count1 + count2)
+    {
+
+        int n = sys_trywritev(fd, data1, count1, data2, count2);
+
+        if (n < 0)
+        {
+
+            if (buffer && buffer->flags & BUFFER_BORROWED)
+            {
+
+                buffer->flags |= BUFFER_FAILED;
+
+                return;
+
+            }
+
+            dprintf(SYS_FD_STDERR, "Writev syscall failed (%d)\n", n);
+            exit(EXIT_FAILURE);
+
+        }
+
+        if (n < count1)
+        {
+
+            data1 += n;
+            count1 -= n;
+
+        }
+
+        else
+        {
+
+            n -= count1;
+            count1 = 0;
+            data2 += n;
+            count2 -= n;
+
+        }
+
+    }
+
+}
+
+void output_write(unsigned int fd, char *data, unsigned int count)
+{
+
+    struct buffer *buffer = getbuffer(fd);
+
+    if (!buffer || !buffer->data)
+    {
+
+        if (buffer && buffer->flags & BUFFER_UNBUFFERED)
+            output_flush(buffer->link);
+
+        writeall(fd, buffer, 0, 0, data, count);
+
+    }
+
+    else if (buffer->count + count <= OUTPUT_SIZE)
+    {
+
+        memcpy(buffer->data + buffer->count, data, count);
+
+        buffer->count += count;
+
+    }
+
+    else
+    {
+
+        writeall(fd, buffer, buffer->data, buffer->count, data, count);
+
+        buffer->count = 0;
+
+    }
+
+}
+
+void output_printf(unsigned int fd, char *fmt, ...)
+{
+
+    struct buffer *buffer = getbuffer(fd);
+    va_list args;
+    char *data;
+    int count;
+
+    if (buffer && buffer->data)
+    {
+
+        va_start(args, fmt);
+
+        count = vsnprintf(buffer->data + buffer->count, OUTPUT_SIZE - buffer->count, fmt, args);
+
+        va_end(args);
+
+        if (count < 0)
+            return;
+
+        if (count < OUTPUT_SIZE - buffer->count)
+        {
+
+            buffer->count += count;
+
+            return;
+
+        }
+
+    }
+
+    else
+    {
+
+        va_start(args, fmt);
+
+        count = vsnprintf(0, 0, fmt, args);
+
+        va_end(args);
+
+        if (count < 0)
+            return;
+
+    }
+
+    data = malloc(count + 1);
+
+    if (!data)
+    {
+
+        dprintf(SYS_FD_STDERR, "ERROR: Out of memory\n");
+        exit(EXIT_FAILURE);
+
+    }
+
+    va_start(args, fmt);
+    vsnprintf(data, count + 1, fmt, args);
+    va_end(args);
+    output_write(fd, data, count);
+    free(data);
+
+}
+
+void output_flush(unsigned int fd)
+{
+
+    if (fd < OUTPUT_FDS && buffers[fd].count)
+    {
+
+        writeall(fd, &buffers[fd], buffers[fd].data, buffers[fd].count, 0, 0);
+
+        buffers[fd].count = 0;
+
+    }
+
+}
+
+void output_flushall(void)
+{
+
+    unsigned int i;
+
+    for (i = 0; i < OUTPUT_FDS; i++)
+        output_flush(i);
+
+}
+
+unsigned int output_open(unsigned int out, unsigned int err)
+{
+
+    if (out >= OUTPUT_FDS || err >= OUTPUT_FDS)
+        return 0;
+
+    buffers[out].flags = BUFFER_BORROWED;
+    buffers[err].link = out;
+    buffers[err].flags = BUFFER_UNBUFFERED | BUFFER_BORROWED;
+
+    return 1;
+
+}
+
+void output_close(unsigned int out, unsigned int err)
+{
+
+    unsigned int fds[2];
+    unsigned int i;
+
+    output_flush(out);
+
+    fds[0] = out;
+    fds[1] = err;
+
+    for (i = 0; i < 2; i++)
+    {
+
+        if (fds[i] < OUTPUT_FDS)
+        {
+
+            free(buffers[fds[i]].data);
+
+            buffers[fds[i]].data = 0;
+            buffers[fds[i]].count = 0;
+            buffers[fds[i]].link = 0;
+            buffers[fds[i]].flags = 0;
+
+        }
+
+    }
+
+}
@@ -0,0 +1,6 @@
+void output_write(unsigned int fd, char *data, unsigned int count);
+void output_printf(unsigned int fd, char *fmt, ...);
+void output_flush(unsigned int fd);
+void output_flushall(void);
+unsigned int output_open(unsigned int out, unsigned int err);
+void output_close(unsigned int out, unsigned int err);
@@ -0,0 +1,288 @@
+#include <stdlib.h>
+#include <string.h>
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCAN_X86
+#endif
+
+#define SCAN_BLOCK                      64
+
+static unsigned long long (*scanblock)(char *data, unsigned int set);
+static unsigned int selected;
+
+static unsigned int isdelimiter(char c, unsigned int set)
+{
+
+    switch (c)
+    {
+
+    case '\n':
+    case '\0':
+        return 1;
+
+    case ',':
+        return set >= SCAN_COMMA;
+
+    case '|':
+        return set >= SCAN_PIPE;
+
+    }
+
+    return 0;
+
+}
+
+static unsigned long long scanpartial(char *data, unsigned int count, unsigned int set)
+{
+
+    unsigned long long mask = 0;
+    unsigned int i;
+
+    for (i = 0; i < count; i++)
+    {
+
+        if (isdelimiter(data[i], set))
+            mask |= 1ULL << i;
+
+    }
+
+    return mask;
+
+}
+
+static unsigned long long matchbytes(unsigned long long word, unsigned char c)
+{
+
+    unsigned long long x = word ^ (0x0101010101010101ULL * c);
+    unsigned long long t = ((x & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | x;
+
+    return ~(t | 0x7f7f7f7f7f7f7f7fULL);
+
+}
+
+static unsigned long long scanblock_scalar(char *data, unsigned int set)
+{
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    unsigned long long mask = 0;
+    unsigned int i;
+
+    for (i = 0; i < SCAN_BLOCK; i += 8)
+    {
+
+        unsigned long long word;
+        unsigned long long found;
+
+        memcpy(&word, data + i, 8);
+
+        found = matchbytes(word, '\n') | matchbytes(word, '\0');
+
+        if (set >= SCAN_COMMA)
+            found |= matchbytes(word, ',');
+
+        if (set >= SCAN_PIPE)
+            found |= matchbytes(word, '|');
+
+        mask |= (((found >> 7) * 0x0102040810204080ULL) >> 56) << i;
+
+    }
+
+    return mask;
+#else
+    return scanpartial(data, SCAN_BLOCK, set);
+#endif
+
+}
+
+#ifdef SCAN_X86
+
+static unsigned long long scanblock_sse2(char *data, unsigned int set)
+{
+
+    unsigned long long mask = 0;
+    unsigned int i;
+
+    for (i = 0; i < SCAN_BLOCK; i += 16)
+    {
+
+        __m128i chunk = _mm_loadu_si128((__m128i *)(data + i));
+        __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chunk, _mm_setzero_si128()));
+
+        if (set >= SCAN_COMMA)
+            found = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(',')));
+
+        if (set >= SCAN_PIPE)
+            found = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('|')));
+
+        mask |= (unsigned long long)(unsigned int)_mm_movemask_epi8(found) << i;
+
+    }
+
+    return mask;
+
+}
+
+__attribute__((target("avx2")))
+static unsigned long long scanblock_avx2(char *data, unsigned int set)
+{
+
+    unsigned long long mask = 0;
+    unsigned int i;
+
+    for (i = 0; i < SCAN_BLOCK; i += 32)
+    {
+
+        __m256i chunk = _mm256_loadu_si256((__m256i *)(data + i));
+        __m256i found = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chunk, _mm256_setzero_si256()));
+
+        if (set >= SCAN_COMMA)
+            found = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(',')));
+
+        if (set >= SCAN_PIPE)
+            found = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('|')));
+
+        mask |= (unsigned long long)(unsigned int)_mm256_movemask_epi8(found) << i;
+
+    }
+
+    return mask;
+
+}
+
+#endif
+
+unsigned int scan_select(unsigned int method)
+{
+
+#ifdef SCAN_X86
+    __builtin_cpu_init();
+
+    if (method == SCAN_AUTO)
+        method = (__builtin_cpu_supports("avx2")) ? SCAN_AVX2 : SCAN_SSE2;
+
+    switch (method)
+    {
+
+    case SCAN_AVX2:
+        if (!__builtin_cpu_supports("avx2"))
+            return 0;
+
+        scanblock = scanblock_avx2;
+
+        break;
+
+    case SCAN_SSE2:
+        scanblock = scanblock_sse2;
+
+        break;
+
+    case SCAN_SCALAR:
+        scanblock = scanblock_scalar;
+
+        break;
+
+    default:
+        return 0;
+
+    }
+#else
+    if (method == SCAN_AUTO)
+        method = SCAN_SCALAR;
+
+    if (method != SCAN_SCALAR)
+        return 0;
+
+    scanblock = scanblock_scalar;
+#endif
+
+    selected = method;
+
+    return 1;
+
+}
+
+char *scan_method(void)
+{
+
+    switch (selected)
+    {
+
+    case SCAN_AVX2:
+        return "avx2";
+
+    case SCAN_SSE2:
+        return "sse2";
+
+    }
+
+    return "scalar";
+
+}
+
+static unsigned long long scanmask(char *data, unsigned int offset, unsigned int length, unsigned int set)
+{
+
+    if (!scanblock)
+        scan_select(SCAN_AUTO);
+
+    return (offset + SCAN_BLOCK <= length) ? scanblock(data + offset, set) : scanpartial(data + offset, length - offset, set);
+
+}
+
+unsigned int scan_find(char *data, unsigned int offset, unsigned int length, unsigned int set)
+{
+
+    for (; offset < length; offset += SCAN_BLOCK)
+    {
+
+        unsigned long long mask = scanmask(data, offset, length, set);
+
+        if (mask)
+            return offset + __builtin_ctzll(mask);
+
+    }
+
+    return length;
+
+}
+
+void scan_init(struct scan *scan, char *data, unsigned int offset, unsigned int length, unsigned int set)
+{
+
+    scan->data = data;
+    scan->length = length;
+    scan->set = set;
+    scan->offset = offset;
+    scan->block = offset;
+    scan->mask = (offset < length) ? scanmask(data, offset, length, set) : 0;
+
+}
+
+unsigned int scan_next(struct scan *scan)
+{
+
+    unsigned int position;
+    unsigned int count;
+
+    while (!scan->mask)
+    {
+
+        scan->block += SCAN_BLOCK;
+
+        if (scan->block >= scan->length)
+            return 0;
+
+        scan->mask = scanmask(scan->data, scan->block, scan->length, scan->set);
+
+    }
+
+    position = scan->block + __builtin_ctzll(scan->mask) + 1;
+    scan->mask &= scan->mask - 1;
+    count = position - scan->offset;
+    scan->offset = position;
+
+    return count;
+
+}
@@ -0,0 +1,36 @@
+enum
+{
+
+    SCAN_NEWLINE = 1,
+    SCAN_COMMA = 2,
+    SCAN_PIPE = 3
+
+};
+
+enum
+{
+
+    SCAN_AUTO = 0,
+    SCAN_SCALAR = 1,
+    SCAN_SSE2 = 2,
+    SCAN_AVX2 = 3
+
+};
+
+struct scan
+{
+
+    char *data;
+    unsigned int length;
+    unsigned int set;
+    unsigned int offset;
+    unsigned int block;
+    unsigned long long mask;
+
+};
+
+unsigned int scan_select(unsigned int method);
+char *scan_method(void);
+unsigned int scan_find(char *data, unsigned int offset, unsigned int length, unsigned int set);
+void scan_init(struct scan *scan, char *data, unsigned int offset, unsigned int length, unsigned int set);
+unsigned int scan_next(struct scan *scan);
@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sys.h"
+#include "scan.h"
+
+#define BENCH_ROUNDS                    20
+#define CHECK_LENGTH                    200
+
+static volatile unsigned int sink;
+static unsigned int methods[] = {SCAN_SCALAR, SCAN_SSE2, SCAN_AVX2};
+
+static unsigned int isdelimiter(char c, unsigned int set)
+{
+
+    return c == '\n' || c == '\0' || (set >= SCAN_COMMA && c == ',') || (set >= SCAN_PIPE && c == '|');
+
+}
+
+static unsigned int reference(char *data, unsigned int length, unsigned int offset, unsigned int set)
+{
+
+    unsigned int i;
+
+    for (i = offset; i < length; i++)
+    {
+
+        if (isdelimiter(data[i], set))
+            return i + 1 - offset;
+
+    }
+
+    return 0;
+
+}
+
+static double seconds(void)
+{
+
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1000000000.0;
+
+}
+
+static unsigned long long cycles(void)
+{
+
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+
+}
+
+static char *readfile(char *path, unsigned int *length)
+{
+
+    FILE *file = fopen(path, "rb");
+    char *data;
+    long size;
+
+    if (!file)
+        return 0;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc(size + 1);
+    *length = fread(data, 1, size, file);
+
+    fclose(file);
+
+    return data;
+
+}
+
+static unsigned int compare(char *data, unsigned int length, unsigned int set)
+{
+
+    struct scan scan;
+    unsigned int offset;
+    unsigned int count;
+    unsigned int expected;
+
+    scan_init(&scan, data, 0, length, set);
+
+    for (offset = 0; (count = scan_next(&scan)); offset += count)
+    {
+
+        if (count != reference(data, length, offset, set))
+            return 0;
+
+        if (scan_find(data, offset, length, set) != offset + count - 1)
+            return 0;
+
+    }
+
+    expected = reference(data, length, offset, set);
+
+    return !expected && scan_find(data, offset, length, set) == length;
+
+}
+
+static int check(char *path)
+{
+
+    char buffer[CHECK_LENGTH];
+    char alphabet[] = {'a', 'b', ',', '|', '\n', '\0', ' ', '('};
+    unsigned int length;
+    char *data = readfile(path, &length);
+    unsigned int passed = 0;
+    unsigned int total = 0;
+    unsigned int i;
+
+    srand(1);
+
+    for (i = 0; i < sizeof (methods) / sizeof (methods[0]); i++)
+    {
+
+        unsigned int set;
+        unsigned int j;
+
+        if (!scan_select(methods[i]))
+            continue;
+
+        for (set = SCAN_NEWLINE; set <= SCAN_PIPE; set++)
+        {
+
+            for (j = 0; j < 1000; j++)
+            {
+
+                unsigned int count = j % CHECK_LENGTH;
+                unsigned int k;
+
+                for (k = 0; k < count; k++)
+                    buffer[k] = (rand() % 4) ? 'x' : alphabet[rand() % sizeof (alphabet)];
+
+                passed += compare(buffer, count, set);
+                total++;
+
+            }
+
+            if (data)
+            {
+
+                passed += compare(data, length, set);
+                total++;
+
+            }
+
+        }
+
+        if (passed != total)
+            dprintf(SYS_FD_STDOUT, "FAIL %s\n", scan_method());
+
+    }
+
+    free(data);
+    dprintf(SYS_FD_STDOUT, "scan: %u/%u scans passed\n", passed, total);
+
+    return (passed == total) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
+
+static void report(char *name, char *method, unsigned int bytes, double start, double end, unsigned long long ticks)
+{
+
+    if (ticks)
+        dprintf(SYS_FD_STDOUT, "%-8s %-8s %6.2f bytes/cycle %8.0f MB/s\n", name, method, (double)bytes / ticks, bytes / 1000000.0 / (end - start));
+    else
+        dprintf(SYS_FD_STDOUT, "%-8s %-8s %8.0f MB/s\n", name, method, bytes / 1000000.0 / (end - start));
+
+}
+
+static int bench(char *path)
+{
+
+    char *names[] = {"", "newline", "comma", "pipe"};
+    unsigned int length;
+    char *data = readfile(path, &length);
+    unsigned int set;
+
+    if (!data || !length)
+    {
+
+        dprintf(SYS_FD_STDERR, "ERROR: Could not read %s\n", path);
+        free(data);
+
+        return EXIT_FAILURE;
+
+    }
+
+    for (set = SCAN_NEWLINE; set <= SCAN_PIPE; set++)
+    {
+
+        unsigned long long ticks;
+        double start;
+        unsigned int offset;
+        unsigned int count;
+        unsigned int i;
+        unsigned int j;
+
+        start = seconds();
+        ticks = cycles();
+
+        for (j = 0; j < BENCH_ROUNDS; j++)
+        {
+
+            for (offset = 0; (count = reference(data, length, offset, set)); offset += count)
+                sink += count;
+
+        }
+
+        ticks = cycles() - ticks;
+
+        report(names[set], "bytewise", length * BENCH_ROUNDS, start, seconds(), ticks);
+
+        for (i = 0; i < sizeof (methods) / sizeof (methods[0]); i++)
+        {
+
+            if (!scan_select(methods[i]))
+                continue;
+
+            start = seconds();
+            ticks = cycles();
+
+            for (j = 0; j < BENCH_ROUNDS; j++)
+            {
+
+                struct scan scan;
+
+                scan_init(&scan, data, 0, length, set);
+
+                while ((count = scan_next(&scan)))
+                    sink += count;
+
+            }
+
+            ticks = cycles() - ticks;
+
+            report(names[set], scan_method(), length * BENCH_ROUNDS, start, seconds(), ticks);
+
+        }
+
+    }
+
+    free(data);
+
+    return EXIT_SUCCESS;
+
+}
+
+int main(int argc, char **argv)
+{
+
+    if (argc > 1 && !strcmp(argv[1], "--bench"))
+        return bench((argc > 2) ? argv[2] : "Packages");
+
+    return check((argc > 1) ? argv[1] : "Packages");
+
+}
@@ -1,6 +1,20 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <poll.h>
+#include <time.h>
+#include <libgen.h>
+#include <sys/inotify.h>
 #include "sys.h"
 
 enum
@@ -10,7 +24,48 @@ enum
     SYS_WRITE = 1,
     SYS_OPEN = 2,
     SYS_CLOSE = 3,
-    SYS_SEEK = 8
+    SYS_FSTAT = 5,
+    SYS_POLL = 7,
+    SYS_SEEK = 8,
+    SYS_MMAP = 9,
+    SYS_MUNMAP = 11,
+    SYS_SIGACTION = 13,
+    SYS_WRITEV = 20,
+    SYS_MADVISE = 28,
+    SYS_DUP2 = 33,
+    SYS_NANOSLEEP = 35,
+    SYS_GETPID = 39,
+    SYS_SOCKET = 41,
+    SYS_CONNECT = 42,
+    SYS_SENDTO = 44,
+    SYS_RECVFROM = 45,
+    SYS_SENDMSG = 46,
+    SYS_RECVMSG = 47,
+    SYS_BIND = 49,
+    SYS_LISTEN = 50,
+    SYS_FORK = 57,
+    SYS_EXECVE = 59,
+    SYS_EXIT = 60,
+    SYS_WAIT4 = 61,
+    SYS_RENAME = 82,
+    SYS_MKDIR = 83,
+    SYS_UNLINK = 87,
+    SYS_GETAFFINITY = 204,
+    SYS_CLOCKGETTIME = 228,
+    SYS_INOTIFYWATCH = 254,
+    SYS_ACCEPT4 = 288,
+    SYS_PIPE2 = 293,
+    SYS_INOTIFYINIT = 294
+
+};
+
+struct action
+{
+
+    void (*handler)(int);
+    unsigned long flags;
+    void (*restorer)(void);
+    unsigned long mask;
 
 };
 
@@ -48,6 +103,27 @@ unsigned int sys_write(unsigned int fd, void *buffer, unsigned int count)
 
 }
 
+int sys_trywrite(unsigned int fd, void *buffer, unsigned int count)
+{
+
+    return syscall(SYS_WRITE, fd, buffer, count);
+
+}
+
+int sys_trywritev(unsigned int fd, void *buffer1, unsigned int count1, void *buffer2, unsigned int count2)
+{
+
+    struct iovec iov[2];
+
+    iov[0].iov_base = buffer1;
+    iov[0].iov_len = count1;
+    iov[1].iov_base = buffer2;
+    iov[1].iov_len = count2;
+
+    return syscall(SYS_WRITEV, fd, iov, 2);
+
+}
+
 unsigned int sys_open(char *path)
 {
 
@@ -80,6 +156,13 @@ void sys_close(unsigned int fd)
 
 }
 
+int sys_tryclose(unsigned int fd)
+{
+
+    return syscall(SYS_CLOSE, fd);
+
+}
+
 void sys_seek(unsigned int fd, unsigned int offset)
 {
 
@@ -95,3 +178,513 @@ void sys_seek(unsigned int fd, unsigned int offset)
 
 }
 
+
+unsigned int sys_size(unsigned int fd)
+{
+
+    struct stat status;
+    int ret = syscall(SYS_FSTAT, fd, &status);
+
+    if (ret < 0)
+    {
+
+        dprintf(SYS_FD_STDERR, "Fstat syscall failed (%d)\n", ret);
+        exit(EXIT_FAILURE);
+
+    }
+
+    return status.st_size;
+
+}
+
+void *sys_map(unsigned int fd, unsigned int count)
+{
+
+    void *ret = (void *)syscall(SYS_MMAP, 0, count, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (ret == MAP_FAILED)
+    {
+
+        dprintf(SYS_FD_STDERR, "Mmap syscall failed\n");
+        exit(EXIT_FAILURE);
+
+    }
+
+    return ret;
+
+}
+
+void sys_advise(void *address, unsigned int count, unsigned int advice)
+{
+
+    syscall(SYS_MADVISE, address, count, advice);
+
+}
+
+unsigned long sys_mtime(unsigned int fd)
+{
+
+    struct stat status;
+    int ret = syscall(SYS_FSTAT, fd, &status);
+
+    if (ret < 0)
+    {
+
+        dprintf(SYS_FD_STDERR, "Fstat syscall failed (%d)\n", ret);
+        exit(EXIT_FAILURE);
+
+    }
+
+    return status.st_mtim.tv_sec * 1000000000UL + status.st_mtim.tv_nsec;
+
+}
+
+void sys_unmap(void *address, unsigned int count)
+{
+
+    syscall(SYS_MUNMAP, address, count);
+
+}
+
+int sys_tryopen(char *path)
+{
+
+    return syscall(SYS_OPEN, path, O_RDONLY);
+
+}
+
+int sys_create(char *path)
+{
+
+    return syscall(SYS_OPEN, path, O_WRONLY | O_CREAT | O_EXCL, 0644);
+
+}
+
+int sys_rename(char *path, char *newpath)
+{
+
+    return syscall(SYS_RENAME, path, newpath);
+
+}
+
+int sys_unlink(char *path)
+{
+
+    return syscall(SYS_UNLINK, path);
+
+}
+
+int sys_mkdir(char *path)
+{
+
+    return syscall(SYS_MKDIR, path, 0755);
+
+}
+
+unsigned int sys_pid(void)
+{
+
+    return syscall(SYS_GETPID);
+
+}
+
+unsigned int sys_cpus(void)
+{
+
+    unsigned long mask[16];
+    unsigned int count = 0;
+    int ret = syscall(SYS_GETAFFINITY, 0, sizeof (mask), mask);
+    int i;
+
+    for (i = 0; i < ret / (int)sizeof (unsigned long); i++)
+        count += __builtin_popcountl(mask[i]);
+
+    return (count) ? count : 1;
+
+}
+
+void *sys_reserve(unsigned int count)
+{
+
+    void *ret = (void *)syscall(SYS_MMAP, 0, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (ret == MAP_FAILED)
+    {
+
+        dprintf(SYS_FD_STDERR, "Mmap syscall failed\n");
+        exit(EXIT_FAILURE);
+
+    }
+
+    return ret;
+
+}
+
+static void sys_exec(char **argv)
+{
+
+    char *paths = getenv("PATH");
+    unsigned int length = strlen(argv[0]);
+
+    if (strchr(argv[0], '/'))
+    {
+
+        syscall(SYS_EXECVE, argv[0], argv, environ);
+
+        return;
+
+    }
+
+    if (!paths)
+        paths = "/usr/local/bin:/usr/bin:/bin";
+
+    while (*paths)
+    {
+
+        char path[4096];
+        unsigned int count = strcspn(paths, ":");
+
+        if (count + length + 2 <= sizeof (path))
+        {
+
+            memcpy(path, paths, count);
+
+            path[count] = '/';
+
+            memcpy(path + count + 1, argv[0], length + 1);
+            syscall(SYS_EXECVE, path, argv, environ);
+
+        }
+
+        paths += (paths[count]) ? count + 1 : count;
+
+    }
+
+}
+
+int sys_spawn(char **argv, unsigned int fd, unsigned int *out)
+{
+
+    int fds[2];
+    int pid;
+
+    if (syscall(SYS_PIPE2, fds, O_CLOEXEC) < 0)
+        return -1;
+
+    pid = syscall(SYS_FORK);
+
+    if (pid == 0)
+    {
+
+        syscall(SYS_DUP2, fd, SYS_FD_STDIN);
+        syscall(SYS_DUP2, fds[1], SYS_FD_STDOUT);
+        sys_exec(argv);
+        syscall(SYS_EXIT, 127);
+
+    }
+
+    syscall(SYS_CLOSE, fds[1]);
+
+    if (pid < 0)
+    {
+
+        syscall(SYS_CLOSE, fds[0]);
+
+        return -1;
+
+    }
+
+    *out = fds[0];
+
+    return pid;
+
+}
+
+int sys_wait(int pid)
+{
+
+    int status;
+
+    if (syscall(SYS_WAIT4, pid, &status, 0, 0) < 0)
+        return -1;
+
+    return (WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+
+}
+
+static int sys_address(struct sockaddr_un *address, char *path)
+{
+
+    memset(address, 0, sizeof (struct sockaddr_un));
+
+    address->sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof (address->sun_path))
+        return -1;
+
+    strcpy(address->sun_path, path);
+
+    return 0;
+
+}
+
+int sys_listen(char *path)
+{
+
+    struct sockaddr_un address;
+    int fd;
+
+    if (sys_address(&address, path) < 0)
+        return -1;
+
+    fd = syscall(SYS_SOCKET, AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+
+    if (fd < 0)
+        return -1;
+
+    syscall(SYS_UNLINK, path);
+
+    if (syscall(SYS_BIND, fd, &address, sizeof (struct sockaddr_un)) < 0 || syscall(SYS_LISTEN, fd, SOMAXCONN) < 0)
+    {
+
+        syscall(SYS_CLOSE, fd);
+
+        return -1;
+
+    }
+
+    return fd;
+
+}
+
+int sys_connect(char *path)
+{
+
+    struct sockaddr_un address;
+    int fd;
+
+    if (sys_address(&address, path) < 0)
+        return -1;
+
+    fd = syscall(SYS_SOCKET, AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+
+    if (fd < 0)
+        return -1;
+
+    if (syscall(SYS_CONNECT, fd, &address, sizeof (struct sockaddr_un)) < 0)
+    {
+
+        syscall(SYS_CLOSE, fd);
+
+        return -1;
+
+    }
+
+    return fd;
+
+}
+
+int sys_accept(unsigned int fd)
+{
+
+    return syscall(SYS_ACCEPT4, fd, 0, 0, SOCK_CLOEXEC);
+
+}
+
+int sys_sendfds(unsigned int fd, void *buffer, unsigned int count, int *fds, unsigned int nfds)
+{
+
+    char control[CMSG_SPACE(sizeof (int) * 4)];
+    struct msghdr message;
+    struct cmsghdr *header;
+    struct iovec iov;
+
+    if (nfds > 4)
+        return -1;
+
+    memset(&message, 0, sizeof (struct msghdr));
+    memset(control, 0, sizeof (control));
+
+    iov.iov_base = buffer;
+    iov.iov_len = count;
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = CMSG_SPACE(sizeof (int) * nfds);
+    header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof (int) * nfds);
+
+    memcpy(CMSG_DATA(header), fds, sizeof (int) * nfds);
+
+    return syscall(SYS_SENDMSG, fd, &message, MSG_NOSIGNAL);
+
+}
+
+int sys_recvfds(unsigned int fd, void *buffer, unsigned int count, int *fds, unsigned int *nfds)
+{
+
+    char control[CMSG_SPACE(sizeof (int) * 4)];
+    struct msghdr message;
+    struct cmsghdr *header;
+    struct iovec iov;
+    int ret;
+
+    memset(&message, 0, sizeof (struct msghdr));
+
+    iov.iov_base = buffer;
+    iov.iov_len = count;
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof (control);
+    *nfds = 0;
+    ret = syscall(SYS_RECVMSG, fd, &message, MSG_CMSG_CLOEXEC);
+
+    if (ret < 0)
+        return ret;
+
+    for (header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header))
+    {
+
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS)
+        {
+
+            unsigned int n = (header->cmsg_len - CMSG_LEN(0)) / sizeof (int);
+
+            memcpy(fds + *nfds, CMSG_DATA(header), sizeof (int) * n);
+
+            *nfds += n;
+
+        }
+
+    }
+
+    if (message.msg_flags & (MSG_TRUNC | MSG_CTRUNC))
+        return -1;
+
+    return ret;
+
+}
+
+int sys_send(unsigned int fd, void *buffer, unsigned int count)
+{
+
+    return syscall(SYS_SENDTO, fd, buffer, count, MSG_NOSIGNAL, 0, 0);
+
+}
+
+int sys_recv(unsigned int fd, void *buffer, unsigned int count)
+{
+
+    return syscall(SYS_RECVFROM, fd, buffer, count, 0, 0, 0);
+
+}
+
+void sys_ignorepipe(void)
+{
+
+    struct action action;
+
+    memset(&action, 0, sizeof (struct action));
+
+    action.handler = SIG_IGN;
+
+    syscall(SYS_SIGACTION, SIGPIPE, &action, 0, sizeof (action.mask));
+
+}
+
+int sys_watch(char **paths, unsigned int count)
+{
+
+    int fd = syscall(SYS_INOTIFYINIT, IN_CLOEXEC);
+    unsigned int i;
+
+    if (fd < 0)
+        return -1;
+
+    for (i = 0; i < count; i++)
+    {
+
+        char path[4096];
+
+        if (snprintf(path, 4096, "%s", paths[i]) >= 4096 || syscall(SYS_INOTIFYWATCH, fd, dirname(path), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+
+            syscall(SYS_CLOSE, fd);
+
+            return -1;
+
+        }
+
+    }
+
+    return fd;
+
+}
+
+unsigned int sys_waitwatch(unsigned int fd, char **paths, unsigned int count, int timeout)
+{
+
+    char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    struct pollfd pollfd;
+    unsigned int changed = 0;
+    int length;
+    int offset;
+
+    pollfd.fd = fd;
+    pollfd.events = POLLIN;
+
+    if (syscall(SYS_POLL, &pollfd, 1, timeout) <= 0)
+        return 0;
+
+    length = syscall(SYS_READ, fd, buffer, sizeof (buffer));
+
+    for (offset = 0; offset < length; offset += sizeof (struct inotify_event) + ((struct inotify_event *)(buffer + offset))->len)
+    {
+
+        struct inotify_event *event = (struct inotify_event *)(buffer + offset);
+        unsigned int i;
+
+        if (!event->len)
+            continue;
+
+        for (i = 0; i < count; i++)
+        {
+
+            char path[4096];
+
+            if (snprintf(path, 4096, "%s", paths[i]) < 4096 && !strcmp(basename(path), event->name))
+                changed = 1;
+
+        }
+
+    }
+
+    return changed;
+
+}
+
+void sys_sleep(unsigned int milliseconds)
+{
+
+    struct timespec duration;
+
+    duration.tv_sec = milliseconds / 1000;
+    duration.tv_nsec = (milliseconds % 1000) * 1000000L;
+
+    syscall(SYS_NANOSLEEP, &duration, 0);
+
+}
+
+unsigned long sys_clock(void)
+{
+
+    struct timespec now;
+
+    syscall(SYS_CLOCKGETTIME, CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec * 1000000000UL + now.tv_nsec;
+
+}
@@ -7,8 +7,48 @@ enum
 
 };
 
+enum
+{
+
+    SYS_ADVISE_NORMAL = 0,
+    SYS_ADVISE_RANDOM = 1,
+    SYS_ADVISE_SEQUENTIAL = 2,
+    SYS_ADVISE_WILLNEED = 3
+
+};
+
 unsigned int sys_read(unsigned int fd, void *buffer, unsigned int count);
 unsigned int sys_write(unsigned int fd, void *buffer, unsigned int count);
+int sys_trywrite(unsigned int fd, void *buffer, unsigned int count);
+int sys_trywritev(unsigned int fd, void *buffer1, unsigned int count1, void *buffer2, unsigned int count2);
 unsigned int sys_open(char *path);
 void sys_close(unsigned int fd);
+int sys_tryclose(unsigned int fd);
 void sys_seek(unsigned int fd, unsigned int offset);
+unsigned int sys_size(unsigned int fd);
+void *sys_map(unsigned int fd, unsigned int count);
+void sys_advise(void *address, unsigned int count, unsigned int advice);
+unsigned long sys_mtime(unsigned int fd);
+void sys_unmap(void *address, unsigned int count);
+int sys_tryopen(char *path);
+int sys_create(char *path);
+int sys_rename(char *path, char *newpath);
+int sys_unlink(char *path);
+int sys_mkdir(char *path);
+unsigned int sys_pid(void);
+unsigned int sys_cpus(void);
+void *sys_reserve(unsigned int count);
+int sys_spawn(char **argv, unsigned int fd, unsigned int *out);
+int sys_wait(int pid);
+int sys_listen(char *path);
+int sys_connect(char *path);
+int sys_accept(unsigned int fd);
+int sys_sendfds(unsigned int fd, void *buffer, unsigned int count, int *fds, unsigned int nfds);
+int sys_recvfds(unsigned int fd, void *buffer, unsigned int count, int *fds, unsigned int *nfds);
+int sys_send(unsigned int fd, void *buffer, unsigned int count);
+int sys_recv(unsigned int fd, void *buffer, unsigned int count);
+void sys_ignorepipe(void);
+int sys_watch(char **paths, unsigned int count);
+unsigned int sys_waitwatch(unsigned int fd, char **paths, unsigned int count, int timeout);
+void sys_sleep(unsigned int milliseconds);
+unsigned long sys_clock(void);
@@ -59,3 +59,35 @@ echo "====================="
 echo "RESOLVE ubuntu-server"
 echo "====================="
 ./aptinfo resolve "media-types,pinentry-curses,dpkg,python3-debconf,debconf,dbus,e2fsprogs,libpam-systemd,fdisk,xxd,ubuntu-server" Packages
+echo "==============================="
+echo "RESOLVE through second provider"
+echo "==============================="
+./aptinfo resolve root tests/provides
+echo "=========================="
+echo "RESOLVE with older version"
+echo "=========================="
+./aptinfo resolve root tests/versions
+echo "=============================="
+echo "DISTCHECK missing dependencies"
+echo "=============================="
+./aptinfo distcheck tests/missing
+echo "================================="
+echo "DISTCHECK through second provider"
+echo "================================="
+./aptinfo distcheck tests/provides
+echo "============================"
+echo "DISTCHECK with older version"
+echo "============================"
+./aptinfo distcheck tests/versions
+echo "==============================="
+echo "DISTCHECK with empty dependency"
+echo "==============================="
+./aptinfo distcheck tests/empty
+echo "================================"
+echo "RRDEPENDS through provided names"
+echo "================================"
+./aptinfo rrdepends exim tests/provides
+echo "============================="
+echo "CYCLES through provided names"
+echo "============================="
+./aptinfo cycles tests/cycles
@@ -0,0 +1,184 @@
+#include <stdlib.h>
+#include <string.h>
+#include "version.h"
+
+#define KEY_TILDE                       1
+#define KEY_END                         2
+#define KEY_UPPER                       3
+#define KEY_LOWER                       29
+#define KEY_OTHER                       55
+#define KEY_LONG                        0xff
+#define KEY_BUFFER                      VERSION_KEYSIZE(256)
+
+static unsigned int isnumerical(unsigned int c)
+{
+
+    return (c >= '0' && c <= '9');
+
+}
+
+static unsigned int torank(unsigned int c)
+{
+
+    unsigned int below = c;
+
+    if (c == '~')
+        return KEY_TILDE;
+
+    if (c >= 'A' && c <= 'Z')
+        return KEY_UPPER + (c - 'A');
+
+    if (c >= 'a' && c <= 'z')
+        return KEY_LOWER + (c - 'a');
+
+    if (c > '9')
+        below -= 10;
+
+    if (c > 'Z')
+        below -= 26;
+
+    if (c > 'z')
+        below -= 26;
+
+    if (c > '~')
+        below -= 1;
+
+    return KEY_OTHER + below;
+
+}
+
+static unsigned int putnumber(char *key, char *data, unsigned int length)
+{
+
+    unsigned int offset = 0;
+
+    while (length && data[0] == '0')
+    {
+
+        data++;
+        length--;
+
+    }
+
+    if (length < KEY_LONG)
+    {
+
+        key[offset++] = length;
+
+    }
+
+    else
+    {
+
+        key[offset++] = (char)KEY_LONG;
+        key[offset++] = length >> 24;
+        key[offset++] = length >> 16;
+        key[offset++] = length >> 8;
+        key[offset++] = length;
+
+    }
+
+    memcpy(key + offset, data, length);
+
+    return offset + length;
+
+}
+
+static unsigned int putpart(char *key, char *data, unsigned int length)
+{
+
+    unsigned int offset = 0;
+    unsigned int i = 0;
+
+    do
+    {
+
+        unsigned int start;
+
+        for (; i < length && !isnumerical(data[i]); i++)
+            key[offset++] = torank((unsigned char)data[i]);
+
+        key[offset++] = KEY_END;
+
+        for (start = i; i < length && isnumerical(data[i]); i++);
+
+        offset += putnumber(key + offset, data + start, i - start);
+
+    } while (i < length);
+
+    key[offset++] = KEY_END;
+
+    return offset;
+
+}
+
+unsigned int version_key(char *key, char *version, unsigned int length)
+{
+
+    unsigned int colon = 0;
+    unsigned int dash = length;
+    unsigned int start = 0;
+    unsigned int offset = 0;
+    unsigned int i;
+
+    for (i = 0; i < length; i++)
+    {
+
+        if (version[i] == ':')
+        {
+
+            colon = i;
+            start = i + 1;
+
+            break;
+
+        }
+
+    }
+
+    for (i = start; i < length; i++)
+    {
+
+        if (version[i] == '-')
+            dash = i;
+
+    }
+
+    offset += putnumber(key + offset, version, colon);
+    offset += putpart(key + offset, version + start, dash - start);
+    offset += (dash < length) ? putpart(key + offset, version + dash + 1, length - dash - 1) : putpart(key + offset, version, 0);
+
+    return offset;
+
+}
+
+int version_comparekeys(char *key1, unsigned int length1, char *key2, unsigned int length2)
+{
+
+    int c = memcmp(key1, key2, (length1 < length2) ? length1 : length2);
+
+    if (c)
+        return c;
+
+    return (length1 > length2) - (length1 < length2);
+
+}
+
+int version_compare(char *version1, unsigned int length1, char *version2, unsigned int length2)
+{
+
+    char buffer1[KEY_BUFFER];
+    char buffer2[KEY_BUFFER];
+    char *key1 = (VERSION_KEYSIZE(length1) > KEY_BUFFER) ? malloc(VERSION_KEYSIZE(length1)) : buffer1;
+    char *key2 = (VERSION_KEYSIZE(length2) > KEY_BUFFER) ? malloc(VERSION_KEYSIZE(length2)) : buffer2;
+    int c = version_comparekeys(key1, version_key(key1, version1, length1), key2, version_key(key2, version2, length2));
+
+    if (key1 != buffer1)
+        free(key1);
+
+    if (key2 != buffer2)
+        free(key2);
+
+    return c;
+
+}
@@ -0,0 +1,5 @@
+#define VERSION_KEYSIZE(length)         (4 * (length) + 16)
+
+unsigned int version_key(char *key, char *version, unsigned int length);
+int version_comparekeys(char *key1, unsigned int length1, char *key2, unsigned int length2);
+int version_compare(char *version1, unsigned int length1, char *version2, unsigned int length2);
@@ -0,0 +1,3764 @@
+struct corpus
+{
+
+    char *version1;
+    char *version2;
+    int result;
+
+};
+
+static struct corpus corpus[] = {
+    {"4..", "4.0..", 1},
+    {"900076.-+11.by", "900076.-+11.BY", 1},
+    {"10:6zz0+-37457519956201882757348772887796225610000476", "2+y3", 1},
+    {"0:9000752.~.", "0:9000752.~.a", -1},
+    {"0:12abyab1zzzBA-zYZ+~2", "10:12abyab1zzzBA-zYZ+~2", -1},
+    {"0:12-z-aY000996.zY", "0:12-z-aY000996.zY~~", 1},
+    {"2:452973002925723981264801828737268037245430136667406810997797252910665158255", "2:452973002925723981264801828737268037245430136667406810997797252910665158255~rc1", 1},
+    {"93~00456-++..bY", "2:93~00456-++..bY", -1},
+    {"1:120003160479A-~0003230782255", "120003160479A-~0003230782255", 1},
+    {"01:4-~-byb1.00686~", "11~A255~-~0836", 1},
+    {"10.", "10:10.", -1},
+    {"122A-+100", "122A-+100a", -1},
+    {"3AZAzZz173377850217247935018854629-ABB2552.b", "3azazzz173377850217247935018854629-abb2552.b", -1},
+    {"1010.-007", "1010.-00007", 0},
+    {"3+.", "3+.0.", -1},
+    {"0+A~601570216187688247136961631701", "4.ba000727~", -1},
+    {"122-0158~", "0:122-0158~", 0},
+    {"110255YZz+.", "0:110255YZz+.", 0},
+    {"1:51Z02.", "1:51Z02.-1-1", -1},
+    {"1:7~::yzB", "001:7~::yzB", 0},
+    {"01:261710418499570023919583047.255", "01:261710418499570023919583047.255-1-1", -1},
+    {"900833-bYYZZ", "0:900833-bYYZZ", 0},
+    {"8~aZ", "08~aZ", 0},
+    {"01:900059000353bZA", "900059000353bZA", 1},
+    {"01:7Yb00306-by000563000223", "1941694820657390803230510629995530245584655408962640918376135082874165039-0851+1~", 1},
+    {"0Z-A.", "2:0Z-A.", -1},
+    {"01:810014240102686096403172136zYy", "107431695375702077571-Z050~00633~", 1},
+    {"3AZ-~aaBY10+", "3AZ-~aaBY110+", -1},
+    {"11BZz", "11BZz~~", 1},
+    {"0+z89049634071355337855758060811-A7827347902975836791199", "0+z89049634071355337855758060811-A7827347902975836791199.0", -1},
+    {"0A-+aY", "0A-+aY~", 1},
+    {"0:6~YaZbY-Y0001539Ya", "9a++9zYA-.7813167157946669886812275735689918", -1},
+    {"0:111009000740~-~..", "0:111009000740~-~..~1", 1},
+    {"0:7066256:.113005164846345884397-2554936280741903163201Y", "0:7066256:a113005164846345884397-2554936280741903163201Y", 1},
+    {"01:1008082y3", "110-3ya+", 1},
+    {"4100+10018391952449137747900604273135814013--YBy", "4100+10018391952449137747900604273135814013--YBy~", 1},
+    {"2:11BZY11:00930:", "2:11BZY11:00930:+", -1},
+    {"2:5000481.-~aZz.", "2:5000481.-~aZz.-0", -1},
+    {"10:83~yAaAAy-000829~", "125639109896530880456896461171095206485886037541856768219063095104070877216bBBy-100", 1},
+    {"443833555899927839153644416-b", "4943833555899927839153644416-b", -1},
+    {"8b~1256-Aba573095022230394721359156847650427951881799.", "8b~1256-Aba5730095022230394721359156847650427951881799.", -1},
+    {"4100952.0678--+Zyb", "0:4100952.0678--+Zyb", 0},
+    {"00:1-Yaa-.", "1-Yaa-.", 0},
+    {"3~aYby256", "0:3~aYby256", 0},
+    {"111B+-~0077+ybb0594", "111B+-~0077+ybb0594~1", 1},
+    {"56275741170432561828470687515368348013483536314249625628193092515316256-0.2~", "56275741170432561828470687515368348013483536314249625628193092515316256-0.2~~~", 1},
+    {"9+000931", "8bAb", 1},
+    {"1BbZ00995Za~", "1BbZ00995Za~A", -1},
+    {"11Y-~", "10:11Y-~", -1},
+    {"10:2bzy~-Ab.ZbzyY", "10:2bzy~-0Ab.ZbzyY", 1},
+    {"2a~.-YYz20925281193842505869890331131110.000197+", "0:2a~.-YYz20925281193842505869890331131110.000197+", 0},
+    {"0048800806.", "0048800806.~rc1", 1},
+    {"10:10+~-+00023900010210", "2:10+~-+00023900010210", 1},
+    {"10:099:-+B-99027000066446514833071196563730805518~", "10:099:-+B-9902700000066446514833071196563730805518~", -1},
+    {"01:589424826427895686997680953176545305395160357660641673524657978194306740004832515962421378609067408039618-yazyAZ0.zB", "01:7658161721932348399858281022241255zZay-256563609536625800949536aa0094800417", 1},
+    {"12100-yAY0422100", "12100-yay0422100", -1},
+    {"11-BabaBz-baY", "10:11-BabaBz-baY", -1},
+    {"1125641751892320016425960065425544217", "1125641751892320016425960065425544217~1", 1},
+    {"21+-~99", "21+-~999", -1},
+    {"1199+~", "0:1199+~", 0},
+    {"12ZAy5259815620267275052583116828823021506", "12ZAy5259815620267275052583116828823021506A", -1},
+    {"01:79795156947555501208719447140461834142613-0891.bBy~", "01:79795156947555501208719447140461834142613-0891+bBy~", 1},
+    {"1:0507257333870271485171388949890860zAzZyz-.yba10", "1:0507257333870271485171388949890860zAzZyz-ayba10", 1},
+    {"112YbB-02ZBZ.59744469139095947988297740", "0:112YbB-02ZBZ.59744469139095947988297740", 0},
+    {"12BAZy-000808-Ab100Ba0", "12BAZy-000808-Ab1100Ba0", -1},
+    {"1:50466-1060551852514570379256705-00089~10", "1:50466-10605518512514570379256705-00089~10", -1},
+    {"50074400155", "500740400155", -1},
+    {"10+103795893164520258660485710109815--Zyz70685905429710386501793772551~", "10+1037958913164520258660485710109815--Zyz70685905429710386501793772551~", -1},
+    {"6.", "6.~rc1", 1},
+    {"8820773714920050438782883AbA-~", "8820773714920050438782883AbA-~.0", -1},
+    {"02-3~A..", "02-03~A..", 0},
+    {"6--2380159503619233702153", "6--23801159503619233702153", -1},
+    {"09000727-zBay", "10:09000727-zBay", -1},
+    {"5~-98363146675404135488608800905~256", "2:5~-98363146675404135488608800905~256", -1},
+    {"1:10yZZaB:yaA-~.+y", "1:10yZZaB:yaA-~.+y+b1", -1},
+    {"2:7~14712063825293441826375256205359699902514", "2:7~14712063825293441826375256205359699902514~1", 1},
+    {"1256000103.-10~yY.100", "0:1256000103.-10~yY.100", 0},
+    {"315782116455953330690631113+256", "315782116455953330690631113+256~~", 1},
+    {"20---1090bBz", "20---1090bbz", -1},
+    {"5+-2B", "5+-02B", 0},
+    {"4~86955212817043768611461110-~y.", "10:4~86955212817043768611461110-~y.", -1},
+    {"10+0130", "01:3:1~10-.+++", -1},
+    {"1.b", "0:1.b", 0},
+    {"8Z-+abBbZY+", "8Z-0+abBbZY+", 1},
+    {"0--1-100", "2:0--1-100", -1},
+    {"10354+3-~b", "10354+3-0~b", -1},
+    {"1124101788373842998469", "2:147181444475255621839214738837y3za.-~.~", -1},
+    {"2+a39106953752732909087018817ay-BB0566YZB.", "0:2+a39106953752732909087018817ay-BB0566YZB.", 0},
+    {"8339272803900811910227743867722680431~-000396+", "8339272803900811910227743867722680431~-000396++", -1},
+    {"5.zyY-bbY100~", "0:5.zyY-bbY100~", 0},
+    {"10:6azZ.9BB", "6azZ.9BB", 1},
+    {"8+Zb-12051147711546451493933000286", "8+Zb-1205114771154645149393300000286", -1},
+    {"9255-++.yZz00705", "1:9255-++.yZz00705", -1},
+    {"12Yzb--+~9", "699100z99-0773", -1},
+    {"653449346295161485337797654883-zaz11.9000483", "653449346295161485337797654883-ZAZ11.9000483", 1},
+    {"0:03674448643311637867154-1001~2.", "0:03674448643311637867154-1001~2.~a", 1},
+    {"12000562A3-0001180058600297yaa", "12000562A3-0001180058600297yaaA", -1},
+    {"3.-949334076876140857136709288046821a-aYa00635", "3.-0949334076876140857136709288046821a-aYa00635", 0},
+    {"384688839568012469670206594ZAbbA-~000597", "384688839568012469670206594ZAbbA-~000597.0", -1},
+    {"00:0YAb-75259904408943437786004543661911349068801009", "00:0yab-75259904408943437786004543661911349068801009", -1},
+    {"7.-yYa14997877967170812784832635170587962ZZ", "7.-YYA14997877967170812784832635170587962ZZ", 1},
+    {"0000613YYa", "00006193YYa", -1},
+    {"2~00244zy-ZyB00055723463412269253377193128128277641239032", "11YbBbA", -1},
+    {"0YAyZ-255~~+00179", "0yayz-255~~+00179", -1},
+    {"10---za-By~98456305957497795455291", "10---za-By~9845630595740097795455291", -1},
+    {"710a745430887677741648136698819218242923539-ZA25525611YZ", "710a745430887677741648136698819218242923539-ZA25525611YZ-0", -1},
+    {"0:5y-3", "0:5y-3~", 1},
+    {"0:12+-000603aBb", "0:12+-0100603aBb", -1},
+    {"2:82", "10:82", -1},
+    {"105676246857563441417010zbA-2Za000512.", "0:105676246857563441417010zbA-2Za000512.", 0},
+    {"7B-1000011200318Za~", "7B-01000011200318Za~", 0},
+    {"6yZ-yA99zb", "6yZ-yA99zb.0", -1},
+    {"1002323", "1900648-.8431649631801431244487765731902+3", -1},
+    {"225526711123529393805540513536198.4801103993896342677520784038587-0179z.", "225526711123529393805540513536198.4801103993896342677520784038587-0179z.A", -1},
+    {"0:22Az~", "22Az~", 0},
+    {"12.-00616bZ16407353964665686935956003", "12.-00616BZ16407353964665686935956003", 1},
+    {"12.995562528225453278863207589~", "12.995562528225453278863207589~+b1", -1},
+    {"310~+256", "1310~+256", -1},
+    {"10:81", "10:81-1-1", -1},
+    {"10:10:-+BAaB", "10:10:-+BAaB~~", 1},
+    {"2255-+", "0:2255-+", 0},
+    {"01:3b", "01:3b-1-1", -1},
+    {"1~5213559748450944460y00881-100412721265601922709205920169566733", "12BYyZ~yABz", -1},
+    {"7B365622695315672147619794667367025228472-+ayybzYbZ", "0:7B365622695315672147619794667367025228472-+ayybzYbZ", 0},
+    {"199A~~-.255", "199A~~-~255", 1},
+    {"6.ZAZ-813342973210992905583532~", "6+ZAZ-813342973210992905583532~", 1},
+    {"30-+-~99ZYZZ", "30-+-~99zyzz", -1},
+    {"1:60371.yZ7382975047827573633055519B", "1:60371.yZ7382975047827573633055519B-1-1", -1},
+    {"4YYZAZAz-100-Za", "0:4YYZAZAz-100-Za", 0},
+    {"12yybZZ.-zbB000161~", "12yybzz.-zbb000161~", -1},
+    {"7~-.0190000133", "6bybba99--++b", 1},
+    {"0:11b+", "0:11b+~", 1},
+    {"1--~10y000294", "0:1--~10y000294", 0},
+    {"1100592-~", "1100592-~~1", 1},
+    {"12929692915719409081433837625628471723698AA000226-255134555227434201120829422952201666131389", "12929692915719409081433837625628471723698AA000226-255134555227434201120829422952201666131389+b1", -1},
+    {"4.256000864--10", "4.256000864-0-10", 0},
+    {"6.1YYb497595445947436199141511848-539661633835538849466482182410aaY.", "0:10:255", -1},
+    {"4~A0.1", "0:4~A0.1", 0},
+    {"2:11.-8898379291027786717616762241446aYy", "2:11~-8898379291027786717616762241446aYy", 1},
+    {"4yBY-aY~Y00319", "5BAa-0058941627042551445257584943178450117", -1},
+    {"51111255~-14430066626063741974725492083230419", "51111255~-014430066626063741974725492083230419", 0},
+    {"50206-az-.", "50206-az-.~a", 1},
+    {"1YByAZ-92256y.", "1YByAZ-92256y~", 1},
+    {"0+Zz+0257-+900732547460608066069940150844984162", "0+Zz+0257-+9007325474606080660699401508440984162", -1},
+    {"9+Yba--yAb", "0:9+Yba--yAb", 0},
+    {"11000666~-+A3504353170012432695468z~", "11000666~-+A3504353170012432695468Z~", 1},
+    {"11255.", "00:12ba-zabZBB-3Bbb", 1},
+    {"4.", "0:4.", 0},
+    {"0:2ZZz509661328876238760984062323936900781552-+000541", "1y~00613-728528560532982659270581yY0215", 1},
+    {"0:103923147619985282801111152881511906-11", "1:103923147619985282801111152881511906-11", -1},
+    {"3100255ZzB-zAbAy692721655167799895196097240413920", "10:3100255ZzB-zAbAy692721655167799895196097240413920", -1},
+    {"10+22339772394762824779017BY", "0:10+22339772394762824779017BY", 0},
+    {"411", "411+b1", -1},
+    {"185328134559333365764643468739100334000841~1876507912494118307547796-0249+", "6A10256-.100Abb", 1},
+    {"111bybz", "1191bybz", -1},
+    {"0:6.BZ-100ba000699", "0:6.BZ-100ba000699~a", 1},
+    {"10:60223289571191426783242327052", "10:60223289571191426783242327052-1-1", -1},
+    {"1:9~00097500046169047618531498446944653164777aab-9000845137248323454160406863067704900021", "9~00097500046169047618531498446944653164777aab-9000845137248323454160406863067704900021", 1},
+    {"113-10473398068729496412574939863200785~", "113-10473398068729496412574939863200785~+", -1},
+    {"1100871AZB-000735+.", "1100871AZB-000735+a", 1},
+    {"10:8256+11", "1:8256+11", 1},
+    {"01:0:.2560646", "57325944100771293749ZZ-~505334386982767825588200773045807172462000215.", 1},
+    {"12Ay", "12Ay~", 1},
+    {"89", "89~", 1},
+    {"925568037584027436140546309474071093yA3891779171113728368207911402640.", "925568037584027436140546309474071093yA38917791711137283682079101402640.", -1},
+    {"1155608696689657678030619817.-y.zB9~", "1155608696689657678030619817.-Y.ZB9~", 1},
+    {"10:2B-210", "10:2B-0210", 0},
+    {"8-10011-99AYA", "8-10011-99AYA~", 1},
+    {"1000202yy--bZ9BayB000819", "70888.", 1},
+    {"00:10:0-0193abY", "10:0-0193abY", -1},
+    {"12~~yzA3228589259526486096401729926758411124863-~~280179635684462185514537348910553036", "0:12~~yzA3228589259526486096401729926758411124863-~~280179635684462185514537348910553036", 0},
+    {"10+100+000412-yY", "2:10+100+000412-yY", -1},
+    {"4100255~-Z.0", "4100255~-Z.10", -1},
+    {"7.374453362283925426961800.-bbzzA0483+", "0:7.374453362283925426961800.-bbzzA0483+", 0},
+    {"1:943225338316399579181721380141510102100B100-.", "7.+", 1},
+    {"10:4bz49116106978636473698700009658970", "2:5baa93.0855-1944371532160798209027373156", 1},
+    {"1z7492318638199869514410811311-255AAy", "1z7492318638199869514410811311-255AAyA", -1},
+    {"0:11A000564-.-032.Y", "0:11A0009564-.-032.Y", -1},
+    {"63bZ-+", "63BZ-+", 1},
+    {"1:01083363496506195768653885020.-.", "2:01083363496506195768653885020.-.", -1},
+    {"00:80025211+255100-.a.6306254891856463030624004220~", "00:80025211+255100-0.a.6306254891856463030624004220~", 1},
+    {"4~~3415359437108394711y", "0:4~~3415359437108394711y", 0},
+    {"7~88890716216018116287904766.+-aaA25991269526852872073664163654182144228255", "2:7~88890716216018116287904766.+-aaA25991269526852872073664163654182144228255", -1},
+    {"0:11+-2.000762zzA", "0:11+-02.000762zzA", 0},
+    {"811-3YAA", "811-3YAA~~", 1},
+    {"10:12:9-+18191641279373161478919069405250547652146164649149977107488778558Y", "10:12:9-+18191641279373161478919069405250547652146164649149977107488778558Y~1", 1},
+    {"1:0.-.", "12-a.-ybbY", 1},
+    {"12zz-bb00415666516341261891158428362658205072597236aZZ", "12ZZ-BB00415666516341261891158428362658205072597236AZZ", 1},
+    {"9YZAAbyy-BY000200", "9YZAAbyy-BY000200+b1", -1},
+    {"908590~-000853+~51380911644845311825092265398258898", "908590~-000853+~51380911644845311825092265398258898~~", 1},
+    {"5Yyb7298731190125980746447528686+94571838330631074577059754720649008~", "5Yyb7298731190125980746447528686+94571838330631074577059754720649008~-1-1", -1},
+    {"6000900+11za-99", "01:4-yzz000594443599886933142803772-1112000845", -1},
+    {"10yzZy-3a", "10yzZy-03a", 0},
+    {"10~6203462903103667641973432770724944446595-114537171498842417377218774593200031047102047977360082784308117306909408385", "6--+zz4081932422124848009-2.+", 1},
+    {"811.~-00400", "811.~-00400~~", 1},
+    {"00:9000425~.:-255~", "100845100Y-~B10831800044155646295395749.", -1},
+    {"0:80~92471095978258798075-2.", "0:80~92471095978258798075-2.~~", 1},
+    {"1292561179733052633824697246642471551796873510-10", "0:1292561179733052633824697246642471551796873510-10", 0},
+    {"30083BABBA", "300183BABBA", -1},
+    {"0255Aa9-+92747233512165913747162579AYZ~+", "0255Aa9-+92747233512165913747162579AYZ~+a", -1},
+    {"1210--A+.", "0B", 1},
+    {"3--310000698.", "3-0-310000698.", 0},
+    {"81YYb11", "081YYb11", 0},
+    {"2Z9~255YZY", "2Z9~2155YZY", -1},
+    {"12--.566019865369445933755590776", "12--.566019865369445933755590776~rc1", 1},
+    {"10:71121361882039382022322869677-..900523", "10:71121361882039382022322869677-..900523~a", 1},
+    {"10:12ZY9B~+-.bBYyAY", "10:12ZY9B~+-.bBYyAY-1", -1},
+    {"9.2AZ16193666330661267897886835942-9~", "9.2az16193666330661267897886835942-9~", -1},
+    {"0:1~~100", "1:1~~100", -1},
+    {"50-10+256A", "50-10+256A-0", -1},
+    {"3B0.aB-.00276", "296017541935342100544632887YZ-.255.ZZAZ", -1},
+    {"3YZ", "8~+~", -1},
+    {"500247~+-ay000173+", "10~0018-100yay10", 1},
+    {"1009685829215763884971237438485090Y2", "1009685829215763884971237438485090Y2~rc1", 1},
+    {"5..0701~.-10+", "5..0701~.-010+", 0},
+    {"2.-Yy00782Bbb", "2.-Yy00782Bbb.0", -1},
+    {"82+-.9163740104026037437-4898717392553427924415807.1255yB", "82+-.916300740104026037437-4898717392553427924415807.1255yB", -1},
+    {"1:610000907000142", "001:610000907000142", 0},
+    {"10:425628063395675977508033301552629299252471bZA100-AazB000774a.", "1:425628063395675977508033301552629299252471bZA100-AazB000774a.", 1},
+    {"0:4a~-.~2yZB000987", "0:4a~-~~2yZB000987", 1},
+    {"2:800139B-1", "3~~ZzbAzZ73215930347714531232", 1},
+    {"1:3+00656-YY", "1:3+00656-YY+", -1},
+    {"511YY0008989013", "511yy0008989013", -1},
+    {"1:1~.~Zy3-0845", "1:1~.~Zy3-08415", -1},
+    {"1.~~99-~~0", "0:1.~~99-~~0", 0},
+    {"01:8:~-b~.", "8:~-b~.", -1},
+    {"3+-bbY", "12~ZZY~100aYY-~aZb+zYzzB", -1},
+    {"2Zaa2560001700376-~.+92", "2ZAA2560001700376-~.+92", 1},
+    {"1.y", "11000302005589.607459101595071645509178", -1},
+    {"310-100318-~A.0613~", "310-100318-~A+0613~", 1},
+    {"8-zyY-10099-10..+", "8-zyY-10099-10..+~a", 1},
+    {"511aYb-338896970842424269984b482922722186464795397443115100653", "511aYb-33889600970842424269984b482922722186464795397443115100653", -1},
+    {"1199aA-+1", "100199aA-+1", -1},
+    {"80619~-AAaA0~0061", "1+0368-+-000179YB", 1},
+    {"7100.0308YY-+zy100bB0", "0000375.-0238~+703474641035916900987371858490662574", 1},
+    {"6yb11-7107918505558749144316905Z100", "0:6yb11-7107918505558749144316905Z100", 0},
+    {"7~yB113-255", "0:7~yB113-255", 0},
+    {"200219~-~~ZZ.", "200219~-0~~ZZ.", -1},
+    {"10yYa-.y+", "10yYa-.y++b1", -1},
+    {"110y--Y+~034300749", "110y-0-Y+~034300749", 0},
+    {"7ZyB-b98380388185132054436020771511906712836365933540375999", "7ZyB-b98380388185132054436020771511906712836365933540375999.0", -1},
+    {"2:6256YaA:--.0z~", "2:6256YaA:--+0z~", 1},
+    {"9403921987078149583062704343230010458--100yzZ696086562222933085991805894198", "9403921987078149583062704343230010458--100yzZ6960865622229330859918005894198", -1},
+    {"10828945197700359925716297807z.", "10828945197700359925716297807z.~a", 1},
+    {"10+10by", "10+10by-1-1", -1},
+    {"2+2.~00512", "10:2+2.~00512", -1},
+    {"00:2+~2563~-+10", "10:7100:3-ZZ-~Y100~", -1},
+    {"0:02~A0129-2", "10:02~A0129-2", -1},
+    {"80333255zBy-169777384142479263472932477874168413~+", "80333255zBy-169777384142479263472932477874168413~+~1", 1},
+    {"2BA-yBAB", "0:2BA-yBAB", 0},
+    {"1:9256-.", "1:9256-..", -1},
+    {"10:2Ya000472", "2:2Ya000472", 1},
+    {"0:11:1-058711.", "0:11:1-058711.~rc1", 1},
+    {"01:9000933+20187", "9000933+20187", 1},
+    {"3.4261752822671252404979882948016027201484590891377754305134845999358447926.-+~.+b", "00:300050511100005793", -1},
+    {"01:4AA~95955236619873459539873549-yY256a346901187283920174973141256278", "01:4aa~95955236619873459539873549-yy256a346901187283920174973141256278", -1},
+    {"90AzzzA99~-a~ZbbbbY", "10:7yzBbaZ-.2561010", -1},
+    {"2~0077-~", "1:2~0077-~", -1},
+    {"10:0BZZ-+00030200101B~", "10:0BZZ-+000030200101B~", 0},
+    {"1+", "1+~1", 1},
+    {"11-11+100-ab", "11-011+100-ab", 0},
+    {"10BBAz+-10+99~2", "2:10BBAz+-10+99~2", -1},
+    {"73119~-7485983426088818356635A", "0:73119~-7485983426088818356635A", 0},
+    {"11+a-000396000918~", "11+a-0000396000918~", 0},
+    {"8z-856955831517615998808410043221866328685380839818956000403-.BbB..", "8z-856955831517615998808410043221866328685380839818956000403-~BbB..", 1},
+    {"10a39347679334083141841550225374373-AbAAza", "10a393476793034083141841550225374373-AbAAza", -1},
+    {"1:51099Y", "1:51099Y~1", 1},
+    {"00:1200264", "00:1200264~rc1", 1},
+    {"10+00790bB0744", "0:10+00790bB0744", 0},
+    {"30", "0:30", 0},
+    {"1200784ZA", "1200784ZA+b1", -1},
+    {"10:4.", "00:7000212~0925B-1+Ab2", 1},
+    {"2:02+~YyZ9-10", "2:02+~YyZ9-010", 0},
+    {"2:1.:", "6zz-944985691036510686132288591534449910144440872669402607655", 1},
+    {"1:1110563100-.0406BB256", "1110563100-.0406BB256", 1},
+    {"1:101009991928048592000766+YA-100", "101009991928048592000766+YA-100", 1},
+    {"0aBzz643055767256587218896044866094634558693-.0", "10:0aBzz643055767256587218896044866094634558693-.0", -1},
+    {"01:1zyZ3622398800417976789345167679420byY9-a~00285.0454", "01:1zyZ3622398800417976789345167679420byY9-0a~00285.0454", 1},
+    {"11-~10--~", "0:11-~10--~", 0},
+    {"10200866AA0829AbB-+00786", "2:10200866AA0829AbB-+00786", -1},
+    {"00:6.070392-Zz849530427435781334392780247925656~", "00:6.070392-Zz849530427435781334392780247925656~~rc1", 1},
+    {"79a+-z99", "10:79a+-z99", -1},
+    {"1:11+.AA", "5+-10-Za", 1},
+    {"700014900962z100a-.00020Z", "700014900962z100a-.00020Z~", 1},
+    {"119900374-+082+1", "1YY", 1},
+    {"10698ayAZ.--+0094311+", "10698ayAZa--+0094311+", 1},
+    {"2:11.~0Zab-~00074211b47184789398103816946565", "2:11~~0Zab-~00074211b47184789398103816946565", 1},
+    {"025645452632018006635654500665865663950-+039.", "0:025645452632018006635654500665865663950-+039.", 0},
+    {"11YB00787Y00686098-.0~", "11YB00787Y00686098-0.0~", 1},
+    {"01:0+-.", "01:0+-~", 1},
+    {"7byb", "7byb~1", 1},
+    {"0Azz~50620395572442102091884074500797-1+3482930441978855017972556798251Aba", "2:2by", -1},
+    {"01:01-+AB", "01:01-+ABa", -1},
+    {"10Zay", "2:10Zay", -1},
+    {"1Zzb--0109+000526.000249", "10:1100503002196657667812854496955422", -1},
+    {"01:811-~0047.YBBy", "01:811-~0047.YBBY", 1},
+    {"0:111-6146991195496967269435769400708bAa", "0:111-6146991195496967269435769400708bAa.", -1},
+    {"86021069609593857827073775591213374286649828362619854837122505043.-bA~1b100", "0:86021069609593857827073775591213374286649828362619854837122505043.-bA~1b100", 0},
+    {"12BzZ.00021657550146992550476235831", "12BzZ.000216575501469092550476235831", -1},
+    {"5Bzy0590018310-2bBB10aYz+", "5Bzy0590018310-02bBB10aYz+", 0},
+    {"139~-+43423072228246375687620259965656112bYy", "01:91-1406173720607485852097551007332+255", -1},
+    {"51001008647069303099425759973654YZzb-632179735932707251024817yZZ1", "10:51001008647069303099425759973654YZzb-632179735932707251024817yZZ1", -1},
+    {"4++B00086+", "4++B00086+~a", 1},
+    {"0bya255-.A+3", "0bya255-0.A+3", 1},
+    {"0:4y256+~-yz", "0:4y256+~-yz~a", 1},
+    {"1100675Aay000109-.10087075719690717888771290657", "1100675Aay000109-~10087075719690717888771290657", 1},
+    {"4000509~00306-bY+z", "3~1-YB~25500370", 1},
+    {"5~~-+zba2", "5~~-0+zba2", 1},
+    {"2:7-000961:-B.00073", "2:7-000961:-B.00073~a", 1},
+    {"53-10", "0:53-10", 0},
+    {"2000157ZB-000838bz", "2000157ZB-0000838bz", 0},
+    {"12+0464+.zy-.", "12+0464+.zy-.~~", 1},
+    {"01:1199yZ000448-000268255~", "01:1199yZ000448-0000268255~", 0},
+    {"1000564+~+-Yzz256+Bz.", "1000564+~+-Yzz256+Bz..0", -1},
+    {"10+-.0114AYb+YBA", "310-00076b9.", -1},
+    {"12~04216630896634503849762112519062691-0851041700238", "1:12~04216630896634503849762112519062691-0851041700238", -1},
+    {"4y+~10AA", "4y+~10AA-1-1", -1},
+    {"1010000306+aay359205970055619484352492638381413737", "1:1010000306+aay359205970055619484352492638381413737", -1},
+    {"00:900095661368479683241494145256-256", "00:9000195661368479683241494145256-256", -1},
+    {"6ABZ.100BbA-00270", "6ABZ.100BbA-000270", 0},
+    {"01:3yBA+057009390610-.B~000767", "01:3yba+057009390610-.b~000767", -1},
+    {"6yAYAB00610-+21", "4-255+0-0127", 1},
+    {"10.YB0643Bz+-000878~67423995474813513147467773", "10.YB0643Bz+-000878~674239954748135131474679773", -1},
+    {"2~0223Z", "02~0223Z", 0},
+    {"3A-aa~9zy+", "3A-0aa~9zy+", 1},
+    {"1:10656256A01788003300367682071267356968007571823617029-.0211.6779168806378971461089705664705063923832+", "1:10656256A01788003300367682071267356968007571823617029-.0211.6779168806378971461089705664705063923832+~rc1", 1},
+    {"9yB00071000585-9005110364", "9yB0007100058005-9005110364", -1},
+    {"6ay-Z~", "6ay-z~", -1},
+    {"11Zy-A~", "11ZY-A~", 1},
+    {"2ZY86577966723343498082161BA256-.YY.739264045142158329750640663366308", "2ZY86577966723343498082161BA256-0.YY.739264045142158329750640663366308", 1},
+    {"6.-zY", "6.-ZY", 1},
+    {"1:8+100-Zy+000778", "1:8+100-0Zy+000778", 1},
+    {"00:3z~-001220852", "00:3z~-0001220852", 0},
+    {"5000564YaY00050800133", "5000564YaY00050800133~1", 1},
+    {"925511Bzy2290763414037219469293465530605821-100255836881286932303391381942547177015714283", "925511BZY2290763414037219469293465530605821-100255836881286932303391381942547177015714283", 1},
+    {"01:0:11-256a", "01:0:11-256a~~", 1},
+    {"6+zzA482815498406878229935135689162-.", "6+ZZA482815498406878229935135689162-.", 1},
+    {"1:677039734806262371382-B-280309112165053349545259y255", "677039734806262371382-B-280309112165053349545259y255", 1},
+    {"1:1:--~255.", "91:1:--~255.", -1},
+    {"2.100-zyY+a", "2.100-zyY+a~rc1", 1},
+    {"34983188615825261414285669800392", "34983188615825261414285669800392~~", 1},
+    {"1:4+0095AA", "4+0095AA", 1},
+    {"12696610341453126101899703240121Z3-+~2560255", "0:12696610341453126101899703240121Z3-+~2560255", 0},
+    {"3az-0615yBB", "3az-0615yBBA", -1},
+    {"0+bYYaZ-62184156632291860190070051467+", "0:0+bYYaZ-62184156632291860190070051467+", 0},
+    {"01:9027899:zB-9481700169065109594457519675099699155176360239976559572473189833630849957", "10:9027899:zB-9481700169065109594457519675099699155176360239976559572473189833630849957", -1},
+    {"10.~2797010392522936201304770930358958342~", "10.~2797010392522936201304770930358958342~.0", -1},
+    {"1:400993+Yz96277205068735619534334905630193011-zza99100bA", "1:400993+YZ96277205068735619534334905630193011-ZZA99100BA", 1},
+    {"10:12.-Yb0531", "3.0830-25600282Bz1017994918092155239180971057", 1},
+    {"5256++0110", "0~0284+-000630Y", 1},
+    {"12-B100994-ZB", "12-0B100994-ZB", 1},
+    {"10:402559-79578028059635691317", "10:402559-79578028059635691317A", -1},
+    {"8000418", "2bbY~2zya", 1},
+    {"9Aza3008733-.+.~y", "9AZA3008733-.+.~Y", 1},
+    {"112zAz..Az", "3yB0003832563", 1},
+    {"1100077095101", "1100077095101-1-1", -1},
+    {"2:123:-bzy.", "10:5bza-zBa0~", -1},
+    {"33622048711293829118934365531000950-yy", "33622048711293829118934365531000950-yy~~", 1},
+    {"01:12256Y-~000369", "10:12256Y-~000369", -1},
+    {"1:25217995870774544821975806980261833797-3~100+", "25217995870774544821975806980261833797-3~100+", 1},
+    {"5.+a~-0171", "0:5.+a~-0171", 0},
+    {"7a99-yAyyB9", "7a99-yAyyB9~a", 1},
+    {"0000399-BB325635799239377910580950773+10", "0000399-BB3256357992393779190580950773+10", -1},
+    {"40008861~.", "40008861~.-1-1", -1},
+    {"10zYy00896-083800013700913BYb000348", "1100874ZaA", -1},
+    {"10:8~a+3", "10:8~a+3~~", 1},
+    {"100652YY1+-0.000516.", "2~106313804358640764369294--9+99", 1},
+    {"91+99", "1:91+99", -1},
+    {"11+Z--938978297642959328748372806+", "11+Z-0-938978297642959328748372806+", 0},
+    {"1111~0972-b000905B", "0:1111~0972-b000905B", 0},
+    {"8bYBzZAbYZB.-100y", "0:8bYBzZAbYZB.-100y", 0},
+    {"4-901372398435944028621755086727183859530~-Ybb10yyy", "10:4-901372398435944028621755086727183859530~-Ybb10yyy", -1},
+    {"0000200.yYa-AYz0+", "0000200.yYa-AYz0+A", -1},
+    {"01:109422117023935493955458848.-256aBz", "01:109422117023935493955458848.-256aBz~a", 1},
+    {"3aA~.-aYb~000475Ybb", "3aa~.-ayb~000475ybb", -1},
+    {"10:4243534219978958584620997000209-0889-1a", "10:4243534219978958584620997000209-0889-001a", 0},
+    {"2bzZ~", "5~-~10010", -1},
+    {"4YYbBYZ", "4YYBBYZ", 1},
+    {"12ZYy-Ab855286169218049986190775454799z~~", "12ZYy-Ab855286169218049986190775454799z~~~1", 1},
+    {"80553b11.--0554~1", "0~b--999", 1},
+    {"11aBA0057-aB000867", "11aBA0057-aB000867+b1", -1},
+    {"816963438681205373049853103555528615622560Z-0181~0042500546", "8169634386812053730490853103555528615622560Z-0181~0042500546", -1},
+    {"48729166982460429279400316332560663+zAyy100-+B000154+", "487291616982460429279400316332560663+zAyy100-+B000154+", -1},
+    {"10:8By.:+-.", "10:8Bya:+-.", 1},
+    {"01:79912496718707455015556309162050310-00771", "1:79912496718707455015556309162050310-00771", 0},
+    {"5bY", "10+057606369-AbAb+.", -1},
+    {"400435-zzA~", "504840100B-~000999", -1},
+    {"120042459239394939684588407125213377006085-110004693~BZy", "2:120042459239394939684588407125213377006085-110004693~BZy", -1},
+    {"01:9-.:-+256", "10:9-.:-+256", -1},
+    {"3948831820470893615184825437256000144aAB-256", "3948831820470893615184825437256000144aAB-256~1", 1},
+    {"122a~--0A.", "122a~-0-0A.", 0},
+    {"5~3zAA000711-~9000656", "5~3zAA000711-~900000656", -1},
+    {"00:6yBZAZ9649545489917446277146983248865570090044597207938571387557915807877825-66857046691300734244617832581ybY", "00:6YBZAZ9649545489917446277146983248865570090044597207938571387557915807877825-66857046691300734244617832581YBY", 1},
+    {"122~7773650792585472495908589278790116264257Zza-Y", "0:122~7773650792585472495908589278790116264257Zza-Y", 0},
+    {"12z61732069843021617937934204yA-AzaAb25510yZY", "12z61732069843021617937934204yA-AzaAb25510yZY-0", -1},
+    {"2:90732y:", "2:90732y:-1-1", -1},
+    {"2:9:0455~", "2:9:0455~.0", -1},
+    {"10:019209683850895760226230210907947366410173B", "10:019209683850895760226230210907947366410173B~1", 1},
+    {"12baA+-zyb-255", "12baa+-zyb-255", -1},
+    {"01:10000866.2az000339", "10000866.2az000339", 1},
+    {"4bA-~ByZ", "4bA-~ByZ~rc1", 1},
+    {"2+099", "12+099", -1},
+    {"10:11A~.0125-+.9", "01:6.3272030701793678449232206104.BAA-BY", 1},
+    {"01:90687-3-+.", "10:90687-3-+.", -1},
+    {"6ABZ00097", "6ABZ00097a", -1},
+    {"1217737990777718568088855846744~+0289", "0:1217737990777718568088855846744~+0289", 0},
+    {"40271-.", "0:40271-.", 0},
+    {"6063459640913478777805329351-911119BAY", "6063459640913478777805329351-911119BAY~a", 1},
+    {"10:309783+-Y31871799776353778690078720788~000956", "309783+-Y31871799776353778690078720788~000956", 1},
+    {"829900419yZ-.32320458805870449727336668365282933", "00829900419yZ-.32320458805870449727336668365282933", 0},
+    {"01:4:11-~", "001:4:11-~", 0},
+    {"4--.00679255bab", "4--.00679255bab+", -1},
+    {"01:69y00037000090", "10Y.YAABB-+", 1},
+    {"3..BB-.YB1000754", "3..BB-.YB1000754~a", 1},
+    {"5ZBY221948558896936197762232000684-ab+08821", "5ZBY221948558896936197762232000684-AB+08821", 1},
+    {"121+-954247003400990263452531989351", "1:121+-954247003400990263452531989351", -1},
+    {"12.2", "7.--~256", 1},
+    {"2:8994533240606145867630925212916312093223661057286756034791665307194928646870:0585zbA", "2:89945332406061458676309252129163120932236691057286756034791665307194928646870:0585zbA", -1},
+    {"8z-.2", "8z-0.2", 1},
+    {"01000383Y978224327970136954538985-.Ay", "01000383Y978224327970136954538985-0.Ay", 1},
+    {"1:7:2560264.-21407178958817677190125315974AB", "1:7:2560264~-21407178958817677190125315974AB", 1},
+    {"20791ZZY", "20791ZZY~a", 1},
+    {"72.", "72~", 1},
+    {"00:87336909437125429918793800073589517109634bb-~9aB", "00:87336909437125429918793800073589517109634bb-~9aB~1", 1},
+    {"79-10--6035602863180896696114", "79-10--6035602863180896696114~a", 1},
+    {"1034049674676606561504715575582814894y0907a-000857BayB", "1034049674676606561504715575582814894y0907a-0000857BayB", 0},
+    {"03949446449558172082031815-ayb6764042814461606097-zBz256.", "03949446449558172082031815-AYB6764042814461606097-ZBZ256.", 1},
+    {"0:700534-10006301100420", "031~000179-~yZy+yb", 1},
+    {"12zyB60538196440068130857370.00348000783-11~2~000243", "12zyB60538196440068130857370.0.00348000783-11~2~000243", 1},
+    {"0B~-zY~2870794479876216434101982001328211", "0B~-zY~28707944179876216434101982001328211", -1},
+    {"0:3aab-23BZ", "0:3aab-23BZ+", -1},
+    {"10:4+0016999-~22051959605006673245769806904702876~", "10:4+0016999-~22051959605006673245769806904702876~~rc1", 1},
+    {"10100~", "10100~.", -1},
+    {"1197487937766379086848~000682.3-00004420007681", "2:1197487937766379086848~000682.3-00004420007681", -1},
+    {"907679071277843057793259166900.3By-0067.", "2100.By255000616", 1},
+    {"91088590574584829437498824664639519535911-.1~7504045610351578140182", "91088590574584829437498824664639519535911-~1~7504045610351578140182", 1},
+    {"01:72", "72", 1},
+    {"9b-0499.", "2:9b-0499.", -1},
+    {"10:21008762056538127802391779560984488257441y+aaa-~", "10:210087620565308127802391779560984488257441y+aaa-~", -1},
+    {"2.-0003321.~", "2.-0003321.~a", -1},
+    {"7106783458740340095276532766264-A+~+", "710678345874034009527653276006264-A+~+", -1},
+    {"3.2560365.-11~.", "3.25060365.-11~.", -1},
+    {"1:1+90353194750382640632289675201743351181590519542273bY-+2560982", "1:1+90353194750382640632289675201743351181590519542273bY-+2560982~", 1},
+    {"00:12bYB11235318625988471080682865-zaB0101.", "00:12BYB11235318625988471080682865-ZAB0101.", 1},
+    {"0:7.zBY:.-ay~", "2:7.zBY:.-ay~", -1},
+    {"2:110604ZabBzYBZy", "1:110604ZabBzYBZy", 1},
+    {"01:12.687419369895399698769643799709385096-890162371798311682492393998147307aZ+", "01:12.687419369895399698769643799709385096-8901623971798311682492393998147307aZ+", -1},
+    {"6YbbA99~-Y99", "0:6YbbA99~-Y99", 0},
+    {"0Za", "90Za", -1},
+    {"8.~90780", "8.~90780~rc1", 1},
+    {"1000961+-~~Yz11000257", "1000961+-~~YZ11000257", 1},
+    {"42878143307709552308346775697862710034056.25500483~-y~00813", "0:42878143307709552308346775697862710034056.25500483~-y~00813", 0},
+    {"2:6.0-.", "2:6.0-.~~", 1},
+    {"2~0304Z99-AzA3", "0:2~0304Z99-AzA3", 0},
+    {"3~256-9911495081815259479386241576z", "3~256-09911495081815259479386241576z", 0},
+    {"01:0000332-00332bb.aAB", "01:0000332-003392bb.aAB", -1},
+    {"2+Ayy..--bza1", "2+Ayy..-0-bza1", 0},
+    {"10:0819160576698623457863107853623219565", "6+~YY5707426679809927940111950252073692Y-00268zb0317", 1},
+    {"2:78328573303450010196493684833851147323.ayB-0024499105404513257752358885093", "2:5~--AyZ2", 1},
+    {"01:60947110007772550285-31.", "01:60947110007772550285-31.~", 1},
+    {"2b0004580764", "10:2b0004580764", -1},
+    {"8YAY9753685608630876924985476034718421247697100a-35477443764841822322421615141327477zA002380", "8yay9753685608630876924985476034718421247697100a-35477443764841822322421615141327477za002380", -1},
+    {"12bBa7537415223941535293891840177-y-9904722485562857768738191", "12bBa7537415223941535293891840177-y-9904722485562857768738191a", -1},
+    {"100001410030-~9ya.99", "0:100001410030-~9ya.99", 0},
+    {"10100-+", "0:10100-+", 0},
+    {"10:11164308296441616821733~10300034-71198533145232940946", "10:11164308296441616821733~10300034-71198533145232940946.", -1},
+    {"10+AAY349321902155628921095045027-..4038875761299615773915969665568300+", "10+AAY349321902155628921095045027-.0..4038875761299615773915969665568300+", 1},
+    {"1:11011-yZ", "2:4BZ2Zz00680-1238284451629275865585221187", -1},
+    {"1520223938811453248128194bY11yA", "1:1222.yz-11.", -1},
+    {"6+B", "6+B~~", 1},
+    {"2:80076599-b+.YAB", "2:80076599-b+.YAB~~", 1},
+    {"10413075265737162804983827789988370520726309605991472951", "10413075265737162804983827789988370520726309605991472951~a", 1},
+    {"10:1388241015609740117078929808540761006992749215521294264688Aaz-.~3~00295", "10:1388241015609740117078929808540761006992749215521294264688Aaz-a~3~00295", 1},
+    {"3YYy32480179273523444845546610758350599910332~~-+az~2", "3YYy32480179273523444845546610758350599910332~~-+az~2~rc1", 1},
+    {"10~.000544-102", "7~.z000444--9", 1},
+    {"1:10:-YbAy.", "1:10:-0YbAy.", 1},
+    {"10:1A110904", "10:1A110904~a", 1},
+    {"400838-255++00141yBA", "400838-0255++00141yBA", 0},
+    {"10:7+BZa~", "7+BZa~", 1},
+    {"10yzB-aAz-9000239000655~", "10yzB-aAz-900023900000655~", -1},
+    {"00B70368273252622209552800469", "0:00B70368273252622209552800469", 0},
+    {"21-2", "21-02", 0},
+    {"5255-AY11+831589662501152992056249542953785457", "50885.-.25634029293337005065583741825275zbZ1", -1},
+    {"2bBb-Y125874416514001763518467455545", "12.Ab3.+", -1},
+    {"008658088793594311996124~-Az.+", "008658088793594311996124~-Az.0.+", 1},
+    {"80137100084z-0007242559~000907", "80137100084z-0007242559~000907A", -1},
+    {"01:5910-11256", "01:5910-11256.0", -1},
+    {"11030333282903877495181099545087.10010-.11.~B", "11030333282903877495181099545087~10010-.11.~B", 1},
+    {"911.0ybA000687", "911+0ybA000687", 1},
+    {"01:8B29-10+~.~", "1:8B29-10+~.~", 0},
+    {"1:102559", "1:102559.", -1},
+    {"5000230255-256", "0:5000230255-256", 0},
+    {"4100Y+.+", "1:4100Y+.+", -1},
+    {"11027120865Za-yAb~", "0:11027120865Za-yAb~", 0},
+    {"2:1bb-3ZzBz158728924661550032788541671801998", "2:1bb-3ZzBz1587289246615500327188541671801998", -1},
+    {"3ZY1007398122727692980827962300.-0", "0:3ZY1007398122727692980827962300.-0", 0},
+    {"12zzyBA-.++", "00:4+abBAab2-3YaA+993", 1},
+    {"1:12Yb091100800-00916", "1:12Yb091100800-000916", 0},
+    {"12YYz~-0137+~", "12YYZ~-0137+~", 1},
+    {"01:41323-ByA", "01:41323-ByA+", -1},
+    {"90228-100582+zy000753", "0:90228-100582+zy000753", 0},
+    {"0y10-256b", "0y0010-256b", 0},
+    {"3~z+17643071610456087833363228873977-9", "60", -1},
+    {"7410260442216356799727714316702301169085ZBb-+00161-61647884172411615544196153363142481018812547844528970101751905313825591173", "7410260442216356799727714316702301169085ZBb-+00161-61647884172411615544196153363142481018812547844528970101751905313825591173~a", 1},
+    {"119byb9", "119byb9-0", 0},
+    {"9-yBB-~ZA", "99-yBB-~ZA", -1},
+    {"2:12Yz1004363528968924290172120994178344011-aZZ~B~", "484330368695342268517200711256", 1},
+    {"2-99-9900701Yz", "10.103", -1},
+    {"10:61.2562241105615348904904:-+100y", "2:61.2562241105615348904904:-+100y", 1},
+    {"0.", "0.~1", 1},
+    {"2:7:2.-255++", "7:2.-255++", -1},
+    {"10:700913963532536935922696325633814613094640299-000830..", "10:700913963532536935922696325633814613094640299-0000830..", 0},
+    {"0:0z.0958", "1:0z.0958", -1},
+    {"0:7~-100", "0:17~-100", -1},
+    {"2:2y100089700530-+~+~", "2y100089700530-+~+~", 1},
+    {"1bYyz0YA+-10bZz+", "1bYyz0YA+-010bZz+", 0},
+    {"010000014600898+-00315", "1:5255~a-~99~10+", -1},
+    {"5Y+ab+-2", "5Y+ab+-2~", 1},
+    {"11+3456122728014029657447004663692547881532AbZ-ABA", "1:11+3456122728014029657447004663692547881532AbZ-ABA", -1},
+    {"7a0319430643457262778389633463", "1256-005899", -1},
+    {"11~-255bYA0741AZ59270542223356630962191835104", "11~-0255bYA0741AZ59270542223356630962191835104", 0},
+    {"7BaY-00024", "0:7BaY-00024", 0},
+    {"00:3:00702.9", "2:3:00702.9", -1},
+    {"11yyA.+-.0", "11yyA.+-.0+b1", -1},
+    {"12000781bz-Z~.", "12000781bz-Z~..0", -1},
+    {"6.1292390489588237450634727b256", "6.12923090489588237450634727b256", -1},
+    {"7000642~---000991..", "7000642~---00099001..", -1},
+    {"7~+yBZBA", "1:7~+yBZBA", -1},
+    {"01:11YB100.AyB-B.", "01:11YB100.AyB-B.~1", 1},
+    {"55154696493235693865437430772344005-.+", "55154696493235693865437430772344005-0.+", 1},
+    {"10:7b256-yZ00969Y", "10:7b256-yZ009619Y", -1},
+    {"9000942561-819112699989632089222848040541729477846010072490847128000148546969398255", "9000942561-819112699989632089222848040541729477846010072490847128000148546969398255~", 1},
+    {"7~2~11-.00528Zz", "7~2~11-0.00528Zz", 1},
+    {"8902180369~", "0:8902180369~", 0},
+    {"0:10a~-54605814081508127211558a9", "0:10a~-549605814081508127211558a9", -1},
+    {"10bbaZ~.", "10bbaZ~.0.", -1},
+    {"23-~+5387125877576449191870903061Zay", "23-~+53871258775076449191870903061Zay", -1},
+    {"8+00839-~+.0580", "8+00839-~+.0580a", -1},
+    {"6YYY30008490757-00735", "6YYY30008490757-00735~1", 1},
+    {"911+", "911+~a", 1},
+    {"8Ay", "8Ay-0", 0},
+    {"6200267+zA+-00763.", "620020067+zA+-00763.", -1},
+    {"1Ayz-046611000346", "1:1Ayz-046611000346", -1},
+    {"01:5bY11-~-~.99Bz", "01:5by11-~-~.99bz", -1},
+    {"2..000871", "2..000871~a", 1},
+    {"7..-00500491y.~", "7+.-00500491y.~", 1},
+    {"0bYA0754-000673bAzYz~", "0bYA0754-000673bAzYz~~a", 1},
+    {"4Zb9-+", "4Zb9-+-1", -1},
+    {"10:900397:-11BaB10zY", "10:90000397:-11BaB10zY", -1},
+    {"6+", "6+-1-1", -1},
+    {"2-99+100y-+", "92-99+100y-+", -1},
+    {"399~+-0.~a", "3199~+-0.~a", -1},
+    {"63+", "2:66914309459713400893185094128882aAZbAY-+", -1},
+    {"10:4a", "10:4a+b1", -1},
+    {"00:10~11-~+Z", "000:10~11-~+Z", 0},
+    {"2:1Bza:255:ZZ-~256.+", "2:1Bza:255:ZZ-~256.+~rc1", 1},
+    {"0Aaz.~7552890918753440986286013300239295-255~", "0Aaz.~7552890918753440986286013300239295-0255~", 0},
+    {"2ZY3~Z-+", "51+", -1},
+    {"70005134684140380699764935133032750", "79azZ", 1},
+    {"8z+.", "8z+.a", -1},
+    {"025611--aB", "025611--aB~~", 1},
+    {"01:90308Bz-A1100405255bbZ", "01:90308Bz-A1100405255bbZ.0", -1},
+    {"12b.zb2aBY-299~00796", "12b+zb2aBY-299~00796", 1},
+    {"3.zz-0", "3.ZZ-0", 1},
+    {"921568733607313847664995000603-Yab256.3100", "9215687336073138479664995000603-Yab256.3100", -1},
+    {"10BZy-+21546549082863925575708100441360652864511", "10BZy-+21546549082863925575708100441360652864511~~", 1},
+    {"1:7+.-~100", "91:7+.-~100", -1},
+    {"9249296689910636508030963~-6694405923377562162..+", "9249296689910636508030963~-6694405923377562162..+~rc1", 1},
+    {"2:236113538855645962873701985.:-b100010000571", "01:1110-++Y", 1},
+    {"7z+3728151656314158627365935253306--ZZ0446.b.", "7z+3728151656314158627365935253306-0-ZZ0446.b.", 0},
+    {"01:2:-~.", "01:2:-0~.", -1},
+    {"3..0.aY-BY~.", "3..0.aY-BY~.~~", 1},
+    {"10BBb-a2569155805192501239513112075910091640~.", "10BBb-0a2569155805192501239513112075910091640~.", 1},
+    {"00:9yB-0210", "00:9YB-0210", 1},
+    {"62~1bbz+", "62~1bbz+-1-1", -1},
+    {"00:500233", "500233", 0},
+    {"6~~", "7B+03823-.0+359247981894957852305003196977ZAB", -1},
+    {"23726234991420607570-BYB+40532173843845850928442410251242", "2:23726234991420607570-BYB+40532173843845850928442410251242", -1},
+    {"01:72.YZA-+011~.", "6.1.-10BYy.000379a", 1},
+    {"0:1:bA-Bb-.zzy255", "1:bA-Bb-.zzy255", -1},
+    {"00735yyz", "00735yyz~~", 1},
+    {"3~00022900403aB2-yyzyZ00", "000816-.+ByB", -1},
+    {"10:7:~~256-~00226b", "3+-ayzZA", 1},
+    {"6256+zAz-0056800353.", "2:3256-bz00752zZ+", -1},
+    {"00:9000224Aby-37353185446602272488883084179910", "00:9000224Aby-37353185446602272488883084179910-0", -1},
+    {"8100+aa-0~", "10:8100+aa-0~", -1},
+    {"10:3AAyY10.-256", "10:3AAyY10.-256-0", -1},
+    {"01:5.+000856-10+100aa", "01:5.+000856-010+100aa", 0},
+    {"11By00795-ZAYaa+", "11By00795-ZAYaa+a", -1},
+    {"2100B0~-YbBa", "2100B0~-YbBa~~", 1},
+    {"12++yzz000162", "00:9--256+26978727784135315728888BZ", 1},
+    {"0~ZYz0058599zB-10Z31+", "0~ZYz00518599zB-10Z31+", -1},
+    {"20025010+-+", "0:20025010+-+", 0},
+    {"7~-255Z100", "7~-20055Z100", -1},
+    {"6~.y256ZyY-+9.100", "6~.y256ZyY-+9.100-0", -1},
+    {"12--bZb000457", "0:12--bZb000457", 0},
+    {"1+~..", "0:1+~..", 0},
+    {"1200127ayb29261251979553553464442-BA000730.518747159221731234579154", "1200127ayb29261251979553553464442-BA000730.518747159221731234579154-1", -1},
+    {"1011bYZ~-9647709512441313576830242680738736YyZ", "1011bYZ~-96147709512441313576830242680738736YyZ", -1},
+    {"48104938070296525056159--894815834349772174714546310", "48104938070296525056159-0-894815834349772174714546310", 0},
+    {"2:10b-0892", "2:10b-0892+", -1},
+    {"4b-0", "4b-0~1", 1},
+    {"7000611-2", "7000611-02", 0},
+    {"63.3.", "63.3.-1-1", -1},
+    {"8-78774376568375449882-B0", "8-78774376568375449882-B0~1", 1},
+    {"11.+00901-255000122~.", "11.+00901-255000122~.~~", 1},
+    {"10:10YYZ00335-YYy", "10:10YYZ00335-YYy~", 1},
+    {"1:297138415335161401225000069026314999AAY-Yz-.AZ~0219a", "1:29713841005335161401225000069026314999AAY-Yz-.AZ~0219a", -1},
+    {"974749262832921288291073306438151120450654aY-07191", "974749262832921288291073306438151120450654aY-07191~1", 1},
+    {"10:7+~00354-034210", "10:7+~00354-034210~a", 1},
+    {"1:525625600140", "525625600140", 1},
+    {"01:4~a304449767093100521481462580007056809175331", "4~a304449767093100521481462580007056809175331", 1},
+    {"11100-~~~yYz", "9Y00034110-00359931364813608804956519602yzzYY", 1},
+    {"1:11~+yy", "1:11~+yy-1-1", -1},
+    {"1:1Byy256.-ab+1bB", "1:1BYY256.-AB+1BB", 1},
+    {"10:1BbyB0016-0025A+zA", "10:1BbyB000016-0025A+zA", 0},
+    {"10:70008673A", "10:700008673A", -1},
+    {"2:11.Bb00013aZazY-ABZ+BZ~+", "2:11.0.Bb00013aZazY-ABZ+BZ~+", 1},
+    {"104780855937793670289664056912922849.-~++2", "104780855937793670289664056912922849.-~++2~", 1},
+    {"10:10006759853400880340206736079+7401593304418681764217198610~", "10:10006759853400880340206736079+7401593304418681764217198610~~1", 1},
+    {"199-BAa", "199-BAa~rc1", 1},
+    {"3764582568688285075620634812.byB9911-100002+~", "3764582568688285075620634812.byB9911-100002+~~1", 1},
+    {"5000707+~6784696376931055353800822789B-~949795390516712416815280325803438~", "5000707+~6784696376931055353800822789b-~949795390516712416815280325803438~", -1},
+    {"8000354Yzab", "98000354Yzab", -1},
+    {"0:8Yb", "0:8Yb.0", -1},
+    {"61100560Ayb13500375540811551062202585011", "10:61100560Ayb13500375540811551062202585011", -1},
+    {"09BYA+0071~", "09BYA+0071~-1-1", -1},
+    {"2:10BzYZ", "2:10BzYZ.0", -1},
+    {"84422832440886694342608.000216-.06310000815~", "1:84422832440886694342608.000216-.06310000815~", -1},
+    {"1.3+Aa-9b", "1.3+AA-9B", 1},
+    {"1AaA-000694BZYYA050200745", "1AaA-000694BZYYA050200745+", -1},
+    {"1:9Y103", "1:9Y103a", -1},
+    {"1B0467~-367404896662442195118", "0:11287678040954924655803162681284~aZB+aZY", -1},
+    {"8Bb00639BaB-+a000616", "8Bb00639BaB-+a0000616", 0},
+    {"2:7y+:-+.+", "00:12000128aAaZBY--94583116431980924048256016739284702570..", 1},
+    {"2:410ba-A", "2:410ba-A~", 1},
+    {"12.05080086300269", "10:4z0145.10010844795168513784495129562351", -1},
+    {"81+9", "81+9-1-1", -1},
+    {"8+b-2.abYBY", "8+b-2.abYBY~a", 1},
+    {"6300539~-Azz255y000388", "6300539~-Azz255y000388+", -1},
+    {"90", "90-0", 0},
+    {"210899242506716801461730573583393+-.", "210899242506716801461730573583393+-~", 1},
+    {"1:39", "1:39~", 1},
+    {"1:4.", "1:4.A", -1},
+    {"01:4zb~azBaz-0839Z00270255", "01:4zb~azBaz-0839Z00270255~1", 1},
+    {"12+ZZ0008299-99bAYY~", "1:12+ZZ0008299-99bAYY~", -1},
+    {"10:1.901911198257009799535736932331382522", "10:1.9019111982570097995035736932331382522", -1},
+    {"01:5+-~00995255bz", "01:5+-~00995255bz.", -1},
+    {"10256a+-100861090661820231047403226962155069019~.", "5000795~-bbz5672675697515704382256380", -1},
+    {"1~-3AYa", "11~-3AYa", -1},
+    {"2256000153+-100A3", "2256000153+-0100A3", 0},
+    {"01:1000710Yya.AZ-255.", "01:1000710Yya.AZ-0255.", 0},
+    {"2039899106327885877626626763770357440AY957857670618036822189045302681036", "1:2039899106327885877626626763770357440AY957857670618036822189045302681036", -1},
+    {"12++", "12+++b1", -1},
+    {"000038418755022626858229830-++", "10:000038418755022626858229830-++", -1},
+    {"7.B099", "2:7.B099", -1},
+    {"800048290882-bByB+170395480150179319087584672442199594757", "800048290882-bByB+170395480150179319087584672442199594757-1", -1},
+    {"0:999256:0540:-1125600365BZY", "0:999256:0540:-1125600365BZY~rc1", 1},
+    {"01:81111b-3b", "01:81111b-03b", 0},
+    {"5-YY83437362407251325359580105925564578-ZAA", "5-YY834373624072513253595801059255164578-ZAA", -1},
+    {"00:9-9~a-aBbb+3", "1:9-9~a-aBbb+3", -1},
+    {"11AB.", "11AB.a", -1},
+    {"20055011-Yab.", "2000055011-Yab.", -1},
+    {"10-0615101-.yZA", "1:10-0615101-.yZA", -1},
+    {"1099Azb-~", "0:1099Azb-~", 0},
+    {"800556-100-Zb", "110+377548748316244850581189-yYAYbz", 1},
+    {"00:90-0012716305740900030864883000-100", "00:90-0012716305740900030864883000-100~~", 1},
+    {"2:3652614806971387352926593842257Z9900869-3.", "10:10+11.-~", -1},
+    {"00-62422474249922131835620bZA", "00-62422474249922131835620bZA~1", 1},
+    {"10-0028-ZZ99+256", "10-0028-ZZ99+00256", 0},
+    {"0:00007423235224595233851730915370088474906956AA100-1049023596911362854055142810188203.", "0:00007423235224595233851730915370088474906956AA100-01049023596911362854055142810188203.", 0},
+    {"01:20001353", "1115874084006984357633452180673858511BBz", 1},
+    {"01:6ZAA1645663282524087688", "01:6ZAA1645663282524087688A", -1},
+    {"1:90~-7056899720551549239609252646869", "2:90~-7056899720551549239609252646869", -1},
+    {"4++~", "94++~", -1},
+    {"93Ya00868~00069", "10abB1A--BA", 1},
+    {"1:9.0AYBZb-zZB+YZ", "4-YA9408167034468958748665121974199344ABB-112811615751378034171804244603611", 1},
+    {"2~.2Aby000122-299147974168395294469591878291310100Yz", "00:6~~:256000497-90821bzz", -1},
+    {"0aYz16488231628805762084-b", "0aYz16488231628805762084-0b", 1},
+    {"4AA-2298499691587484010346285299045554974280+008510", "4aa-2298499691587484010346285299045554974280+008510", -1},
+    {"01:6AaY1.--~", "0:3zb000920zBBza", 1},
+    {"1:4BAy", "1:4BAy~a", 1},
+    {"1B00244-~0444~10", "1B00244-~0444~10~", 1},
+    {"10:0AZz-00198005692673031678416346287100920.", "10:0AZz-00198005692673031678416346287100920.~", 1},
+    {"9410218854639555094224818892498536358645bb03.-256", "9410218854639555094224818892498536358645bb03.-256A", -1},
+    {"10:12256-000394", "1:12256-000394", 1},
+    {"8+", "8+-1-1", -1},
+    {"00:11+-432718024970356610217382918724347905607Ayzb-+", "00:11+-432718024970356610217382918724347905607Ayzb-+-1", -1},
+    {"2:4Z-99", "110714256B0007050125-9", 1},
+    {"0byy", "1:0byy", -1},
+    {"7+-.", "1:7+-.", -1},
+    {"6256Z-0352bYZ", "10:6256Z-0352bYZ", -1},
+    {"3-00063-2.~.", "3-0000063-2.~.", 0},
+    {"4~00301.-~100109.", "4~003091.-~100109.", -1},
+    {"112YyA--~+", "0Zzazb~-448915426997214196207923617~a537335432347435389524613387687445281", 1},
+    {"0.255BzaBy", "2:12:256-AZ.~a", -1},
+    {"8+Yb990004421-0360.54456040331047853298957147345000879~", "10:8+Yb990004421-0360.54456040331047853298957147345000879~", -1},
+    {"00:511.Z.241582535408054310978-000210", "00:511+Z.241582535408054310978-000210", 1},
+    {"12+-00367-yy33602345406160483673243241986232377129b.00773", "12+-00367-yy336023495406160483673243241986232377129b.00773", -1},
+    {"0.000203+", "0a000203+", 1},
+    {"119256--y+3255000627", "119256--y+325500062007", -1},
+    {"0:1111-000654bA.+", "1111-000654bA.+", 0},
+    {"7~0~.", "7~0~.-1-1", -1},
+    {"1:4yb00308A-+00610.YZ000491", "1:4yb00308A-+00610+YZ000491", 1},
+    {"1755899704696194403280214917508771", "17558991704696194403280214917508771", -1},
+    {"10073-AzYbBy", "2:10073-AzYbBy", -1},
+    {"2:8000889450160988561041782806000170", "2:80008894501609885610417828006000170", -1},
+    {"300-ZBA00226~.256", "300-ZBA00226~.0.256", 1},
+    {"2b+.000948~-+256~", "2:2b+.000948~-+256~", -1},
+    {"1100512~~0", "1100512~~0~rc1", 1},
+    {"0Yb+776446046793088685029054878270-bBB", "0Yb+776446046793088685029054878270-bBB.", -1},
+    {"0:010:99aY-Z100000537aB.", "0:010:99aY-Z100000537aB..", -1},
+    {"21", "21~rc1", 1},
+    {"1297691699833175884442860-0210", "1297691699833175884442860-0210~rc1", 1},
+    {"2:1100212a100-5362996777146981383793436043586", "2:1100212a100-5362996777146981383793436043586~rc1", 1},
+    {"3zz-1+~00971", "2:3zz-1+~00971", -1},
+    {"11-.BZb-9.++2", "01:410-:ZYy9-b3za255", -1},
+    {"920012788483432832858008761bAY2408856153381348911329062721972485059386-3", "1:0YZAa.zZ", -1},
+    {"9B-.+BByzB", "9B-.+BByzB~", 1},
+    {"1025603~", "10256003~", -1},
+    {"3z~256", "3z~256-1", -1},
+    {"1100053000487.-+00314.", "11542796416672093758109zB", -1},
+    {"4BAZZ-11", "4BAZZ-11-1", -1},
+    {"8255-00072300148000447", "8255-00072300148000447~~", 1},
+    {"82044+-.105783158705021522468941552", "0:82044+-.105783158705021522468941552", 0},
+    {"1000781aBZ+ayzzz-256", "1:1000781aBZ+ayzzz-256", -1},
+    {"12~.-92633384585119607547905832078849716455yAa+", "2:12~.-92633384585119607547905832078849716455yAa+", -1},
+    {"7+000126BY", "0:7+000126BY", 0},
+    {"00:8+2552915736584550721476067120576:", "00:8+2552915736584550721476067120576:-0", 0},
+    {"10ZyA~627618817460510242680385019726842052343000159-yBZ", "10ZyA~6276188174605102426803850197268420523430001519-yBZ", -1},
+    {"2:10256~873769651509110905092514552123820243020+-768164861365139227134353460695613003465315820341511361936895976585190837140+1960418165486989658463263695533600167", "10:10256~873769651509110905092514552123820243020+-768164861365139227134353460695613003465315820341511361936895976585190837140+1960418165486989658463263695533600167", -1},
+    {"8+2by.-.3", "2:8+2by.-.3", -1},
+    {"0bAA-z~", "0bAA-z~~rc1", 1},
+    {"0:121zab99", "0:121zab99-1", -1},
+    {"119.00385-00210AZ", "119+00385-00210AZ", 1},
+    {"10-10217508777485305815655zAZ-58456046333211789136804505051340584410+100~", "10-10217508777485305815655zAZ-58456046333211789136804505051340584410+100~~a", 1},
+    {"7aY000821B10--~bAAy~", "2:7aY000821B10--~bAAy~", -1},
+    {"7-164338785723578792445645951686AzB~.-0390153592007306943273901666957683572787", "7-164338785723578792445645951686AzB~+-0390153592007306943273901666957683572787", 1},
+    {"1191", "1191~~", 1},
+    {"3-zA--.14345872995273005164720595", "3-ZA--.14345872995273005164720595", 1},
+    {"9000230-+++.00544", "9000230-+++.00544~1", 1},
+    {"7009431-0304", "2:7009431-0304", -1},
+    {"0~BZy+.bA-~Y", "0~BZy+.bA-~Y~a", 1},
+    {"2:9..+0818", "2:9.0..+0818", 1},
+    {"10:79362536904273643746248682466809100~.99-yZ", "10:79362536904273643746248682466809100~.99-yZ~~", 1},
+    {"5299aZbYA00769-100", "5299AZBYA00769-100", 1},
+    {"11A095.256-yyYaz.", "11A095.256-yyYaz.+b1", -1},
+    {"7100BZz", "7100bzz", -1},
+    {"200724bAy~-879218410287612652668687163707627238-10010~", "200724bAy~-879218410287612652668687163707627238-10010~-1", -1},
+    {"01:0bZa-7527597034208482992560106150837674002720039256010za", "2:0bZa-7527597034208482992560106150837674002720039256010za", -1},
+    {"9AbA+", "0:9AbA+", 0},
+    {"6255By-.azA1.", "06255By-.azA1.", 0},
+    {"700724+", "700724+A", -1},
+    {"1:7:b-.aYZ", "001:7:b-.aYZ", 0},
+    {"11Byyy-+", "11byyy-+", -1},
+    {"2z-az", "2Z-AZ", 1},
+    {"00:4000100A256y-+", "00:4000100A256y-+~", 1},
+    {"0:0+30229-+", "0:0+30229-+~", 1},
+    {"8.0YAbzy--00518", "8.0YAbzy--0050018", -1},
+    {"3ZbYyb+10", "01:2064635624765549593774028838735078914111+000540", -1},
+    {"8299--.00261592483400591421109418682708632346504322+", "3+B1", 1},
+    {"9a10010-..", "4ZAB-00190.b", 1},
+    {"0Zb++.", "000Zb++.", 0},
+    {"0:4-54408681515412880425-Ya256", "0:4-054408681515412880425-Ya256", 0},
+    {"2:7--aB.2100", "1:7--aB.2100", 1},
+    {"00271Aa", "01:1:", -1},
+    {"2AZ-709364280638583203492.106331437686016994710", "2:2AZ-709364280638583203492.106331437686016994710", -1},
+    {"01:11231-3176561216020619095266991004666305902118606346445760987599", "2:1zz0002100754Y-008797840568055014414567185065821yA", -1},
+    {"700150.0688~-9", "0:700150.0688~-9", 0},
+    {"2:3BBZ.a6405017707665232389722466124763310376~-ZAa", "3BBZ.a6405017707665232389722466124763310376~-ZAa", 1},
+    {"6.2550520092700566-~11", "69.", -1},
+    {"10:3421149640497131372950466010:255-Z12By.", "10:3421149640497131372950466010:255-Z12Bya", 1},
+    {"2:8006760346.-99AbY9ba~", "2:8006760346.-099AbY9ba~", 0},
+    {"01:101-0127", "01:101-0127-0", -1},
+    {"3~~-Bba+yBB.zz", "3~~-Bba+yBB.zz~a", 1},
+    {"1881075329834087917294150975070890051~0636", "10:1881075329834087917294150975070890051~0636", -1},
+    {"00:3Ybyy0yYa.", "00:3YBYY0YYA.", 1},
+    {"0:404620895-9931000308", "0:404620895-9931000308~", 1},
+    {"025599--.Y.", "025599--.Y.~1", 1},
+    {"73290365548454703604054446", "73290365548454703604054446~", 1},
+    {"12AzB000799-Y3815920147785840747694369736279982198418761058395778805733710037", "00:5933332332488070575619405476+-99", -1},
+    {"6100BaYB.-~13740239242527099637296854+00215", "6100BaYB.-0~13740239242527099637296854+00215", -1},
+    {"710", "710~rc1", 1},
+    {"7~-256107569447599553999724773", "7~-0256107569447599553999724773", 0},
+    {"8100336A", "8100336A-1", -1},
+    {"01:3+~Bz.-11+", "6++-9YA", 1},
+    {"7aZZY255000384-bza11.", "0:7aZZY255000384-bza11.", 0},
+    {"0A-9320009733919907741893770936391967688056", "0A-93200097339199077418937701936391967688056", -1},
+    {"01:2yYZ256-20087-445269603586460345032045094", "01:2yYZ256-020087-445269603586460345032045094", 0},
+    {"300047310010z-.0452.bZZ", "300047310010z-~0452.bZZ", 1},
+    {"100401-.", "281948543011160901051553204004522513370aya000497-b", -1},
+    {"6zZ~-+0006529.Yz", "6zZ~-+0006529.Yz-1", -1},
+    {"0AyY368680776759515184243449474148995743370001950", "0:0AyY368680776759515184243449474148995743370001950", 0},
+    {"11+.0255.-538331361900319488523370186913", "11+.0255.-538331361900319488523370186913~a", 1},
+    {"10:11100246000773-zBay998838398096794628967741403816284123989", "10:11100246000773-ZBAY998838398096794628967741403816284123989", 1},
+    {"80039024007538578208958455-bY271487171926321401907722329855", "80039024007538578208958455-bY2714871719263214019077220329855", -1},
+    {"63yA.BB-9", "63ya.bb-9", -1},
+    {"0y022425511", "0y022425511A", -1},
+    {"0100", "0100-1-1", -1},
+    {"01:3373124304208230319982862290503648596405091aYa-y476680014491125658384aA7694984028507963469149", "2:4AAz~0:-+~", -1},
+    {"10aYb.BBb~", "1:10aYb.BBb~", -1},
+    {"11YY1-0952-~.000495YB0353", "11yy1-0952-~.000495yb0353", -1},
+    {"0:2:.-+008882YYa9", "0:2:.-0+008882YYa9", 1},
+    {"2:5YaY-A-.", "1:5YaY-A-.", 1},
+    {"01:1YY", "01:1YY~", 1},
+    {"11~7655665651497664010660Yz-00741-zyAZ", "11~76556065651497664010660Yz-00741-zyAZ", -1},
+    {"0:03.00238", "0:03.000238", 0},
+    {"22550009bY00880", "22550009bY00880~", 1},
+    {"1211-2264910826335885927722176168081-8783754876706489137716345231284", "1:1211-2264910826335885927722176168081-8783754876706489137716345231284", -1},
+    {"1:9475676562055797901423501165-+", "1:947567656205570097901423501165-+", -1},
+    {"79+206655524653897119714488927855035+-~a~", "79+206655524653897119714488927855035+-~a~~", 1},
+    {"9yy", "9yy+", -1},
+    {"3+ZZaBYZZ-.1532660601871683363387189969648301484y", "2:3+ZZaBYZZ-.1532660601871683363387189969648301484y", -1},
+    {"10.9.-YBZBz++", "01:599.~99", -1},
+    {"00:7y.-Y86274035185240012330694796970440320492765092050703483955659726570", "1:5~:ayy0~-aAZb+Yy", -1},
+    {"1118179599840619278705000850b00532-~00240305985459955141945761933166~", "1118179599840619278705000850b00532-~00240305985459955141945761933166~~~", 1},
+    {"5ABYBb~0-20622b", "5ABYBb~0-206212b", -1},
+    {"3~9369925163573183163350407930834412367-1099", "2:3~9369925163573183163350407930834412367-1099", -1},
+    {"10z0914bB+", "10z0914bB+~~", 1},
+    {"11ZY10119459653216605308172178504259-~25610.ay", "11ZY10119459653216605308172178504259-~25610aay", 1},
+    {"10:99", "10:99-0", 0},
+    {"2:12Za.+0266", "12Za.+0266", 1},
+    {"1011+100000452", "1011+100000452+", -1},
+    {"0:9ABY2b", "0:9aby2b", -1},
+    {"01:5256:-9526171425312610164651688468497132454y256", "2:5256:-9526171425312610164651688468497132454y256", -1},
+    {"3000499.Baa..-~000736++", "3000499.Baa..-~000736++~rc1", 1},
+    {"89bz.044-Zy256azzbbZ3861322630026310732543554409", "89bz~044-Zy256azzbbZ3861322630026310732543554409", 1},
+    {"8aBZAYa000505z-10", "0:12az+--11", -1},
+    {"01:37222100441823567688825128870992-..", "00:700256Ya:~-a", 1},
+    {"1009bZz-YZy", "10:1009bZz-YZy", -1},
+    {"9y0082605173", "120080--BaYAZ", -1},
+    {"0:5bYybAb", "0:5bYybAb~~", 1},
+    {"7255+-~99000212", "1:3++a~yzB", -1},
+    {"6-B100-.~~", "6-b100-.~~", -1},
+    {"172347450012839227208337326991198204149402488~5791579591203881308051302350597306484974Bb-10", "172347450012839227208337326991198204149402488~5791579591203881308051302350597306484974bb-10", -1},
+    {"12.-99", "12.-99+b1", -1},
+    {"0B..--255~0803", "10Ab627427039519041480016949782261yA0-yzz+000444000437", -1},
+    {"4.007471002555389459435404251569090490567035-255AAY2", "4.007471002555389459435404251569090490567035-255AAY2.0", -1},
+    {"1:92560-012983379953276365196296648000~2", "1:92560-012983379953276365196296648000~2~rc1", 1},
+    {"01:11000883~9", "01:11000883~9-1-1", -1},
+    {"2~-bZY00072000439z000976", "2~-0bZY00072000439z000976", 1},
+    {"900095977966707917931683944363306334829000309000765-3", "900095977966707917931683944363306334829000309000765-3~rc1", 1},
+    {"1bz3~-6085468476727478287351779390936bzBBYZ", "1bz3~-6085468476727478287351779390936bzBBYZ~rc1", 1},
+    {"12022-1607375563453069446703650331", "10:12022-1607375563453069446703650331", -1},
+    {"01:32zA.415741161729238117080199208-256~790027818625734367094637540776774051951430724494491058855168210351226921862", "01:32za.415741161729238117080199208-256~790027818625734367094637540776774051951430724494491058855168210351226921862", -1},
+    {"01:12aB10:.9-212213944374435111727069609933216073", "10:12aB10:.9-212213944374435111727069609933216073", -1},
+    {"00:4:4896014709214679405989364+", "00:4:4896014709214679405989364+~1", 1},
+    {"60001950018ZA--yZaAa~0+", "60001950018ZA--yZaAa~0++", -1},
+    {"5aB-Y012255-0231", "5aB-Y012255-00231", 0},
+    {"2:6bza:", "2:6BZA:", 1},
+    {"10256-000706~-007552000448~", "10256-0000706~-007552000448~", 0},
+    {"01:69421474042128881893004803", "01:69421474042128881893004803.0", -1},
+    {"10:1079791027702419968633537228~B.00999", "10:1079791027702419968633537228~B.00999~rc1", 1},
+    {"1z112614527665118023172480782544582463210959255-~Zz.~", "0~-~~ZbZaz", 1},
+    {"2:51BZ-1000YZaz", "2:51BZ-01000YZaz", 0},
+    {"1111-~Bb-98572103498996898939612530888yz", "2:1111-~Bb-98572103498996898939612530888yz", -1},
+    {"5000423BaBY.-BZ588283612864401118284795622610920760074497890165396981", "5000423BaBY.0.-BZ588283612864401118284795622610920760074497890165396981", -1},
+    {"12+++", "1:12+++", -1},
+    {"4by256+bA3-+azy1102811134455792063571aYa0402", "0:4by256+bA3-+azy1102811134455792063571aYa0402", 0},
+    {"3.z~", "3+z~", 1},
+    {"1:0~255:-bBB", "1:0~255:-bbb", -1},
+    {"2~325951911398077211165492633418~520867278394857037912645965858255-~BBz", "2~325951911398077211165492633418~520867278394857037912645965858255-~BBz.0", -1},
+    {"3B2AByYaayz-a", "3B2AByYaayz-a~", 1},
+    {"2005932-+~-00900499476105161150814162316297321392290.", "0:2005932-+~-00900499476105161150814162316297321392290.", 0},
+    {"00833-+~+", "0:00833-+~+", 0},
+    {"8zZby3", "8ZZBY3", 1},
+    {"3Aa1", "13Aa1", -1},
+    {"0:200460ZAA344340411274667911528337884160284623250403Z-4741247659258429153023863008270", "1:200460ZAA344340411274667911528337884160284623250403Z-4741247659258429153023863008270", -1},
+    {"00:1082884818120930498784529327190448548407533300832", "00:1082884818120930498784529327190448548407533300832a", -1},
+    {"2:24409557907452797845392481256--A~", "2:24409557907452797845392481256-0-A~", 0},
+    {"1099~yYA+", "000087899--++3~~", -1},
+    {"1123-b38726127484045806783522682.", "10:76464942984235097505610167510000775::zy-~", -1},
+    {"9+zzy2yA-AZBbb.", "19+zzy2yA-AZBbb.", -1},
+    {"10AaZ899671827355367280041465166080144756+-2YzBB..", "10AaZ899671827355367280041465166080144756+-2YzBB..-0", -1},
+    {"2:1072849062312789132725859-255bbZ10", "2:1072849062312789132725859-255BBZ10", 1},
+    {"0:11bbY-9:1-~~4440982953016626805600005149397278", "113YY", -1},
+    {"8~Bb", "8~Bb~", 1},
+    {"12.yY~-0660.", "12.yY~-06690.", -1},
+    {"0255-.aZA", "1:0255-.aZA", -1},
+    {"1210099", "1210099~a", 1},
+    {"899Zya255~0583-00504ZzB0012", "899Zya255~0583-00504ZzB0012~a", 1},
+    {"3Y88703994257715017627~bb-BYz", "3Y88703994257715017627~bb-BYz~~", 1},
+    {"01334575817743389233254205458015-+000684", "01334575817743389233254205458015-0+000684", 1},
+    {"41000847", "0:41000847", 0},
+    {"1111-00723-100Y100YzA+", "1111-00723-100Y100YzA++", -1},
+    {"01:05573511492347250113457057211-Aa.034881873999449790040673666", "01:05573511492347250113457057211-Aa~034881873999449790040673666", 1},
+    {"0:90260255ZyY1", "0:90260255ZyY1~", 1},
+    {"1:3100Y+990044", "3100Y+990044", 1},
+    {"1017024801444332509255950--~100", "1017024801444332509255950-0-~100", 0},
+    {"10YYAZa+.-100", "10YYAZa+.-100a", -1},
+    {"8~.~ZBZ", "1:3.00837-..~3.", -1},
+    {"7-5321375255493549333318468186649412AZa.-~", "7-5321375255493549333318468186649412AZa.-~~rc1", 1},
+    {"1BBBz+-aa.00180Y", "1BBBZ+-AA.00180Y", 1},
+    {"4~100256yy0970-.0000809", "0:4~100256yy0970-.0000809", 0},
+    {"1:8bY", "11Bazy+.Y-y", 1},
+    {"8.+", "8.+.0", -1},
+    {"867698214678400744339874475155656292651z~~y", "2:867698214678400744339874475155656292651z~~y", -1},
+    {"2:6~", "2:96~", -1},
+    {"2001180656-+.2", "2001180656-++2", 1},
+    {"01:5by010", "01:5by010~", 1},
+    {"1Yyz-100~aa852648474516274107298305905110872AA", "1:1Yyz-100~aa852648474516274107298305905110872AA", -1},
+    {"1:11+-~+038092810", "1111ZAy2~", 1},
+    {"12000972--..99yBA", "12000972--..99yBA.", -1},
+    {"39.~00994-4626886756362050821725507854782454782y9", "39.~00994-4626886756362050821725507854782454782y9~1", 1},
+    {"1+-00794BZYb-100A", "1:1+-00794BZYb-100A", -1},
+    {"1:6256Z+7959752457861467361817250937-000898", "6256Z+7959752457861467361817250937-000898", 1},
+    {"8zAAz--000422~~", "10926484796463328045385366111-6613716501965732973.109", -1},
+    {"6+", "8.yyz-YzZBAB.255+", -1},
+    {"00:10:068500107bAazay-012800271", "10:068500107bAazay-012800271", -1},
+    {"64771604155125340495771003y.982358365004397846288692385343567262582-aBz1", "64771604155125340495771003y.982358365004397846288692385343567262582-aBz1~~", 1},
+    {"8~YA-8283093136435132184210581242467y-YB", "0:8~YA-8283093136435132184210581242467y-YB", 0},
+    {"7134048699956555920949-+-+", "7134048699956555920949-0+-+", 1},
+    {"5yz00728Z", "10:5yz00728Z", -1},
+    {"10:4.00423.9-+~a", "22559053524778455592258356451601164870214039653946152454140-3", 1},
+    {"6BzZz~00241-AayA+~0", "6BZZZ~00241-AAYA+~0", 1},
+    {"10:4b~0~3", "10:4b~0~3-1-1", -1},
+    {"0:7+0081-YZa-zzB.5531639106401091284303585108042596~3251446750565402003980944307567695603599", "0:7+0081-YZa-zzB.5531639106401091284303585108042596~3251446750565402003980944307567695603599+", -1},
+    {"0:8022010y+", "0:8022010y+~a", 1},
+    {"21.865538853422895199300567471860Zzy1", "21.865538853422895199300567471860ZZY1", 1},
+    {"2:1zz+98585937243510890961952075551791620178+", "7255002yz", 1},
+    {"01:6255.9-10-ZaB06542256B", "1:6255.9-10-ZaB06542256B", 0},
+    {"11993189419584904723043--0422.999", "11993189419584904723043--0422.999~rc1", 1},
+    {"5255+02330005860055", "6007170-99-z~", -1},
+    {"11bzz+006919", "911bzz+006919", -1},
+    {"011AZY255058~-382966741013061250531325072542+.", "00011AZY255058~-382966741013061250531325072542+.", 0},
+    {"8+-000226-450240364651322020692053~11", "8+-000226-450240364651322020692053~11A", -1},
+    {"1:12+:0478", "10:6azyA", -1},
+    {"10-~za+-11.yzb.2", "190-~za+-11.yzb.2", -1},
+    {"5~yAzYY000651-9099ABB", "5~yAzYY000651-9099ABB~a", 1},
+    {"00:9000144-.0001740733", "0ZaY", 1},
+    {"4Bbb1", "2:4Bbb1", -1},
+    {"11000419~0490.", "10:11000419~0490.", -1},
+    {"7-A2-1YZAz", "7-A2-1YZAZ", 1},
+    {"110004-255++409282546553270794038~", "110004-255++409282546553270794038~-1", -1},
+    {"2:10a:18181263083231612022254343315920666364", "2:10a:181812630832316120222543433159206663614", -1},
+    {"3~By256256-ZY~A000745000235", "3~By256256-ZY~A000745000235a", -1},
+    {"2:50740~9~-0256zBY100AaY", "2:50740~9~-0256zBY100AaY~~", 1},
+    {"72+-.+.~10", "72+-0.+.~10", 1},
+    {"4BZB0995003220", "2:4++0000691", -1},
+    {"000087700359991-73071820559741820853018422305980053183485Y327607579440502493753930933", "2:000087700359991-73071820559741820853018422305980053183485Y327607579440502493753930933", -1},
+    {"99y+-yyy-yaz", "01:6256aYb", -1},
+    {"6075066824815017520968411256-881965112386339375500Y~", "1:6075066824815017520968411256-881965112386339375500Y~", -1},
+    {"10:3aB-255", "2255bbA~-3006970690+Y", 1},
+    {"89008210-100539b", "2:1110012-005051010+", -1},
+    {"8~~+Y~", "8~~+Y~-1-1", -1},
+    {"891-Z", "891-Z~1", 1},
+    {"822256-BZbY70864508131581726414115502170492910093075352", "822256-BZbY70864508131581726414115502170492910093075352~a", 1},
+    {"5ZA.-BY200744", "2:5ZA.-BY200744", -1},
+    {"5Zyzy-0+", "5ZYZY-0+", 1},
+    {"1:4~~46930937898166450512270BBZ-.00576", "1:4~~46930937898166450512270BBZ-.000576", 0},
+    {"10:2:Y0634Y:-~0~~", "2:Y0634Y:-~0~~", 1},
+    {"0:10.", "10.", 0},
+    {"11000274", "1:199~", -1},
+    {"100+255BZZZ", "100+255bzzz", -1},
+    {"1:40461yAa", "10:50073643421765136944690430016685zBa-.0..00964", -1},
+    {"8Baz00390YYYZ--0077972987284012675052168646113865", "01:81~3-59614838807603884344571328++yBZ", -1},
+    {"4Yyb4700203934198097615490..", "4Yyb4700203934198097615490..~rc1", 1},
+    {"193966585135929779464743538706925383523000212", "193966585135929779464743538706925383523000212-0", 0},
+    {"12256AZ0810~-+.0851.", "12256AZ0810~-0+.0851.", 1},
+    {"5000~5720203320689055498.-BA00860", "1:5000~5720203320689055498.-BA00860", -1},
+    {"11+0021003598463934818568851471zaz-256079z.", "11+0021003598463934818568851471ZAZ-256079Z.", 1},
+    {"0B.000358186362659545107311658567117700502", "0B.000358186362659545107311658567117700502~a", 1},
+    {"10:2009312..", "10:2009312..-1-1", -1},
+    {"12+", "192+", -1},
+    {"6-y3130304027211262969745423685332182y--+32920594134071047919256", "1:6-y3130304027211262969745423685332182y--+32920594134071047919256", -1},
+    {"0:1099Zzyy", "0:1099Zzyya", -1},
+    {"11.YYZ~1A", "11+YYZ~1A", 1},
+    {"1222271055277823666326104568816790626zA-B~9868135163966107716374930902478ya", "1222271055277823666326104568816790626zA-B~9868135163966107716374930902478ya~1", 1},
+    {"10~-1-911z+", "10~-1-911z+~rc1", 1},
+    {"122579424151775436160016299785164121926964939958878033355742218124422-.", "122579424151775436160016299785164121926964939958878033355742218124422-.-0", -1},
+    {"8ay~-~+", "18ay~-~+", -1},
+    {"1026521400523425845232~~-yaAaYb", "20935Y-00586098-+000732", 1},
+    {"9~5208152290408753397604336561621846345602632125921162119210683", "1:9~5208152290408753397604336561621846345602632125921162119210683", -1},
+    {"0:7423544045717882139295325855904293213A000743-Zz99.", "1:7423544045717882139295325855904293213A000743-Zz99.", -1},
+    {"01:8.YA-9yza", "01:8.ya-9yza", -1},
+    {"6100.Az", "61900.Az", -1},
+    {"0aYb001809ABB-ABA~2563", "0aYb001809ABB-ABA~2563~", 1},
+    {"2:10292562-1000490~25699", "10292562-1000490~25699", 1},
+    {"00:1232596024724682542944255919901522745413929000313100-+~256+0823", "1232596024724682542944255919901522745413929000313100-+~256+0823", 0},
+    {"50Zz-~", "50zz-~", -1},
+    {"10.+", "0Az-10-Z.", 1},
+    {"500995+-~+", "500995+-~+~a", 1},
+    {"2:82550762100", "2:82550762100-0", 0},
+    {"6~zzb+", "96~zzb+", -1},
+    {"1:2011000379-...991", "1:2011000379-0...991", 1},
+    {"00:599YZy-~210", "00:599YZY-~210", 1},
+    {"9255yY.9-+09837696420278651741341622192528892", "9255yY.9-+098376906420278651741341622192528892", -1},
+    {"00:4b~-0954", "00:4b~-0954~rc1", 1},
+    {"01:39.", "01:39.~1", 1},
+    {"796367688491694437127627109827810000326-.", "796367688491694437127627109827810000326-.0.", -1},
+    {"3...-0284y.2.", "3...-0284y.2.+b1", -1},
+    {"8--99~Z", "8--99~Z~rc1", 1},
+    {"0:4-0643-0890100.1881882255472748133548327793018443689032", "1bya-.", 1},
+    {"9256-a10+~100", "9256-a10+~100~rc1", 1},
+    {"00:3:~0yAZ", "000:3:~0yAZ", 0},
+    {"11a", "11a-1-1", -1},
+    {"12.--00287~yA", "1:12.--00287~yA", -1},
+    {"0:9256-001560000283+", "9256-001560000283+", 0},
+    {"0:3100ZbB", "00:3100ZbB", 0},
+    {"1014366539396488108046396418572240924000649-YZB~2byY", "1014366539396488108046396418572240924000649-YZB~2byY~~", 1},
+    {"2a256583677207885404271560-z0968++2", "2a2565836772078854042715690-z0968++2", -1},
+    {"6-00794-+zZyab.BY", "6-000794-+zZyab.BY", 0},
+    {"7.-~+9~00661", "7.-0~+9~00661", -1},
+    {"1ybyAz-AAy-100Yy+490890355512741015633365343866723", "8-00682-Bb-Yaa~bzBZb.", -1},
+    {"7.aBzB10.", "7.ABZB10.", 1},
+    {"699+-~", "0:699+-~", 0},
+    {"01:12000338-10092~bZz", "01:12000338-10092~bZz~1", 1},
+    {"1:6yAYBa", "0--~+-16774504245328847984688647694708313943801256", 1},
+    {"1:0.000223-3ab-~0984az", "1:0.000223-3ab-~0984az~~", 1},
+    {"4Za", "4Za~a", 1},
+    {"100157255+", "1:100157255+", -1},
+    {"10:1288466095217765230342290846127079AyBYzaY.-4202644676672370530950773256~11", "10:1288466095217765230342290846127079AyBYzaY.-4202644676672370530950773256~11~~", 1},
+    {"1YYA99000273Ay9-~", "1YYA99000273Ay9-~.0", -1},
+    {"11A-1++z", "11A-1++za", -1},
+    {"2:4-YZ-1", "2:4-YZ-1-1", -1},
+    {"5yA7224277265115097778413842460.00858-bz", "5yA7224277265115097778413842460~00858-bz", 1},
+    {"10100~yb2-000984+00786+~", "2+~100YB-AYb~00981", 1},
+    {"6ByB+255+-99~+", "6ByB+255+-99~++b1", -1},
+    {"2:1000155-431678882118372675801164405005905002ZA00497yAZ", "2:1000155-43167888211008372675801164405005905002ZA00497yAZ", -1},
+    {"58016268647684166247292043101891257734923+-.-yA", "58016268647684166247292043101891257734923+-+-yA", 1},
+    {"200207~", "0:200207~", 0},
+    {"5255A0032-3bBB~", "1:5255A0032-3bBB~", -1},
+    {"3.-255b-255~", "0:3.-255b-255~", 0},
+    {"00:8.~::-100ZZa", "1:8.~::-100ZZa", -1},
+    {"99439391207301301317254952376215-~+", "99439391207301301317254952376215-~+~a", 1},
+    {"12000889007221010", "0:12000889007221010", 0},
+    {"2:9.00154:", "10A256--z0007910721", 1},
+    {"10:11687951782942442518940207509900140-YAzb.yb", "10:11687951782942442518940207509900140-YAzb.yb-1", -1},
+    {"10:2.100-0003210469bzz9", "2.100-0003210469bzz9", 1},
+    {"1200467", "1:2ZBZZBz-.Y81400945982631437793467ZA", -1},
+    {"1B-0", "039~-yyBy", -1},
+    {"51-A2YZB-11Byz92509797569350082353690135713949~", "51-A2YZB-11BYZ92509797569350082353690135713949~", 1},
+    {"1:9yzY.-990+00051", "9yzY.-990+00051", 1},
+    {"8.11BZz99y-.BBz.0321yBA", "8~11BZz99y-.BBz.0321yBA", 1},
+    {"10.", "10a", 1},
+    {"0Z", "0z", -1},
+    {"1256129909829263929436010498912459664338.", "1256129909829263929436010498912459664338.-1-1", -1},
+    {"30~0346-000226zaA9000839bya", "0000551--100+~+", -1},
+    {"5-68718294978054644201408020321210876-3179490963429092993ayb256~", "10:5-68718294978054644201408020321210876-3179490963429092993ayb256~", -1},
+    {"7000379bY", "7000379bY-1-1", -1},
+    {"20~", "2000~", -1},
+    {"1191807387151381490444472204-2081Zbb", "1191807387151381490444472204-02081Zbb", 0},
+    {"1299-azB", "7100zBYba+y", -1},
+    {"10256b~b-11", "10256b~b-011", 0},
+    {"11.A60654958808009355507301348", "10:0925698473441245204365229975-+ZYA.~", -1},
+    {"000116", "0:000116", 0},
+    {"2:3ZYB48016473352718372415816973877739598223778399674970830600082094226124030561970695729969223", "2:3ZYB48016473352718372415816973877739598223778399674970830600082094226124030561970695729969223-1-1", -1},
+    {"0:49-255226869565673031963284967704275455654844256", "0:49-255226869565673031963284967704275455654844256~1", 1},
+    {"2:1210255:255-00161", "01:10256bzB", 1},
+    {"2.9Zza-y00140Y", "9100~75426405359447238784226656080719--00136Z", -1},
+    {"10:82:.11:", "10551819415942439211645648734703639673445aB~2", 1},
+    {"71100829", "6+0-3100.2~", 1},
+    {"4571991485069913025999.-11Zy+~y", "4571991485069913025999.-11Zy+~y~", 1},
+    {"1:6bz00440AzB1-3b", "1:6bz00440AzB1-3b.0", -1},
+    {"01:1~06040430:255-.10", "01:1~06040430:255-.10~a", 1},
+    {"0~0340.-23~", "0:0~0340.-23~", 0},
+    {"6255yz", "3Ay", 1},
+    {"109-AyB~A00123", "109-AyB~A00123~rc1", 1},
+    {"01:8--Z-~.25610", "6baZ0005960488~000300", 1},
+    {"7y1aYBYAa-0005609900622", "7y1aybyaa-0005609900622", -1},
+    {"60316+-1YZ+BaA", "0060316+-1YZ+BaA", 0},
+    {"10:4~A00050", "10:4~a00050", -1},
+    {"10.Za448578116212507652504388090469953229yAy-.", "10.Za448578116212507652504388090469953229yAy-0.", 1},
+    {"8yA~9by00676", "8yA~9by006706", -1},
+    {"0.~-aAz", "0.~-AAZ", 1},
+    {"0:7BYzyyY-+3000920621657148748396842873676900bzb", "0:7BYzyyY-0+3000920621657148748396842873676900bzb", 1},
+    {"5zYy.--~Z.", "95zYy.--~Z.", -1},
+    {"0~00016-+10", "2:0~00016-+10", -1},
+    {"01:9379104593886452388469674468961823479+.-zaZb", "01:9379104593886452388469674468961823479+.0.-zaZb", -1},
+    {"2:5Yza-9970781306505625874095960542672+00670zY", "2:5yza-9970781306505625874095960542672+00670zy", -1},
+    {"0:8~:AB-664165020613878055358185486812191083418000484", "2:8~:AB-664165020613878055358185486812191083418000484", -1},
+    {"0:079701025747111464031328b+-:-076811z0855000460", "6B-9801853784323268590~+", 1},
+    {"0.z00744-+170560626742430724446577604", "2:0.z00744-+170560626742430724446577604", -1},
+    {"01:4ba::-00631AYY~000486621057359076597680691682874404191473", "2:4ba::-00631AYY~000486621057359076597680691682874404191473", -1},
+    {"9+.2-Zy2559", "0:9+.2-Zy2559", 0},
+    {"51000060-6614069831516535749403108883643", "51000060-6614069831516535749403108883643+", -1},
+    {"10:3b2-984727649477484368778473480+100", "10:3B2-984727649477484368778473480+100", 1},
+    {"1110YYz--9", "0:1110YYz--9", 0},
+    {"80720676128388956722156243992568207056azAYZ-.", "80720676128388956722156243992568207056azAYZ-.~rc1", 1},
+    {"699.", "0:699.", 0},
+    {"1100355000453+262838857731929584327511082", "1100355000453+2628388577319295843275110802", -1},
+    {"0+A+", "0+A+~rc1", 1},
+    {"4B93.", "4B93.0.", -1},
+    {"0+~Ya2550228", "0+~Ya2550228~rc1", 1},
+    {"1:11:00922-2552563204657459840749184130zB", "1:11:00922-2552563204657459840749184130zB~a", 1},
+    {"1:118196320361212383094282169620389535927277577635872706223442657381763733-+bz54365969823627700387789848846235675Yy845868960397181075494343", "1:1181963203612123830942821696203895359272775776358727062234426573817637393-+bz54365969823627700387789848846235675Yy845868960397181075494343", -1},
+    {"7a-~", "7a-~~~", 1},
+    {"01:0zYzzZA0022y-b~1624629637973070807295691365183550822506YZ", "10:0zYzzZA0022y-b~1624629637973070807295691365183550822506YZ", -1},
+    {"2:101471101074900157336~", "2:1014711010074900157336~", -1},
+    {"00:210100:-31390214231667456977058110+", "00:210100:-31390214231667456977058110+~a", 1},
+    {"7698860302872763015380333618000110AZA-200519+", "7698860302872763015380333618000110AZA-200519+~", 1},
+    {"1000397ayy-..+11", "105392714640515324230143202943886086BbA.--00061110+Y", -1},
+    {"9bBZ9-~99100+0", "0:9bBZ9-~99100+0", 0},
+    {"60--00740", "4256-256bB", -1},
+    {"1:3+aBBbAY-+100zBaZ", "1:3+ABBBAY-+100ZBAZ", 1},
+    {"9~00078799-05632", "9~00078799-05632~~", 1},
+    {"01:1100~+yA:", "01:1100~+yA:-1-1", -1},
+    {"7A04519AaAAb-~+7647721824621795535456441169991996256", "7A04519AaAAb-~+7647721824621795535456441169991996256~", 1},
+    {"11YzB~8242848795851712237z-00988200523.", "0:11YzB~8242848795851712237z-00988200523.", 0},
+    {"10:0::2:", "0:7zBAya100-+100+000591", 1},
+    {"1:0~~-100255", "0~~-100255", 1},
+    {"4~-YB-00037010", "1:4~-YB-00037010", -1},
+    {"2:7256007802-1100255", "00:1000826-bbb.1", 1},
+    {"7.255-.aZ-+000493~bZ00621", "2:7.255-.aZ-+000493~bZ00621", -1},
+    {"199-+0852", "1:199-+0852", -1},
+    {"01:496828832206762792843015066-.6834964639588898471828810701948040356845+9", "01:496828832206762792843015066-0.6834964639588898471828810701948040356845+9", 1},
+    {"2:599100100-549131334794805867417-21+++", "2:599100100-549131334794805867417-21+++~rc1", 1},
+    {"01:5000447ZBb-yz", "01:5000447ZBb-yz~", 1},
+    {"9193-2A", "0:9193-2A", 0},
+    {"1:611-0812.0039", "1:611-00812.0039", 0},
+    {"0:1+000444-+569454000970282752804389591.60737264149435148576966320190627", "0:1+000444-+569454000970282752804389591~60737264149435148576966320190627", 1},
+    {"1AbY255--Az110395.0311", "1AbY255--Az1010395.0311", -1},
+    {"2:9100000236AAy-.00078", "00:38541572593775410655929811541497266740443yAa00080814292257732374379976-000515bZZ2AB000825", 1},
+    {"9200467-+1by", "9200467-0+1by", 1},
+    {"12100YzzY-00607607460274340289002318716927778299754100", "12100YzzY-00607607460274340289002318716927778299754100a", -1},
+    {"2:2994620726781661727615005bB", "10:2994620726781661727615005bB", -1},
+    {"6.1Zyb", "6.0.1Zyb", 1},
+    {"5BB99-AZ", "1~11ba759881933784590062807345552701006500615-zzz0", 1},
+    {"10100~501854067950327970065130835382387950420--AYAaA098", "1:10100~501854067950327970065130835382387950420--AYAaA098", -1},
+    {"10:3Z12317804684831037605964598081-100-YZB~2.", "10:3Z12317804684831037605964598081-100-YZB~2+", 1},
+    {"70539+0037111", "70539+0037111~rc1", 1},
+    {"21035061779785216306277491093.+62508645487078652810485296742-10yB", "21035061779785216306277491093.+62508645487078652810485296742-10yB.", -1},
+    {"717892394531583939901896462397350aB.0014-ZYB+", "717892394531583939901896462397350aB.0014-ZYB+~rc1", 1},
+    {"0:71:+-zyb-00047810787", "0:119Aay-1411331844799551292200165162+25525500033", -1},
+    {"0ZAZAY0668", "0zazay0668", -1},
+    {"120684-255", "0:120684-255", 0},
+    {"02565985402216594345873461639898416018891", "0:02565985402216594345873461639898416018891", 0},
+    {"10:9.006374466434761667323347225534215555238684854307357738528625016382404bya-~255", "10:9.0063744664347616673233472255304215555238684854307357738528625016382404bya-~255", -1},
+    {"9Y~-.Yy-~+91257360887266038802", "9+.~ZBy000603-+.2560877", -1},
+    {"10:6-:-024..", "1:6-:-024..", 1},
+    {"00:34429313613346156096005236316074301492001aZ11:.-+~10", "00:34429313613346156096005236316074301492001aZ11:.0.-+~10", -1},
+    {"1ZzyzB.B-zbB.", "0:1ZzyzB.B-zbB.", 0},
+    {"8100100-100", "81100100-100", -1},
+    {"12~bBa00423---yZ.~", "12~bBa00423---yZ.~~", 1},
+    {"10:70771+Ya-8706961227857823702401598850769820+00335+ayA", "6yA0738--+7342392833235338395526154998010737385256256302865696452390208843435185390058588", 1},
+    {"8100000126256-BzZ2.0886", "8100000126256-BzZ2.0886~", 1},
+    {"1:5~-+Za990", "1:5~-+ZA990", 1},
+    {"210-001600662zZ255", "63+.~+-~", 1},
+    {"2:11.3573104165224406441349158118814888282793479094956528-+a.", "2:11.3573104165224406441349158118814888282793479094956528-0+a.", 1},
+    {"8zbbY01656813306416179603650008~", "8zbbY01656813306416179603650008~-1-1", -1},
+    {"3-11.-++", "3-11.-++~1", 1},
+    {"7-000207..3-045310000258..", "7-000207..3-045310000258..~1", 1},
+    {"0:11ZB", "0:11ZB~1", 1},
+    {"500975~~-0+.1.", "500975~~-00+.1.", 0},
+    {"12116814929018493481467510720a--00011501732552.", "10:1100053711~100256-00474297956899316027186226247924380471.832851725707688221202514588269049242255314", -1},
+    {"4yBzA-~AZB++2", "4yBzA-~AZB++2~a", 1},
+    {"1~255ya-BzB64948182527098035831196bYa", "1~255ya-bzb64948182527098035831196bya", -1},
+    {"1zZ256-10~+", "0:1zZ256-10~+", 0},
+    {"12y000860722-.20479123351602210980493889300665789785", "12y000860722-.20479123351602210980493889300665789785a", -1},
+    {"01:50974-0129~", "01:50974-0129~+b1", -1},
+    {"60-72638604445608868396327407519844007aa.", "60-72638604445608868396327407519844007AA.", 1},
+    {"6.691312564391023216271-110-.ZzY000194", "6.691312564391023216271-110-.ZzY000194~rc1", 1},
+    {"10100306477748152579816558055+-8140825286395792739577805", "10100306477748152579816558055+-8140825286395792739577805A", -1},
+    {"9--.+.", "9--.+.~", 1},
+    {"5+-00355yb+~00460", "0~-aBz639765487041161205204074601.2", 1},
+    {"122-a004283529229845925183499685720555768531559269382659875520518625860", "122-a004283529229845925183499685720555768531559269382659875520518625860+b1", -1},
+    {"0:93~3Ba", "0:93~3Ba~1", 1},
+    {"1by0382", "1by0382~", 1},
+    {"1:0AA-9998637769744152798222296262565191Yz", "12AYZ100.", 1},
+    {"6-241633484629397496330227524175-~Z54165907593178889388622909513~", "6-241633484629397496330227524175-~Z54165907593178889388622909513~+", -1},
+    {"0:0z+-000706-0918~", "11473417362479054597210585067415286403514-2yBY~AbYaY", -1},
+    {"146009229798293484070295137812497583199-~", "146009229798293484070295137812497583199-~.", -1},
+    {"8~.yZ", "0:8~.yZ", 0},
+    {"1:7~Zy:-0633+AA", "1:7~Zy:-0633+AA~", 1},
+    {"0:12z11-ab~~", "1:12z11-ab~~", -1},
+    {"4yyA.-z-1007544698100531612819+93719466911242901896737617926912892656", "4225610+-+~", -1},
+    {"900930895By~-00065810.Aaz", "2:900930895By~-00065810.Aaz", -1},
+    {"112550100000512-1110~", "112550100000512-1110~~a", 1},
+    {"10~256", "2:10~256", -1},
+    {"10:10.100", "10:10.100-1-1", -1},
+    {"101bA-005522634619699133490444870440799.+", "101BA-005522634619699133490444870440799.+", 1},
+    {"4~0934~11000487-6987853079595229076231063688516980214200037511+", "100B01641000998-5938936723902199182198994563017552552bzA.", -1},
+    {"08178025118460027669951139972256BybY-+aa.0669", "08178025118460027669951139972256BybY-+aa.0669~1", 1},
+    {"00:8110--11~256Y.", "00:8110--11~256Y..", -1},
+    {"00005380548000335100-00036025609652560", "0:00005380548000335100-00036025609652560", 0},
+    {"9bYzyBZ-566591545689939360784214255", "9bYzyBZ-5660591545689939360784214255", -1},
+    {"1+BbzAba-11A+", "1+BbzAba-11A+~~", 1},
+    {"10:700495-9Azz0024~yy", "10:700495-9Azz0024~yy.0", -1},
+    {"1119~", "80013+000781.-y255~", -1},
+    {"11bAY~00941..-.", "2:11bAY~00941..-.", -1},
+    {"6.z", "6az", 1},
+    {"0:8~-.00801000677", "10:8~-.00801000677", -1},
+    {"1.-00710", "1.-010710", -1},
+    {"0313820694681935935029421974689~", "0:0313820694681935935029421974689~", 0},
+    {"3ZY~Bbb+abZ-+99", "3ZY~Bbb+abZ-+99~rc1", 1},
+    {"1-3.bz0750-0087900035600402+1", "0:1-3.bz0750-0087900035600402+1", 0},
+    {"3~92zZa", "3~0092zZa", 0},
+    {"8BAabaYzyB", "8baabayzyb", -1},
+    {"01:10+67375659971857476777934338604984282+100-11", "2:10+67375659971857476777934338604984282+100-11", -1},
+    {"700013899073600949+", "10:700013899073600949+", -1},
+    {"1:9Ya:-zBaa6369372346144737743024201394725271584398bbz.", "1:9Ya:-zBaa6369372346144737743024201394725271584398bbz.~", 1},
+    {"4BYZ100z", "4BYZ100z-1-1", -1},
+    {"80795-zBBB-~0261", "0:0:698572020617002776563081712+.aA-1852517044743202229274594095294396104279z047477034201610935439704511955098680616", 1},
+    {"2255574137261741401576664200369", "2255574137261741401576664200369+b1", -1},
+    {"10:5~:10074000995-00591~3~Bb", "10:5~:10074000995-00591~3~BB", 1},
+    {"3255bzBa+yY", "010+0354AyY", 1},
+    {"00:8A4463050929338652169624783630848666297-4913423765225294344952.z000188", "00:8A4463050929338652169624783630848666297-4913423765225294344952+z000188", 1},
+    {"16253801451092523740847+-+Y00287YAZAa", "162538014510925237408147+-+Y00287YAZAa", -1},
+    {"7A-.ybY256YZB", "7A-.0.ybY256YZB", 1},
+    {"3.000286y-34217799851241232021496943001994704085", "3.000286y-34217799851241232021496943001994704085~", 1},
+    {"33~", "33~~rc1", 1},
+    {"0yBAb-9-.0183022900277", "00064592338834242517550952245713154060372957544321828674840811+", -1},
+    {"2:3199000570-ab2563681333433166808214182541542200485", "2:0+ZbyByy-bzz", 1},
+    {"0ba~", "129AzA-95634560305854730759091306-~+a", -1},
+    {"00:106280334", "10:106280334", -1},
+    {"01:9::99", "9::99", -1},
+    {"9~-2bzZAYz", "9~-2bzzayz", -1},
+    {"00:0bZB100-11110000673a", "101-BZ", -1},
+    {"1:925600741--+256", "1:92560000741--+256", -1},
+    {"2:4100-2b", "2:41090-2b", -1},
+    {"01:121848639274347380052655057723---~", "121848639274347380052655057723---~", 1},
+    {"111.-a00419001230898ybY", "111+-a00419001230898ybY", 1},
+    {"102689770705295134885180070922843435000861604117928358094024147-0081~", "102689770705295134885180070922843435000861604117928358094024147-0081~-1", -1},
+    {"10000700256~", "100900700256~", -1},
+    {"10:7-684650944446842027382350464Y~9-BbB1", "10:7-68465094444684202738235040064Y~9-BbB1", -1},
+    {"10aYZ00052010256-99255", "3ZAy0Yb", 1},
+    {"11100-3255.~+", "11100-3255.~+~", 1},
+    {"3255941177134539576318304-A1001Yz", "3255941177134539576318304-0A1001Yz", 1},
+    {"10:9Za000736-:--~++0", "2:9Za000736-:--~++0", 1},
+    {"1:9ZYZ9AYB2-bZAzbzabBYz", "9ZYZ9AYB2-bZAzbzabBYz", 1},
+    {"4+aAy", "4+aAy-1-1", -1},
+    {"01:5yyB255a", "01:5YYB255A", 1},
+    {"1200895000792-0000990.100", "1200895000792-0000990a100", 1},
+    {"01:2zA-~", "100.-+3231894090901382511YyB", 1},
+    {"70800000329.ZYZ255-4932091006969626334842768173734847111350338729868268177963038710539922391672", "70800000329.0.ZYZ255-4932091006969626334842768173734847111350338729868268177963038710539922391672", 1},
+    {"10:109032029760062628769875634679~yZZ", "109032029760062628769875634679~yZZ", 1},
+    {"0by11-0+", "2:0by11-0+", -1},
+    {"5.-zBa004282.B", "0:5.-zBa004282.B", 0},
+    {"1100198yZ0069-.1111", "1100198yZ0069-.1111~", 1},
+    {"0:1:11280261993975348629710780040336-05.14366794594500454614729256", "10:1:11280261993975348629710780040336-05.14366794594500454614729256", -1},
+    {"8256", "8256~~", 1},
+    {"3AB-.0080.0~", "3AB-0.0080.0~", 1},
+    {"0:11:2-000498z+", "123~z5935066357617995572471972471263470399000913", -1},
+    {"10yZb.300441-00971666543877288343111733334963441681362748349736817285735610192511522369", "10+-.00140256", -1},
+    {"7yAYZaZ-BB9350628697591754984394740073+11", "2:7yAYZaZ-BB9350628697591754984394740073+11", -1},
+    {"5+BYaa.40156523891347301150304", "0:5+BYaa.40156523891347301150304", 0},
+    {"57430604643596251471719390370504111717262", "574306046435962514717193903705041117170262", -1},
+    {"10:8AY+10-0+0529~", "10:8AY+10-0+0529~~rc1", 1},
+    {"6+", "6+~1", 1},
+    {"00:1y~", "1y~", 0},
+    {"5Zzy000129100+~-9yaY448288358220164742505982.", "10:5Zzy000129100+~-9yaY448288358220164742505982.", -1},
+    {"2:39z", "9+A", 1},
+    {"6AZ255-2552-8740958633735958165610889~", "6AZ255-02552-8740958633735958165610889~", 0},
+    {"00:11:+ABa+", "00:11:+ABa+~~", 1},
+    {"01:2100", "0001:2100", 0},
+    {"10bZ2256-~.z~ZY", "10bZ2256-~~z~ZY", 1},
+    {"1:120298zBy~::", "2:120298zBy~::", -1},
+    {"9.BbZYAb", "9.BBZYAB", 1},
+    {"00:5000957-Y", "0000:5000957-Y", 0},
+    {"12yY+Z869713992437562611296425708441Zaa-00414yBaaBy100", "2:12yY+Z869713992437562611296425708441Zaa-00414yBaaBy100", -1},
+    {"059124216234825138858.-725368926806603928253402244a", "059124216234825138858.-725368926806603928253402244a.0", -1},
+    {"16193978057994717070800654256-YYA-10zya100", "16193978057994717070800654256-YYA-10zya100~a", 1},
+    {"00:9:-~-yyy10~", "9:-~-yyy10~", -1},
+    {"6~+-++~1", "0:6~+-++~1", 0},
+    {"10:0.+YBZ-1011", "010:0.+YBZ-1011", 0},
+    {"16544614529697438322669888106109574807934-.", "16544614529697438322669888106109574807934-.~rc1", 1},
+    {"30-43782534702415646708860+", "30-043782534702415646708860+", 0},
+    {"10:8~256-255", "10:8~256-2155", -1},
+    {"8101256bb-2~", "0:8101256bb-2~", 0},
+    {"1zyz", "1z+ZZB", -1},
+    {"12100zzByYY1100-928289554521833863041077081613732000734b", "10~.+yY", 1},
+    {"70~zB~ZAa", "970~zB~ZAa", -1},
+    {"1YAb3+z00423", "1:1YAb3+z00423", -1},
+    {"73YbB---.1003Az", "6100103750793613497400019716573893843281.1001-zZ9AZY", -1},
+    {"3256--.00663.2569", "3256--.00663.2569~a", 1},
+    {"910009600921~", "910009600921~~1", 1},
+    {"10....~", "0:10....~", 0},
+    {"10za255-.YaB", "0:10za255-.YaB", 0},
+    {"0:03097674215450653911717272837195501+-9BZB", "0:03097674215450653911717272837195501+-9bzb", -1},
+    {"10:10ZYA5789882247905517132120255B~", "10ZYA5789882247905517132120255B~", 1},
+    {"9~", "9~+", -1},
+    {"83130193362797295388227653558ya-bYbyZA", "800556255", 1},
+    {"4b", "4b~~", 1},
+    {"4712712659141043140182469525031006554672954283394389109425536-by", "47127126591410431401824695250310065546729542833943891094255136-by", -1},
+    {"610bay430033047198561603657+-4441706833425467835093321304685357941YA1821483819484766718169166+9", "610bay430033047198561603657+-04441706833425467835093321304685357941YA1821483819484766718169166+9", 0},
+    {"7.b+023-10010~", "0:0Bz:00754", 1},
+    {"2:0Zy:0140-00748..Bya~", "2:0Zy:0140-00748..Bya~~rc1", 1},
+    {"01:2Y", "2Y", 1},
+    {"10:12ZZ00925-By", "00:51125699.-.9~zz2", 1},
+    {"6zZZ3680607881932943688Yz11.-00165", "6zZZ36806078819329943688Yz11.-00165", -1},
+    {"900744B", "900744b", -1},
+    {"2:12By84988249948215532987713662944660-yA000440Zay", "12By84988249948215532987713662944660-yA000440Zay", 1},
+    {"9bbB-.~by", "9bbB-.~by~~", 1},
+    {"2:599+~3:-zab.2559", "2:599+~3:-zab.0.2559", 1},
+    {"9~0~-yyb.5630000771576074864691171083164~000158", "9~0~-yyb.5630000771576074864691171083164~0900158", -1},
+    {"2:6~-abAb114031669066635612514165235826145039932YB", "6~-abAb114031669066635612514165235826145039932YB", 1},
+    {"400505-01~", "0:400505-01~", 0},
+    {"0:2:zaB", "0:2:zaB-1", -1},
+    {"4zB", "4zB-1-1", -1},
+    {"790366346389805565795294188083311615634259914082566352668296569100-+", "211544214095535178587469373081z255-000961+", 1},
+    {"4+BaB-zaB255b", "0:4+BaB-zaB255b", 0},
+    {"12-00559-0261", "10:12-00559-0261", -1},
+    {"8299~-25523", "8299~-025523", 0},
+    {"2:7~10011YBZ", "2:97~10011YBZ", -1},
+    {"1110-+~Z..", "1110-+~Z..~~", 1},
+    {"01:0BZ-aA", "01:0BZ-0aA", 1},
+    {"1:3BB-281233901316886647643", "3BB-281233901316886647643", 1},
+    {"110009792Ay-2Ab0442", "10:110009792Ay-2Ab0442", -1},
+    {"7007724818807055503351327687-255..", "7007724818807055503351327687-255+.", 1},
+    {"6-0082-zB", "6-0082-ZB", 1},
+    {"2:12~~100.79687806720757746867715481750635733-..aAY", "2:12~~100.79687806720757746867715481750635733-..aAY-0", -1},
+    {"10:11baa00625-7283912590657502635984781844989721190653.", "1:11baa00625-7283912590657502635984781844989721190653.", 1},
+    {"01:2255A+", "01:2255A+~", 1},
+    {"1:6Zy+2550775", "1:6Zy+2550775~1", 1},
+    {"073042083556262332758141762221228979370-000340", "073042083556262332758141762221228979370-000340~a", 1},
+    {"0+.+bYz~", "90+.+bYz~", -1},
+    {"7aB10y.", "7aB10y..0", -1},
+    {"587650580586490255343574208738858780924.", "587650580586490255343574208738858780924.~rc1", 1},
+    {"01:80ABByyAB-bb", "2:86534145151489929935", -1},
+    {"09zAZzB256-1988851739672305191256", "09zAZzB256-01988851739672305191256", 0},
+    {"0:12ybAB99-98386909901947793862783-00201yBA990AaY", "0:12ybAB99-098386909901947793862783-00201yBA990AaY", 0},
+    {"11.+ZB~", "11.+ZB~.0", -1},
+    {"00007590ZAb.-zybyY", "00007590ZAb.-zybyY~~", 1},
+    {"2:2Y+--353678710675277238492750000931byY", "2:2Y+--3536787106751277238492750000931byY", -1},
+    {"9-9-000326-237928878514201377057063409746102", "1:9-9-000326-237928878514201377057063409746102", -1},
+    {"0:7ZaZaZy-27782585616905792415704134797400263561984497302435659483219567A", "1200249bAZaB0124-~z", -1},
+    {"0:800894+100~Aa-~2", "0:800894+100~AA-~2", 1},
+    {"2:911-:~-56839958060332052247+255", "2:911-:~-56839958060332052247+2055", -1},
+    {"1000237172947055643373365947478933256by-~Z", "8ZzZ.-ZbA.", 1},
+    {"01:11azy32279303191578745778817106~", "01:11azy32279303191578745778817106~-1-1", -1},
+    {"1+-56614715958243904466532032A", "1+-056614715958243904466532032A", 0},
+    {"1YA1723732803525289367535039947410~-+B9.", "1YA1723732803525289367535039947410~-0+B9.", 1},
+    {"2.63426112311296805374108531626939427554184916997853-21432629153088112702419538574000782.+", "2.63426112311296805374108531626939427554184916997853-21432629153088112702419538574000782.+~a", 1},
+    {"8z+Ya000320zAa", "8z+Ya000320zAa-1-1", -1},
+    {"711AbZ-b", "711AbZ-0b", 1},
+    {"6Y11~.-+10090957", "6Y11~.-+10090957.", -1},
+    {"1211YB10-3", "1211YB10-3A", -1},
+    {"01:5000638-52897046773132808045273463080656197330190001603", "5000638-52897046773132808045273463080656197330190001603", 1},
+    {"00:0:-Y+.100B", "9+-..yYA256", -1},
+    {"5~.aZA0908.-2", "5~.aza0908.-2", -1},
+    {"00:5+yaaa~-.000657167232373910272765430355776526709BaBBa", "2:5+yaaa~-.000657167232373910272765430355776526709BaBBa", -1},
+    {"4+3.bz-~aZ", "4+3.bz-~aZ-1", -1},
+    {"10274736232256526497450924812999azA256-+~00527", "10274736232256526497450924812999azA256-+~00527-0", -1},
+    {"1BZ2291161315453567861693143444b-+-~Zz", "1BZ2291161315453567861693143444b-+-~Zz~1", 1},
+    {"7ZyB9979173587421683057473880169-.bbZybaa", "7ZyB9979173587421683057473880169-~bbZybaa", 1},
+    {"1--bbz", "11byZB-100.223307132220261716572244833530", -1},
+    {"8~-YB.zA00774", "8~-0YB.zA00774", 1},
+    {"01:12256-.0-043313416527226657467007264335578594+00611", "01:12256-0.0-043313416527226657467007264335578594+00611", 1},
+    {"1:3AAAb100-3+z+", "3AAAb100-3+z+", 1},
+    {"2:1baz-~~", "002:1baz-~~", 0},
+    {"4Y-+76413966437356750976319158213363374Yby", "4Y-0+76413966437356750976319158213363374Yby", 1},
+    {"2:12.-.8165044259180631017730709298845419269653+~", "2:12.-0.8165044259180631017730709298845419269653+~", 1},
+    {"7AbB+-5631970868380699883896673231a", "0:7AbB+-5631970868380699883896673231a", 0},
+    {"0:1Z", "0:1Z-1-1", -1},
+    {"72550116~-Y256az000249", "72550116~-0Y256az000249", 1},
+    {"0111-++10~888610819615630661471300267546920785803", "2:8~zY+ZBBYY", -1},
+    {"10465881875128879841585525432721", "104658818751288798415855125432721", -1},
+    {"4AA674960739424061095074883330851657AB10-16065863407903409346294871404605252", "4aa674960739424061095074883330851657ab10-16065863407903409346294871404605252", -1},
+    {"300136y99~", "300136y99~-1-1", -1},
+    {"0ayZB-aBy256256", "2:7100255-Y~5993526418797012677718357", -1},
+    {"10ba-000870byA", "00:32-:-Z99888326511810912874177341+", -1},
+    {"0:356789501249604053841575+zZ255:-BYbAA", "0:3567890501249604053841575+zZ255:-BYbAA", -1},
+    {"01:02--B", "01:02--B.", -1},
+    {"1~0717060128656721814080896320463354364422", "1~0717060128656721814080896320463354364422-1-1", -1},
+    {"10~", "1:10~", -1},
+    {"6~000230-aZazBY+A1", "6~000230-aZazBY+A1+b1", -1},
+    {"1:91.-2", "91.-2", 1},
+    {"1:9BB:0.", "10:9BB:0.", -1},
+    {"2bbbabb0-00361~", "1:2bbbabb0-00361~", -1},
+    {"1az101110", "1az101110~~", 1},
+    {"00:29yya99Z-ayZ99+255", "29yya99Z-ayZ99+255", 0},
+    {"8000389148872114942295782589641980764559300376-84217015954600225992576744119721638470189yA", "8000389148872114942295782589641980764559300376-084217015954600225992576744119721638470189yA", 0},
+    {"0:60261~Byz", "0:602601~Byz", -1},
+    {"01:5256b100-AZyza00659.255", "01:5256b100-AZyza00659.0.255", 1},
+    {"12ZB--bZZy+BYz", "12ZB--bZZy+BYz+b1", -1},
+    {"12527776252570928601903489275913008938-baz1+", "12527776252570928601903489275913008938-baz1+~1", 1},
+    {"10184793728277339570659794682507256-042000815", "10184793728277339570659794682507256-0042000815", 0},
+    {"9299ABB-63450318054048434696", "0:9299ABB-63450318054048434696", 0},
+    {"6Y~+Zy256", "1:6Y~+Zy256", -1},
+    {"70915.-1000530.+", "70915.-1000530.+~a", 1},
+    {"900946+-000778Y11", "0:900946+-000778Y11", 0},
+    {"70356374758437033777567830181568700208-.", "00:9999:~", 1},
+    {"11111zaB~-1010yAZ", "11111zaB~-100010yAZ", -1},
+    {"00:4ZbZz", "1:4ZbZz", -1},
+    {"3bBy1B", "1:3bBy1B", -1},
+    {"0:3Y000367ZyY-a++256", "00:2~ZYaz-256", 1},
+    {"2A834124575601427463061744420246700+--8827038404731828924983449010899YyBBZZYZ", "2A834124575601427463061744420246700+-0-8827038404731828924983449010899YyBBZZYZ", 0},
+    {"103243524950103643300880900957-100zb+3~", "0:103243524950103643300880900957-100zb+3~", 0},
+    {"1Y0-.", "12-7796612140347346970581310-255zBZZ", -1},
+    {"00:2aBabY", "2:2aBabY", -1},
+    {"0+000244-bB-.", "0+0000244-bB-.", 0},
+    {"10:4255278781633940047699296036610947710261895031272724851-188046073387235905736767643320286+00082345713613888528848755533", "1:4255278781633940047699296036610947710261895031272724851-188046073387235905736767643320286+00082345713613888528848755533", 1},
+    {"01:90728Yz1002-377666893255396255969951564245517300423918439463791328151168867", "01:1257881010217131595347492017BzBA-255", -1},
+    {"8100110-11906642564731580480111971179AB", "8100110-119066425647315804809111971179AB", -1},
+    {"6256+YYZBBZab", "6256+YYZBBZab-1-1", -1},
+    {"1:12+~YBY-0", "4+-YYY", 1},
+    {"910-256-0789Y+3", "2:910-256-0789Y+3", -1},
+    {"2:7A00275y-3yzbYBaaYYzz", "01:4abZ00839:-0676255", 1},
+    {"01:12~ab.10", "01:12~ab~10", 1},
+    {"11y-.~", "11Y-.~", 1},
+    {"116568627569179733840890072870226146615134856462183255170667958006652.1001-00513000545.+zYb", "7++-+~0+0537", 1},
+    {"8z-~", "4baB11AY99-0+", 1},
+    {"11300977-0195602296657903347464747506bBz0661.", "11300977-0195602296657903347464747506bBz0661.~", 1},
+    {"11000813zyb928342315685961854466140a", "11000813zyb928342315685961854466140a-1-1", -1},
+    {"7BZY0-2Z3169620670381952191936868320691325753100", "2:7BZY0-2Z3169620670381952191936868320691325753100", -1},
+    {"7b100044200800bZ-A", "7b100044200800bZ-0A", 1},
+    {"0:1Z7566502563076538632844857377228959071503-Aa+48058988596954508523319477+.", "0:1Z7566502563076538632844857377228959071503-Aa+48058988596954508523319477+.~~", 1},
+    {"10:8zbz-000357za.-b.", "10:8ZBZ-000357ZA.-B.", 1},
+    {"5yYa-0000161~", "932z-+", -1},
+    {"12bz0588", "12bz0588A", -1},
+    {"12393165366902496861427293203420743+-433740682964098010923901745100-b211000188a", "0:12393165366902496861427293203420743+-433740682964098010923901745100-b211000188a", 0},
+    {"4zZA68073829238315022572263141793600836688ZzZ~9341927048692733456", "0:4zZA68073829238315022572263141793600836688ZzZ~9341927048692733456", 0},
+    {"1273488676126093209858567396754-~", "1273488676126093209858567396754-~a", -1},
+    {"82256937991899980241883307632791001-~3yaBzz256", "2:82256937991899980241883307632791001-~3yaBzz256", -1},
+    {"2+.-BY+", "0:2+.-BY+", 0},
+    {"2:2.+ybB33913808030878494721172-30y.", "2:2.+ybB33913808030878494721172-030y.", 0},
+    {"5bYa9", "005bYa9", 0},
+    {"10:700893:2", "1:700893:2", 1},
+    {"2a-.", "2a-a", 1},
+    {"1:1111-9", "1:1111-09", 0},
+    {"0+0016", "0+0016~1", 1},
+    {"01:6ZbA0360083~", "6ZbA0360083~", 1},
+    {"10:3--+.", "3--+.", 1},
+    {"30004940500.-2", "8~Z0421", 1},
+    {"10:1:980464711080081723521238117194048204743YZ-10-0", "10:1:980464711080081723521238117194048204743YZ-110-0", -1},
+    {"7.1001000657-~~", "7.1001000657-~~~1", 1},
+    {"3.-~977347836602851338082205368500924", "0:3.-~977347836602851338082205368500924", 0},
+    {"12.10+aA--3100", "12.10+aA--3100~a", 1},
+    {"1:120006899-000931.", "10:120006899-000931.", -1},
+    {"0+~000573-.3", "10:0+~000573-.3", -1},
+    {"2:8B006669:za-61339414313293163247256", "2:8B006669:za-61339414313293163247256.", -1},
+    {"01:600852256-0", "01:600852256-0a", -1},
+    {"1292", "1292-1-1", -1},
+    {"69yZZyy~000392-~", "69yZZyy~000392-0~", -1},
+    {"1:200538Y10--011714103524264111989", "1:200538Y10--011714103524264111989-1", -1},
+    {"61964366292937186002124271730071632689900866..0742-299", "61964366292937186002124271730071632689900866..0742-299+", -1},
+    {"1:8000668-~.33069337005028287502652589148255", "1:8000668-0~.33069337005028287502652589148255", -1},
+    {"400818b100yaY11-2...~", "400818b100yaY11-2...~~1", 1},
+    {"82562Ba479323030937835685784574021023-255~~00105", "2:82562Ba479323030937835685784574021023-255~~00105", -1},
+    {"113-+zZA18715997692688720366Za", "113-+zza18715997692688720366za", -1},
+    {"825697165557457619290141341704310289547217000636+99-~", "825697165557457619290141341704310289547217000636+99-~a", -1},
+    {"00:5::::+", "00:0B:-11", 1},
+    {"425600240.256-1", "2:425600240.256-1", -1},
+    {"10255+", "10255+-1", -1},
+    {"0:111000979+aZb", "0:111000979+aZb~~", 1},
+    {"01:200286abaYB16745218581893315344063593025", "01:200286abaYB16745218581893315344063593025-0", 0},
+    {"3--.ZA.YAb", "3--.ZA.YAb.0", -1},
+    {"1+--1012700857zY000969", "1+--1012700857zY000969~1", 1},
+    {"10AB39-29885787133989631553452307003527331Zza++", "10AB39-29885787133989631553452307003527331Zza++.0", -1},
+    {"9.9910", "0:9.9910", 0},
+    {"5~-.ZzA", "00:104633190957307973295170349704122781230686byy-.10+", -1},
+    {"2:300039..zBy", "5B.-9aBzBYbbb", 1},
+    {"8Ayy-39434884977888408918478199520945+11bA000219", "8Ayy-39434884977888408918478199520945+11bA000219a", -1},
+    {"9Ab2569042899236983367396532za+-yy~~9999", "9Ab2569042899236983367396532za+-yy~~9999+", -1},
+    {"111aaZBBz-AyA1", "111aaZBBz-AyA1-1", -1},
+    {"10:29185964298627322455499269757828551043759-3:-.09378417378661786266968828877907764500757", "10:29185964298627322455499269757828551043759-3:-.09378417378661786266968828877907764500757~rc1", 1},
+    {"6~-Ay", "96~-Ay", -1},
+    {"01:4ZAz--y66091101457592778443623412077408048057", "01:4ZAz--y66091101457592778443623412077408048057~a", 1},
+    {"10:511000153149900117759657866625945003109408073772Aaaby", "10:511000153149900117759657866625945003109408073772aaaby", -1},
+    {"4-.+3840271460608361041387048993986412-0835", "4-.+38402714606083611041387048993986412-0835", -1},
+    {"19b0-00730019600308~1", "0:19b0-00730019600308~1", 0},
+    {"12-0114~-A", "12-00114~-A", 0},
+    {"4ZBYyZA01-.1111256", "0:4ZBYyZA01-.1111256", 0},
+    {"1:3~958749281980572219054559703090924629909-11ZYzbZZ.0", "1:3~958749281980572219054559703090924629909-011ZYzbZZ.0", 0},
+    {"01:11-256.+:-9z", "01:11-0256.+:-9z", 0},
+    {"5000364zb.", "5000364zb.~1", 1},
+    {"0:31-1000087", "0:31-1000087~rc1", 1},
+    {"70009493220090418357303246681308428691141710", "70009493220090418357303246681308428691141710-1-1", -1},
+    {"23Y00665-zB", "2:11.~0-zaYbyz.256", -1},
+    {"510-.++~", "1510-.++~", -1},
+    {"00:8AYy.", "10:13", -1},
+    {"0ayy000679~+yaZ-~YZ000514Bza.", "0ayy000679~+yaZ-0~YZ000514Bza.", -1},
+    {"12000413-.-ZYBA+", "12000413-~-ZYBA+", 1},
+    {"7+.~-bYA~1110031209304838788888645115", "7+.~-bYA~11100312093048387888818645115", -1},
+    {"3YAZAyz", "3YAZAyz-1-1", -1},
+    {"2000702", "6-abb~00239255-~0975", 1},
+    {"10:9+92003697462757029839273061+z", "910:9+92003697462757029839273061+z", -1},
+    {"102560876~8981289525003709304716304073575b-00170+7340516136114503869090800411536225010837171508795420184294950151", "102560876~8981289525003709304716304073575b-00170+7340516136114503869090800411536225010837171508795420184294950151~rc1", 1},
+    {"129921Yb-7551579633210029985901770020515261457", "129921Yb-7551579633210029985901770020515261457~1", 1},
+    {"8100000645100552838608205956750959350636662392738153854812731162968-105746538684591140528671632369661995318", "8100000645100552838608205956750959350636662392738153854812731162968-105746538684591140528671632369661995318~1", 1},
+    {"2:0yZ1BYa-+.", "1:0yZ1BYa-+.", 1},
+    {"110-Bz.-zaz.00731A", "0:110-Bz.-zaz.00731A", 0},
+    {"011y000719-zZ", "011y000719-zZ~", 1},
+    {"2:7106500698597746774307945600.99-110198+", "2:7106500698597746774307945600.99-110198+~rc1", 1},
+    {"2:8a85780620818924062221268-2-000320AyAbzb3", "2:8a85780620818924062221268-2-000320AyAbzb3.", -1},
+    {"3y", "10:9+87022978254315097165471889789516826991-.AaZ00473", -1},
+    {"0yyB", "43~05020599", -1},
+    {"89", "1:89", -1},
+    {"7BZaZZ-~Yy", "7BZaZZ-~Yy~a", 1},
+    {"10:21-255100-1000787B68854913831460766125834752716255709763", "10:21-255100-1000787b68854913831460766125834752716255709763", -1},
+    {"6228454054556973519653077074590222194", "12b-Aazy00746", 1},
+    {"499111-ZBa+0.", "10:499111-ZBa+0.", -1},
+    {"0B-+", "2:0B-+", -1},
+    {"30721365678331355790412-2", "10:30721365678331355790412-2", -1},
+    {"8bb2567076779805882371297645395-~5494790361617516414141310968556+.", "8BB2567076779805882371297645395-~5494790361617516414141310968556+.", 1},
+    {"6y000395-11~00063", "6y000395-011~00063", 0},
+    {"1zAy00562~255-0063537127676411135830217699903", "0:1zAy00562~255-0063537127676411135830217699903", 0},
+    {"2:5-bb.4044537682322630419512242851-zZ10.+", "2:5-bb.4044537682322630419512242851-zZ10.+A", -1},
+    {"4000708.--.25500230A", "2+.00049-zbb240326744466845626988yBZbaYz", 1},
+    {"10:100023865235445264287162884949144925086168BB+abz-Aa9..~", "10:100023865235445264287162884949144925086168bb+abz-aa9..~", -1},
+    {"1081722853989652812153642603557435974ab+5181176750549484857360216423495180-BB", "1:12~zbb+0776-~000211", -1},
+    {"1:0bA-YZB.256-8887193396173124015431045655424802869422255AB", "10:0bA-YZB.256-8887193396173124015431045655424802869422255AB", -1},
+    {"00:0255-25610", "300027+-.00", -1},
+    {"12.000509ABAB-+00011010a100", "1:10zB", -1},
+    {"1:2+000484", "1:2+000484.", -1},
+    {"10BaZbb100a", "10BaZbb100a-1-1", -1},
+    {"5100b99-zAB~", "0:5100b99-zAB~", 0},
+    {"1100948+~", "1100948+~~", 1},
+    {"2:4AyzBBb-100b.", "2:04AyzBBb-100b.", 0},
+    {"90017625520261-+19637448724068751383696929231354", "90017625520261-+196374487214068751383696929231354", -1},
+    {"1:111255a-~.", "6azA2560971", 1},
+    {"11.+ABb812445598286262778271190103", "00049910", -1},
+    {"11AZz~-10~-ZY885394282356268036448245187179276858404000514yY66382536319883232201836549313", "11AZz~-10~-ZY8853942823562680364482451871792768584040000514yY66382536319883232201836549313", -1},
+    {"9256+361441378873923121378965327742634994", "9256+361441378873923121378965327742634994~", 1},
+    {"1:12B-yb~11357750752608137359974", "12B-yb~11357750752608137359974", 1},
+    {"00:1237401813601879045125502195299255+.-bAyzA~", "5+255900906-Yabb", 1},
+    {"3+ZAA-0yY000361", "3+ZAA-00yY000361", 0},
+    {"10255100y", "10255100y~~", 1},
+    {"3BbBy-00345004111100", "3BbBy-00345004111100~1", 1},
+    {"10:2z9~.9-396260054182435943452090138752434979328110075885380416801745686", "10:2z9~+9-396260054182435943452090138752434979328110075885380416801745686", 1},
+    {"4-BAY-9900692742961086431415378204447266677080156956100", "4-BAY-9900692742961086431415378204447266677080156956100A", -1},
+    {"1:11639614544120326913466317-Aya256+85178261244859815076605146051710", "1:11639614544120326913466317-aya256+85178261244859815076605146051710", -1},
+    {"01:5.-.81483085789682169653718464341348.AAY", "01:5.0.-.81483085789682169653718464341348.AAY", -1},
+    {"0:3+Yy", "0:3+Yy-1", -1},
+    {"8+.624419014864923384756044608569097472aAb00604-9ZyY.", "1000815", -1},
+    {"200201+~--a~", "200201+~--a~a", -1},
+    {"119733146841239601371ByZ000911BYz-90816133853739467001802954", "119733146841239601371ByZ000911BYz-90816133853739467001802954A", -1},
+    {"161940654736990351460", "161940654736990351460~", 1},
+    {"10+-0205", "10+-0205~a", 1},
+    {"10:5Ayy:11ZAZ-200165", "10:5Ayy:11ZAZ-200165-0", -1},
+    {"12.az11003-211bB", "12.az11003-211bB~rc1", 1},
+    {"4000526-.-16630987533352358109866715", "4000526-.-166309875333052358109866715", -1},
+    {"00:11yA-18270037105457754544", "11yA-18270037105457754544", 0},
+    {"0:66218687065767144453286941814256:", "2:66218687065767144453286941814256:", -1},
+    {"60096700322BB.-0419+0004751112378314146718427955831869", "60096700322BB.-0419+0004751112378314146718427955831869A", -1},
+    {"1:8:6298657018008028602361291581455+-1100860+~~", "1:8:6298657018008028602361291581455+-1100860+~~a", -1},
+    {"9~zz~+00826-255", "2:2ybz-aaa9", -1},
+    {"12-000781z-.", "10a0-11", 1},
+    {"10:4000953aBz25600853a", "10:4000953aBz25600853a~rc1", 1},
+    {"1:107835438269800304102794000991", "10255.99-yy+~", 1},
+    {"3398039599688715705026894435250388-28957035008212603200zZ~.~", "3398039599688715705026894435250388-28957035008212603200zZ~.~-0", -1},
+    {"4Ayz.0069900626", "5Yz.aaz", -1},
+    {"6~", "6~-1-1", -1},
+    {"12~878894489845127539111009272-3", "9.+ay", 1},
+    {"30275y256-YYYb+00999", "0:30275y256-YYYb+00999", 0},
+    {"00:910A12000259-byB", "910A12000259-byB", 0},
+    {"10:4AAz+544956060624298171243--aayZ99024", "1:4AAz+544956060624298171243--aayZ99024", 1},
+    {"1aZbB-~.A.", "1aZbB-~.A.~1", 1},
+    {"7~-11+Z~", "7~-11+Z~~1", 1},
+    {"2:20027~-+11691446318937570960763390527416.", "2:20027~-+11691446318937570960763390527416.~rc1", 1},
+    {"8097-Zyzya-19540536185592450575469287429+~.", "8097-Zyzya-19540536185592450575469287429+~.~", 1},
+    {"0:7YZA00684z00392", "0:7YZA00684Z00392", 1},
+    {"12256103-02200000872az3", "12256103-002200000872az3", 0},
+    {"7BaY070866+000889-~.B", "7bay070866+000889-~.b", -1},
+    {"1+.11AbA-Aa11zyYZb3566010675511708745", "1+.11AbA-Aa11zyYZb3566010675511708745~a", 1},
+    {"1.", "1.-1-1", -1},
+    {"12103-99+~", "10:5110031331622925705940630727205425600233z-aZ2", -1},
+    {"3yzB310za-25500015600031870649422357037162897238391109639046~", "3yzB310za-25500015600031870649422357037162897238391109639046~~a", 1},
+    {"00:5AA--10-~zZ1A", "00:5AA--10-~zZ1A~", 1},
+    {"5BYa000445", "5BYa000445-1-1", -1},
+    {"11BYZ+1003", "11BYZ+1003~~", 1},
+    {"1255yz-2--b", "9Azb96903871960837787316415335707708352847-ya.", 1},
+    {"00:7.1000703:-++", "00:7.10007003:-++", -1},
+    {"01:31+BaYzA-255", "01:31+BaYzA-0255", 0},
+    {"0-0777010991214531414129999228710-z+0000500", "0-0777010991214531414129999228710-Z+0000500", 1},
+    {"3ZbB211000164000782-112551000002551", "10:4:", -1},
+    {"344960582347808886814726794035752377024808242423688406156578876AAa-AB", "00:9~AY", 1},
+    {"6000103000935-2553Y", "6000103000935-2553y", -1},
+    {"8~~4751034529650413473864703467609276-00136+ZZ+000275", "00:9Az000555Aa:Y-zz", -1},
+    {"11Y-.~23.", "11Y-.0.~23.", -1},
+    {"7b99By11bY-Zz.99", "7b99By11bY-Zz.99+b1", -1},
+    {"0:1110076553805667273461725791-z14494517557195146913483~256zBY", "0:1110076553805667273461725791-0z14494517557195146913483~256zBY", 1},
+    {"2:6abyaa-+B-515459237680770206710", "6abyaa-+B-515459237680770206710", 1},
+    {"8+-+11ZZ+", "8+-+11ZZ+~a", 1},
+    {"9-~Yyy-zA825265453160211132673976460773534412393016095939959145071263488289933", "9-~Yyy-zA825265453160211132673976460773534412393016095939959145071263488289933~rc1", 1},
+    {"10:3~", "1:3~", 1},
+    {"12Yya~yYZ-ZB2551ZBb", "12Yya~yYZ-ZB2551ZBb~rc1", 1},
+    {"01:18625367792197893811831BzZ-.", "01:18625367792197893811831bzz-.", -1},
+    {"0:0a256", "0:0a256~~", 1},
+    {"0Y100-+", "0Y100-0+", 1},
+    {"31-9+00643-ZByZ99256~", "31-09+00643-ZByZ99256~", 0},
+    {"91176028199433528238710341039863994873531959926224837862000556", "0:91176028199433528238710341039863994873531959926224837862000556", 0},
+    {"10:5AZaYB256~-+ab+000513000818", "2:5AZaYB256~-+ab+000513000818", 1},
+    {"1110000860-B-+BZza", "2:1110000860-B-+BZza", -1},
+    {"7670829844708652334840357558659~300282", "7670829844708652334840357558659~300282~1", 1},
+    {"2:8123007430563270637556362YAaBZz", "1:224490230182730473745427530000633-zyz6353459976554478334683575843", 1},
+    {"7azB6563238080740276436460-0918-aBB11+Z", "7azB65632398080740276436460-0918-aBB11+Z", -1},
+    {"0AY.-00339", "510-255", -1},
+    {"0:3~000208AZy-.", "2:3~000208AZy-.", -1},
+    {"01:2:10-112541750215531521729515255", "2:10-112541750215531521729515255", -1},
+    {"2:11:Z0064+10", "2:111:Z0064+10", -1},
+    {"5b--256.72901929090193397187y+", "5b-0-256.72901929090193397187y+", 0},
+    {"3.-AA2-0726282671549696159155365571511017", "3.-AA2-07926282671549696159155365571511017", -1},
+    {"3Zz.93zY", "3Zz.93zY~rc1", 1},
+    {"12BYa000877-6147756749411903455+b0581", "12BYa000877-6147756749411903455+b0581~rc1", 1},
+    {"00:5~", "0:12A000750062", -1},
+    {"00:1BAaZ", "00:1BAaZ-1-1", -1},
+    {"00:75121670340042310702033796000320-:-+", "710-103419010115656339560.", 1},
+    {"2:4461096350154153447516130206854763296765AYy.99B-3112", "06553654747857964010248028676b9", 1},
+    {"5~90024-bzY2", "1:5~90024-bzY2", -1},
+    {"1:10~.~-10", "1:10~.~-10-0", -1},
+    {"2:10:-+A.YY256", "2:10:-+A.YY256~1", 1},
+    {"4000803~-0932B", "4000803~-0932B~", 1},
+    {"9~7318195722035298961388bA100bz", "9~7318195722035298961388bA100bz~", 1},
+    {"01:32765307482216964550407bYa100000471", "01:32765307482216964550407bYa100000471.0", -1},
+    {"10:4bZa.-3~aY", "10:4bZa.-3~aYA", -1},
+    {"1:600290", "1:600290~", 1},
+    {"9100", "9100-1-1", -1},
+    {"0:120007171-Z26372678244637885201272474710Zy573192580285237785551615595158355497", "0:120007171-z26372678244637885201272474710zy573192580285237785551615595158355497", -1},
+    {"7+11-60530358858458603744142983440630995+", "7+11-060530358858458603744142983440630995+", 0},
+    {"3+y.", "3+y.0.", -1},
+    {"4yyABB-+-0007181125582127629460114895444040392752214156857", "4YYABB-+-0007181125582127629460114895444040392752214156857", 1},
+    {"00:599:+10000190", "00:599:+10000190+", -1},
+    {"1YyYBZZ---11Z531349569679345332217682746184000226", "1YyYBZZ---11Z5313409569679345332217682746184000226", -1},
+    {"30626.256--~99.AAYyA", "30626.256-0-~99.AAYyA", 0},
+    {"00:120588-2550.28119187940763885279227", "00:120588-02550.28119187940763885279227", 0},
+    {"91~.", "100334~255byy-aBA", -1},
+    {"0:6255.Z-.~YyabB", "0:6255.Z-.~YyabB~", 1},
+    {"11~+39037691417965251823197158BBybbY", "1:93~00900", -1},
+    {"62552.0949-2Yy", "62552.0949-02Yy", 0},
+    {"3ZZB0b-A000253", "1:4:+-10~3bayA", -1},
+    {"00:10~857457024681385382599715755974975942649040607902300~100", "00:10~857457024681385382599715755974975942649040607902300~100.0", -1},
+    {"4..82943341242089795928446832113390761786abY-~340139081676086750443230947", "00:0~.6423932163956697464202132130-0837bB~+00299", 1},
+    {"10:12zzy0618-2", "10:12zzy0618-2+", -1},
+    {"1:7bY~", "1:7by~", -1},
+    {"9~~~0001210360", "9~~~0001210360~a", 1},
+    {"12580971512284024746670084437921380000689Z0536-.256YBy", "12580971512284024746670084437921380000689Z0536-0.256YBy", 1},
+    {"4azy80602737605942547494008522399507--.yy4451588969321308469557126779644904081", "4azy80602737605942547494008522399507--.yy4451588969321308469557126779644904081-0", -1},
+    {"10za-+++256", "190za-+++256", -1},
+    {"1:1011.-Y256-aAZ4886088026793657767684257972392880013.9", "01:2bZ11", 1},
+    {"77652722649707924256881706412862859747671", "08864619005438111861794610180078.-99~2388760664323223893", 1},
+    {"6.BbYBa", "6.BbYBa-1-1", -1},
+    {"7yzY", "7yzY~rc1", 1},
+    {"41-bZB000721-.", "41-bZB000721-..0", -1},
+    {"11b0827-0120..", "11b01827-0120..", -1},
+    {"4bZa6227167686910773948545", "4bZa6227167686910773948545a", -1},
+    {"6891154589417036992520593866487023-30919.", "6891154589417036992520593866487023-30919.~a", 1},
+    {"00:199-00868b2560250", "00:199-00868b2560250~", 1},
+    {"2:50bzY-1005821419637514483702979558967758733", "129239373442399549692789435263659", 1},
+    {"6555419839742494519449416760969574092378ZaBY1001-~YABA310", "6555419839742494519449416760969574092378zaby1001-~yaba310", -1},
+    {"03215568705509399931248996900045411-z99651643171011229852640", "31ZB-+~9", 1},
+    {"1-zzY1009159519500118860192311-+00~.", "1-0zzY1009159519500118860192311-+00~.", 1},
+    {"1200094600458011490618789089576450920117851325546721491189083595", "01:2~baA255", -1},
+    {"11ZA++-~", "01:11~00681+--9", -1},
+    {"00:289443477624257730890074+", "00:28944347762400257730890074+", -1},
+    {"12~~-2550155bZ", "12~~-2550155BZ", 1},
+    {"700528+zAY-1117923351007432691708822830795867515216", "700528+zAY-01117923351007432691708822830795867515216", 0},
+    {"0.~~", "000.~~", 0},
+    {"00:20yY9067", "1:20yY9067", -1},
+    {"11bzyz-9422942949626037717799bA993358301454384088731", "11bzyz-09422942949626037717799bA993358301454384088731", 0},
+    {"00:61-35026048294127686272257947904140044903540567", "00:61-35026048294127686272257947904140044903540567~rc1", 1},
+    {"0+.-0994", "0+.-0994-0", -1},
+    {"00:11b", "00:11b~~", 1},
+    {"01:8+-A", "3~.1011bZ", 1},
+    {"1:60004460-25600888B00034400544", "1:60004460-25600888B00034400544~1", 1},
+    {"10:32Bb--Ya000476408937138319450762778102", "1:9ZyY-Z-255~", 1},
+    {"70388-99", "700388-99", -1},
+    {"11-99zYY-0590+bYa1", "11-99zYY-0590+bYa1~a", 1},
+    {"11097BzZZy9-Y4253363035357787455879316309599165947100", "11097bzzzy9-y4253363035357787455879316309599165947100", -1},
+    {"10:12000886.AZy-..12", "10:12000886~AZy-..12", 1},
+    {"1:210aZ100b-~BYY9796874721091067706978918006319592", "1:210AZ100B-~BYY9796874721091067706978918006319592", 1},
+    {"3zaA00504", "3ZAA00504", 1},
+    {"1y-.AAz.10+", "1y-.AAz.10+A", -1},
+    {"6Zb0.28694246532433705020-6015590036596433306154404306329aAZ9~", "6Zb0~28694246532433705020-6015590036596433306154404306329aAZ9~", 1},
+    {"3+Y110255-yyBz", "3+Y110255-yyBz~a", 1},
+    {"8992113-ab~", "8992113-ab~~rc1", 1},
+    {"0:889790466194906654167885452519.Y11-9194239556179933134118636443375202634989+3", "1:889790466194906654167885452519.Y11-9194239556179933134118636443375202634989+3", -1},
+    {"12.000389B-1100403", "12.000389B-1100403~a", 1},
+    {"0:11:03-5732493589554293953874zA3zz~", "2:11:03-5732493589554293953874zA3zz~", -1},
+    {"10.y", "10.y~", 1},
+    {"10yAY", "7+256.+", 1},
+    {"1:103-+859522025064570229314B00583a", "103-+859522025064570229314B00583a", 1},
+    {"3.822625617409270449774912710359065558~+BBB-1BZ", "3.0.822625617409270449774912710359065558~+BBB-1BZ", 1},
+    {"8ayaby-10", "8ayaby-10~rc1", 1},
+    {"6.Y-000669+", "6.0.Y-000669+", 1},
+    {"2:52991206218157403326325442700023799", "2:529912062181574033263254427000237919", -1},
+    {"0:0:zAY000828", "0:zAY000828", -1},
+    {"0:0z9Y755067706975852256704297700546715653-9~00673", "2:1--112Z", -1},
+    {"2.ayazB-3~.", "2aayazB-3~.", 1},
+    {"8+", "0:3:16031649314012738622993176256278024020075668652807661934739143043603557436752-..0~~", 1},
+    {"10:4Z-000621255-+bZ181622331009559962733654", "10:4Z-000621255-+bZ181622331009559962733654~1", 1},
+    {"00002801729330997651435226000468-022630364", "000020801729330997651435226000468-022630364", -1},
+    {"0996701300056060177532581445738039176813795057463911-966397701043574784296598~Y~99", "0996701300056060177532581445738039176813795057463911-0966397701043574784296598~Y~99", 0},
+    {"4362596286646176678346Z10-.2562", "4362596286646176678346Z10-.2562~a", 1},
+    {"4~0-+", "3004518109469123058037643633~-0", -1},
+    {"11B", "11B-1", -1},
+    {"101Bb11.-000824+", "101bb11.-000824+", -1},
+    {"3.20617007250692052150661001940-05590+", "0:3.20617007250692052150661001940-05590+", 0},
+    {"82641181816730508006088948azbA--.0003690014410011", "82641181816730508006088948azba--.0003690014410011", -1},
+    {"1.00443255Y99-36760735400595496621060847009231YZB255~", "1+00443255Y99-36760735400595496621060847009231YZB255~", 1},
+    {"00:9bA11256~Ya-00938705566674610704275754339568629160594511az43079596855026409857290256", "1:971865338349937876429036986048954145303793799020006", -1},
+    {"2:1AyZ9000745-AB", "1:5Ba-:-..1000100", 1},
+    {"23527558885015753896+34052198130938119814415448924255-Yz.100Z.", "2350027558885015753896+34052198130938119814415448924255-Yz.100Z.", -1},
+    {"500711.00476.", "0:500711.00476.", 0},
+    {"2:1-~-..-YBZ+A10", "2:1-~-..-YBZ+A10+b1", -1},
+    {"3++9", "10:1.Ya1-aBz99", -1},
+    {"1bzabZ255953520348389630093160", "1bzabZ255953520348389630093160~a", 1},
+    {"00:8AZ3+", "00:8AZ3+~", 1},
+    {"9.5782048954873286553351779130051636364802-zB0144-~256783388981859319680872571032328967543", "9.5782048954873286553351779130051636364802-zB0144-~256783388981859319680872571032328967543~a", 1},
+    {"1:1847979679550296943066277628951583442311A.--2+", "6133508020940184946214253464114953771531715897033317", 1},
+    {"9a+", "9a+~rc1", 1},
+    {"3.++255-23615411907992743189824630833.", "3.++255-23615411907992743189824630833.-0", -1},
+    {"89--.0572.+000972", "89--.0572.+000972~a", 1},
+    {"01:99585932484408520055443028013039259~-zAZ", "01:99585932484408520055443028013039259~-zAZ-1", -1},
+    {"12224993569940183097643313906956~yaa.78742210864427014895836217164805212", "12224993569940183097643313906956~yaa.7874221086400427014895836217164805212", -1},
+    {"7.-7532672835082843879506794970901328749154ZBB56803781348739287849961748", "7.-07532672835082843879506794970901328749154ZBB56803781348739287849961748", 0},
+    {"00:6-YAZ-AY5279867668588380552770713756~3", "00:6-YAZ-AY5279867668588380552770713756~3-0", -1},
+    {"2+...3-2z+1003857279242395762880916", "2+...3-02z+1003857279242395762880916", 0},
+    {"1:9:034019-000942255255", "1:9:034019-000942255255a", -1},
+    {"2:6ByY762735712892102829279885856243-Y+", "2:6ByY7627395712892102829279885856243-Y+", -1},
+    {"100218-+~Y+10", "1001218-+~Y+10", -1},
+    {"1:11+.-AA13320854733120931715547913417476475046+", "11+.-AA13320854733120931715547913417476475046+", 1},
+    {"00:30665ay-ZyZ24339625703139014126058915bAy43920916563755329520904750", "00:30665ay-ZyZ24339625703139014126058915bAy439209165637553295209049750", -1},
+    {"6YY255--+-~41814889747668819330408000386", "6YY255-0-+-~41814889747668819330408000386", 1},
+    {"11~99", "1:11~99", -1},
+    {"10:5AZz683647140277127566773537657121048b+-141244314884645335495448bBb2", "10:5AZz683647140277127566773537657121048b+-141244314884645335495448bBb2+", -1},
+    {"10Z-yZ000673", "10:10Z-yZ000673", -1},
+    {"70.+a11-117880396575103473033932774691291819759964648717901474822637257~", "70.+a11-117880396575103473033932774691291819759964648717901474822637257~~a", 1},
+    {"1AyaAZZ0402-~", "10:1AyaAZZ0402-~", -1},
+    {"12000324z-aBzzay.9256", "12000324z-aBzzay~9256", 1},
+    {"0:12.B002100516b-~", "0:112.B002100516b-~", -1},
+    {"2B", "0:2B", 0},
+    {"89", "89~~", 1},
+    {"7~9954636492774644663132859072034800222440599-~++~", "7~9954636492774644663132859072034800222440599-0~++~", -1},
+    {"3+11AZ-0727.", "3+11AZ-0727a", 1},
+    {"0:5~", "0:5~-1-1", -1},
+    {"01:4910ZbBZb", "10:4910ZbBZb", -1},
+    {"1Zb255zYy", "01Zb255zYy", 0},
+    {"00:80ZBy0609abZ", "00:80ZBy0609abZ+b1", -1},
+    {"10:1110~6130972310373828237719190359304136-AbY-31504150044542787732305146200080~00010", "10:1110~6130972310373828237719190359304136-AbY-31504150044542787732305146200080~00010~rc1", 1},
+    {"2:11bb1002ByyY-+100", "11bb1002ByyY-+100", 1},
+    {"0:0bBzYA.10", "4YZA00679-~000354z", -1},
+    {"00:1100-B4893884523118499160746413851A-80574545948229059175462584006297480688976163BBB1334814410979191725+", "00:1100-B4893884523118499160746413851A-80574545948229059175462584006297480688976163BBB1334814410979191725+~1", 1},
+    {"1:10bZ.-11-.313974379776656346405783~00257", "10bZ.-11-.313974379776656346405783~00257", 1},
+    {"30009099.32588438245177176110654212762Z-az0+ZaY11", "5bz", 1},
+    {"630576296384198306836060aBYYZZ2BA", "630576296384198306836060aBYYZZ2BA.0", -1},
+    {"6.ZAZ-00754y255", "6.0.ZAZ-00754y255", 1},
+    {"0:3110591-+100.+", "10:1.-+", -1},
+    {"599-0", "599-00", 0},
+    {"2:4:Z~-~", "4:Z~-~", -1},
+    {"200562043799000658-+~00327", "0:2000247.-+0483+", 1},
+    {"2:3aY9035215770196735190694629479-~-9489157876993206483616746929461323352+11", "2:3aY9035215770196735190694629479-~-9489157876993206483616746929461323352+11~1", 1},
+    {"0:4Zbz2256", "0:4Zbz2256~~", 1},
+    {"03Y-77448027388756259398909744", "03Y-077448027388756259398909744", 0},
+    {"0176317011730522149802640469850.9.-0183", "0176317011730522149802640469850.0.9.-0183", 1},
+    {"20576", "2057006", -1},
+    {"011-YyY255", "011-YyY255~~", 1},
+    {"59.-11", "059.-11", 0},
+    {"20946~791735458871769058880820644489040819507~0054", "9981178491480836185739730001480526-255bY.", -1},
+    {"7+YaZYBBBAa+-z", "0:7+YaZYBBBAa+-z", 0},
+    {"7bbz02189900517-.~zAy", "1:7bbz02189900517-.~zAy", -1},
+    {"0:0.78343472856311636133943416157040190by-AazBaa", "0:0.78343472856311636133943416157040190by-0AazBaa", 1},
+    {"53.-.100", "53.-.100~a", 1},
+    {"9ABy+0035012129474686591075283--YyyaYy", "9A109-.000762437948542479577625511~.", 1},
+    {"1:9000323255", "900495z99-AZzZY", 1},
+    {"8399bZ~Z-~.+.", "8399bZ~Z-~++.", 1},
+    {"0:20749001143", "0:20749001143-1-1", -1},
+    {"10:393652872633173676202101614602245322zaZ32882320419454723190.BBy-~2560.", "10:393652872633173676202101614602245322zaZ32882320419454723190.BBy-~2560.~rc1", 1},
+    {"19", "0:19", 0},
+    {"1:21104144199441599729023487767668715297564804312840021904786522079492-7171706226417831293532985026600327~Azz", "1:21104144199441599729023487767668715297564804312840021904786522079492-7171706226417831293532985026600327~AZZ", 1},
+    {"11--2.100", "0:11--2.100", 0},
+    {"200645Ba", "200645Ba-1-1", -1},
+    {"110129y-32454272756521216787831.1zY", "110129y-032454272756521216787831.1zY", 0},
+    {"711..32", "11-+3.-0+a~", 1},
+    {"93aa49198193097347325733444~-.b~yYA", "93aa49198193097347325733444~-.b~yya", -1},
+    {"00:12000455+-zB", "900:12000455+-zB", -1},
+    {"6~9", "2:1009:999895111545895195915731693-BB0345", -1},
+    {"0-ZBYZ0644yb-03760945b9", "0-ZBYZ0644YB-03760945B9", 1},
+    {"2:101100-YyB256~.1", "2:101100-YyB256~.0.1", 1},
+    {"11.00510", "2:11.00510", -1},
+    {"5255-000909y3b00266", "5255-000909y3b00266a", -1},
+    {"5byz+", "2:5byz+", -1},
+    {"9YZA+-256", "9YZA+-2156", -1},
+    {"0YA-99a100", "10.-00829+0335+", -1},
+    {"01:1211-.~aBY+~", "01:1211-.~aBY+~~1", 1},
+    {"9+9~+", "9+9~+~a", 1},
+    {"8000296aY-.", "8000296aY-.~", 1},
+    {"3Az-0091B100.", "3az-0091b100.", -1},
+    {"0256-00838", "0256-00838~1", 1},
+    {"1:3bZ-.0900", "1:3bZ-0.0900", 1},
+    {"10:200991:zZa-2551002680265", "10:200991:ZZA-2551002680265", 1},
+    {"0baAYYa-9YZ+", "0baAYYa-9YZ+~rc1", 1},
+    {"1:27758603182339815757205342951051555168AYABZ1010-By+45977811078967578509718502723765031159", "1:27758603182339815757205342951051555168AYABZ1010-By+45977811078967578509718502723765031159-1", -1},
+    {"811bBB-z-~11", "0:811bBB-z-~11", 0},
+    {"1:12zaA-000294", "1:12zaA-000294+", -1},
+    {"4y-056023764849644082976184398567534323395889736.11", "2:5ZY000905:000609-2929844685441270369385~", -1},
+    {"4+11.-99078599", "4+11.-9907800599", -1},
+    {"600053000278y~-A", "600053000278y~-0A", 1},
+    {"10b0004359YyB.", "0:10b0004359YyB.", 0},
+    {"11.102739", "11.102739-0", 0},
+    {"8zaAzzA-~-BZ56516731488690133661Z+.", "0256~-yBYZ256~10", -1},
+    {"700649-6898245602476062120804798822808", "700649-68982456024760621208040798822808", -1},
+    {"2:7009036549349047182390695406515809056255000433", "2:7009036549349047182390695406515809056255000433~", 1},
+    {"41001-Ba000147-~11", "41001-Ba000147-~11+", -1},
+    {"10:102+797321780226744660923644769125629308845+-+", "10:102+797321780226744660923644769125629308845+-+~a", 1},
+    {"110836.yaaa-.Z..", "10:110836.yaaa-.Z..", -1},
+    {"0z7051966468114101498088985521496782196009719900742-ZAa256", "0z7051966468114101498088985521496782196009719900742-ZAa256~rc1", 1},
+    {"10YBB+-aB-9550196843742037345075284391024514967Az~", "2:139640560435098402471833599835139287537434259836320166984+:4293805920760489091356120370346608-~~255y~", -1},
+    {"6Ba~28599166454894295365+-821230888513240870038251883331818825722", "6Ba~28599166454894295365+-0821230888513240870038251883331818825722", 0},
+    {"1111.11255YBY-+yBy00529", "1111.11255YBY-0+yBy00529", 1},
+    {"00:576262507180426133893932697524669624806255-2562...", "00:576262507180426133893932697524669624806255-2562...~rc1", 1},
+    {"9Zz.99~", "9Zz.99~~", 1},
+    {"1:299~y-000928", "299~y-000928", 1},
+    {"12562~zy", "0:12562~zy", 0},
+    {"00:12+-200502", "00:12+-200502+b1", -1},
+    {"112.YZaBbZ-0512", "7992-yZ.255By0540", -1},
+    {"79-Z1099-9+", "0:79-Z1099-9+", 0},
+    {"10:5::0255-3..", "10:5::0255-3..+b1", -1},
+    {"1000563yaA.-ZbA10011.", "1000563yaA.-0ZbA10011.", 1},
+    {"3+-10025666240973257533863424-.11.~", "3+-10025666240973257533863424-.11.~~1", 1},
+    {"000369a1bA-.zZy9+", "000369a1bA-.zZy9+~a", 1},
+    {"700773~a-y-B", "4AY100-..BaA~Y", 1},
+    {"0:5+B110", "00:6100:-8911742619429201506", -1},
+    {"00:9~", "00:9~~rc1", 1},
+    {"537588605950656975893213230310994908460734293814905128478245790600461701475437528-.899288992210682320033336024895100218", "537588605950656975893213230310994908460734293814905128478245790600461701475437528-.899288992210682320033336024895100218-1", -1},
+    {"800600-0847", "11000222-8200540071205260336205800426000929bb", -1},
+    {"8~2BAz-00752Z0762", "8~2BAz-000752Z0762", 0},
+    {"10:7000937:-~+~", "6~-99A100430801128865906378010386903136946084", 1},
+    {"5-857888289815076760422989963793720371680082602011-.", "5-857888289815076760422989963793720371680082602011-..", -1},
+    {"31255Bb--YBb39999156782868450805759855674068", "2:31255Bb--YBb39999156782868450805759855674068", -1},
+    {"01:59911-+b", "59911-+b", 1},
+    {"5255ZYY-~", "5255ZYY-0~", -1},
+    {"00:6bZZYzb000651006677447433042578516085", "00:6bZZYzb9000651006677447433042578516085", -1},
+    {"5bBb+-+", "005bBb+-+", 0},
+    {"80372~0736zb.-256", "0:80372~0736zb.-256", 0},
+    {"1:9+--000427", "1:9+-0-000427", 0},
+    {"01:4Zaa00193+0911", "4Zaa00193+0911", 1},
+    {"10-bAa.~-3~", "10-bAa.~-3~~a", 1},
+    {"98474029534934267338960797076974139232676255256-Y51000656775083657432137209243172400669z~", "98474029534934267338960797076974139232676255256-0Y51000656775083657432137209243172400669z~", 1},
+    {"8YZayYA", "8YZayYA.", -1},
+    {"3yZA255-100~~Ybb", "3yZA255-100~~Ybb~rc1", 1},
+    {"8B0A100.-00040650818655933305405998683174896305", "8b0a100.-00040650818655933305405998683174896305", -1},
+    {"2:3255zyY-.11-yBb.", "2:3255zyy-.11-ybb.", -1},
+    {"12-+0991Y-bZA", "00:11ZzZ-2", 1},
+    {"00:10YYz", "12+00768zAy9", -1},
+    {"91125611-000392bZb", "911125611-000392bZb", -1},
+    {"12+", "6yYY-100", 1},
+    {"10000105100+aYB+-++", "10000105100+aYB+-+++b1", -1},
+    {"1200887+256.", "1200887+2156.", -1},
+    {"00:5.00858-Bb01111+", "5.00858-Bb01111+", 0},
+    {"11688354869002565229903652552511628952aY0439-80206131788877866437263078", "10+00390", 1},
+    {"3~yyBzbz999092190833639972879-AB", "3~yyBzbz999092190833639972879-ABa", -1},
+    {"2.0387-000420255~.", "2.0387-000420255~.~~", 1},
+    {"1:0008809313455586325965069764439414075-BAA0051~", "1:00088093134555863215965069764439414075-BAA0051~", -1},
+    {"1:12Baz-yzYaby", "1:12Baz-0yzYaby", 1},
+    {"8+00687AzY", "0:8+00687AzY", 0},
+    {"10~-10", "1ab~256-46210861947074157845259247709884063444868581419808308985863", 1},
+    {"3z-+7032870723797256853168798041388600116", "6bBZ~-+7921331356919927251457755695204722122309z+~", -1},
+    {"4Yyz9zBy+10", "4Yyz9zBy+100", -1},
+    {"00:11100-99Bz9Yb00021", "00:11100-099Bz9Yb00021", 0},
+    {"810AbaAZayYA-..0b", "810ABAAZAYYA-..0B", 1},
+    {"1:90850", "10:90850", -1},
+    {"6YB.0199-Z", "6YB.0199-Z-1", -1},
+    {"3.2.90-~", "3.2.90-~~", 1},
+    {"0:8++-115017942811204442843102908503643776246255939277849298641094.", "2:8++-115017942811204442843102908503643776246255939277849298641094.", -1},
+    {"5-0978.100zY-B", "20263Z3ZyzyAy-zbBZ~", -1},
+    {"2992-.A~", "2992-.A~~~", 1},
+    {"0:8.-2b-254271979644469943469834157093.11", "0:8.-2b-2542719796404469943469834157093.11", -1},
+    {"6474438912952922269885947795084311~0798", "6474438912952922269885947795084311~0798-1-1", -1},
+    {"00:41ybA-+", "000:41ybA-+", 0},
+    {"0:4ZbZ-00790000941-.", "0:4ZbZ-00790000941-.~1", 1},
+    {"10~.8329533843808952797444119614a", "0:10~.8329533843808952797444119614a", 0},
+    {"01:90191+-51003867850862377762584658077733354+Azy+", "2:90191+-51003867850862377762584658077733354+Azy+", -1},
+    {"230.+0970", "230.+0970.0", -1},
+    {"5Z-.0283Bb", "5Z-.0283BB", 1},
+    {"4.-2Ba.-.+.bzY065", "11--006071", -1},
+    {"12+ZZ-958957636965667725072784603339039778512z11000999", "2:12+ZZ-958957636965667725072784603339039778512z11000999", -1},
+    {"0:6000251-52386728459488564796473489306703988629033654567869624559437962394YBz", "0:6000251-52386728459488564796473489306703988629033654567869624559437962394YBz~~", 1},
+    {"5~.Ab.000633", "0:5~.Ab.000633", 0},
+    {"5~~y", "5~~y.0", -1},
+    {"5.", "5.0.", -1},
+    {"0090-00274babYB+", "0090-00274babyb+", -1},
+    {"1100112.-Zy", "11001102.-Zy", -1},
+    {"01:30660000697-.bZ+", "01:30660000697-+bZ+", 1},
+    {"0ZzB~-.yZa-+", "0:0ZzB~-.yZa-+", 0},
+    {"40143Z-255ZA-940320380661671515002367646099", "10+3-~", 1},
+    {"2:12Z7197905796819656456995847672843355110-910BYA00877", "2:12Z71979057968196564569958047672843355110-910BYA00877", -1},
+    {"6BbY--+19762909351123871519062848253470020954000631Ba", "01:600340ZZz.", -1},
+    {"4.+100-+~yBYYaY", "4.+100-+~yBYYaYA", -1},
+    {"1000289.+.-1+100.0534", "095135852911665151531524072174981615519427747822693121539086YZb-000558ZA0", -1},
+    {"00:61--778324027278433051366830424807545845678..", "99+bB-100Y", -1},
+    {"10:911111110", "02564414351089165777942793", 1},
+    {"0:5+2100.00262-2000531..", "0:5+2100.00262-2000531..~~", 1},
+    {"12aABaAy011-00972", "12aABaAy011-00972~~", 1},
+    {"2:7283991619016133352818186107399826745-Y-AAY-+", "2:7283991619016133352818186107399826745-0Y-AAY-+", 1},
+    {"49657920841905978675283307204648823087911aaz78524877978394872381823958-256BYY256AzY", "49657920841905978675283307204648823087911aaz785248779783948723818203958-256BYY256AzY", -1},
+    {"1~BBB", "1~BBB~a", 1},
+    {"1:11730159577723032058435692608255-A+-.Aaz3", "1:11730159577723032058435692608255-A+-.0.Aaz3", 1},
+    {"4-.-11", "0:4-.-11", 0},
+    {"1111aYa3.", "1:1111aYa3.", -1},
+    {"0:82418367351833078775595409277986864445834:AbY:~-bY7528624862707562985560499584+", "0:82418367351833078775595409277986864445834:AbY:~-bY7528624862707562985560499584+-1", -1},
+    {"1:9+YY-ya-+99+~", "7.~Z99-+0", 1},
+    {"81", "81~", 1},
+    {"10:60166.4868837322246205873599687515557", "1:60166.4868837322246205873599687515557", 1},
+    {"00:3Y31788016180414519979784977605818434zBa", "00:3Y31788016180414519979784977605818434zBa~rc1", 1},
+    {"2:2:-abZ+", "0:0:zaY8349388938961982590987200287-13556791484250478528460515270256", 1},
+    {"2+-A.yZBz", "2+-A+yZBz", 1},
+    {"4~.-000590488107867847324180049905372bZ.bAA", "4~.-0005904881078678473241800409905372bZ.bAA", -1},
+    {"1:5BAa~00093099.", "1:5BAa~0000093099.", 0},
+    {"01:11~AZ-068434901322261799270933825.b100", "10:11~AZ-068434901322261799270933825.b100", -1},
+    {"126147176388927837793744B~-11-101189963669381835511765913920722555104586B00851", "40255100-~.bZ00645467962288597765684996968758561036018931", 1},
+    {"01:9--2", "01:9--2+b1", -1},
+    {"6999001820371028-zZya", "6999001820371028-zZya~1", 1},
+    {"120", "120-1", -1},
+    {"533128162815221324115877023290789Ya-604719320984248709979174073YBz4786257995953113020330127751860184110955", "533128162815221324115877023290789ya-604719320984248709979174073ybz4786257995953113020330127751860184110955", -1},
+    {"800731~-49946961933573312961700378~256.", "800731~-049946961933573312961700378~256.", 0},
+    {"01:1~.-B", "1~.-B", 1},
+    {"20392-256~00407", "20392-256~00407~rc1", 1},
+    {"00:10az-0166.0441Az", "00:10AZ-0166.0441AZ", 1},
+    {"7.65170758346945594555784065236741~azZz", "10:7.65170758346945594555784065236741~azZz", -1},
+    {"4ZbA+zbb-Zya~+", "4ZbA+zbb-Zya~+A", -1},
+    {"511.10991-00666+300452AYB", "511.10991-00666+300452AYB+b1", -1},
+    {"10:7Y-75771075461175938027337245680860918933000570a", "9111-6454549966213350539518605684902", 1},
+    {"32B~11b-39309735327078605364922896256671.+", "32B~11b-39309735327078605364922896256671++", 1},
+    {"067774405441044188757181043-3984816217954658429286245636473528000950001680", "10:810YYazB-9+aza3678134564885484654232073683842", -1},
+    {"599z-119.Z3", "599z-119aZ3", 1},
+    {"0:7bB000610.682740368487673360801654139039181010-04570127", "0:7bb000610.682740368487673360801654139039181010-04570127", -1},
+    {"10bZyAzB-0521Bba-.", "10bZyAzB-05021Bba-.", -1},
+    {"5007823200395", "0:5007823200395", 0},
+    {"01:1164891462906891294563744690855YbB~11", "1164891462906891294563744690855YbB~11", 1},
+    {"2:6+00147-11aby", "10z", 1},
+    {"01:11ZAZ100-2.+", "7baz+y.", 1},
+    {"12Z000405By0225~-zaYZ", "00:5:+b9", 1},
+    {"1:1aayb99", "1:1aayb99-1-1", -1},
+    {"11-ZA-000485.-3003412", "11-ZA-000485+-3003412", 1},
+    {"41", "491", -1},
+    {"200784137347399940516684217010010~-038.", "2007841373473199940516684217010010~-038.", -1},
+    {"11~99zzaYB.", "11~99zzaYB.-1-1", -1},
+    {"7A0-112.5726730975048629016BBA", "7A0-112.0.5726730975048629016BBA", 1},
+    {"10:1000545055B~-000344136430066699756206105746064651270201000636255", "10:1000545055B~-0003441364300666997562061057460646512170201000636255", -1},
+    {"10080066345789415870569355307581829519299B256-0080AAY1", "100800663457894158705693553075818299519299B256-0080AAY1", -1},
+    {"00:12:", "00:112:", -1},
+    {"2Ab+azZ", "2Ab+azZ.", -1},
+    {"12.-bZ~", "12+-bZ~", 1},
+    {"1baZ", "1baZ~a", 1},
+    {"82-~05283", "82-0~05283", -1},
+    {"4004411~", "4004411~~", 1},
+    {"61-.yaB~", "61-ayaB~", 1},
+    {"9~.", "9~.~a", 1},
+    {"2:52.", "2:152.", -1},
+    {"8.~--0890.~2550031", "8.~-0-0890.~2550031", 0},
+    {"9~-.AZYZ", "0:10000287", -1},
+    {"1YZz055-.", "1YZz055-~", 1},
+    {"10:9yBB~0310+-0311215179172159882274221714530991004137290150381546883260208915857", "10:9YBB~0310+-0311215179172159882274221714530991004137290150381546883260208915857", 1},
+    {"11+YBZY10+-2aa1", "0:11+YBZY10+-2aa1", 0},
+    {"12b0458~~-aAzZZaz", "12b0458~~-aAzZZaz~", 1},
+    {"01:5yzbb-.BB+~.", "01:5yzbb-+BB+~.", 1},
+    {"11baYAZ25520663614728967161450202-7447265231521178138963057446745426.3", "0:11baYAZ25520663614728967161450202-7447265231521178138963057446745426.3", 0},
+    {"1yA-255.yba.", "1yA-0255.yba.", 0},
+    {"8aza", "0:8aza", 0},
+    {"0:2zyY0915-6807778701034149209559694462535086303-~9", "10:2zyY0915-6807778701034149209559694462535086303-~9", -1},
+    {"0:40123yby+--0", "0:10:100229-11-~.~100", 1},
+    {"10:1291366336541942856886121622489395415-110Z256", "01:120.yb9Zy", 1},
+    {"4000120", "4000120-1-1", -1},
+    {"10795844490434970342456235015804579824-BaY000328~B", "10795844490434970342456235015804579824-BaY000328~B~a", 1},
+    {"7~aYa.-256+", "1:7Y00712+-~aYa9", -1},
+    {"10:12.90405Aa-Ya086000588", "510980826761444213541469810528838-~9199~", 1},
+    {"10~+zA--++.205308387959619066424638526211310227", "10~+zA-0-++.205308387959619066424638526211310227", 0},
+    {"6101-azaY", "6101-azaY+b1", -1},
+    {"6.8292401277691121691.zza055-yy~..1", "6.8292401277691121691.zza055-yy~..1~a", 1},
+    {"5-~-Az~255", "0:5-~-Az~255", 0},
+    {"0:9:0435.-00864255~", "9:0435.-00864255~", -1},
+    {"2:6003273095920709178719911581967114432646932035033385889320-.", "2:16003273095920709178719911581967114432646932035033385889320-.", -1},
+    {"3.0.9-1", "1.4.3-1", 1},
+    {"1.9.4-1", "1.99.4-1", -1},
+    {"1.5.82", "2.7.6-7", -1},
+    {"2.4+20151223.gitfa8646d.1-2+b2", "2.4+20151223.gitfa18646d.1-2+b2", -1},
+    {"0.58+deb12u5", "1:1.16.5-1.3", -1},
+    {"1:14.0.6-12", "1:14.0.6-12~1", 1},
+    {"1.0.8-5", "1:1.0.8-5", -1},
+    {"1.12-1", "2.5.4-1+deb12u1", -1},
+    {"3.4-1", "3+4-1", 1},
+    {"1.8.9-2", "0:4::-1000", -1},
+    {"2.9.4-5", "0:2.9.4-5", 0},
+    {"1.3.0-2", "0:1.3.0-2", 0},
+    {"1.46-1", "2:1.46-1", -1},
+    {"1:1.2.13.dfsg-1", "1:1.2.13.dfsg-01", 0},
+    {"2.9.4-5", "2.9.4-5~a", 1},
+    {"0.11.1-1+deb12u1", "3.3+20.604758e7-6.2", -1},
+    {"2.5.0-1+deb12u2", "1:14.0-55.7~deb12u1", -1},
+    {"3.11.0-2", "1:1.2.3-1", -1},
+    {"1:14.0.6-12", "2.0.0-1", 1},
+    {"122-3", "3.42.2-3+b1", 1},
+    {"1:2.66-4+deb12u2", "1:2.66-4+deb12u2~1", 1},
+    {"1.6.2-3", "0:1.6.2-3", 0},
+    {"1:1.1.2-1", "1:1.1.2-01", 0},
+    {"1:0.4.5-1", "1:0.4.5-01", 0},
+    {"0.99.30-4.1~deb12u1", "0.99.30-4.1~deb12u1+b1", -1},
+    {"2021.8.0-2", "1:1.2.13.dfsg-1", -1},
+    {"1:3.5.12-1.1+deb12u1", "1:3.5.12-01.1+deb12u1", 0},
+    {"2021.8.0-2", "3.8.1-2", 1},
+    {"2025b-0+deb12u2", "1.63.0+dfsg1-2", 1},
+    {"6.9.8-1", "2.71-3", 1},
+    {"1.2.6-5", "0.18+nmu1", 1},
+    {"2.1-6.1", "2.74.6-2+deb12u7", -1},
+    {"1.20.1-2+deb12u4", "1.7.1-1", 1},
+    {"0.3.9-1+b1", "1734987780663612162685109--bzy79686785398432629351821628063zz~", -1},
+    {"0.0~git20230123.b2528b0-1", "0:0.0~git20230123.b2528b0-1", 0},
+    {"1:0.9.10-1.1", "1:0.9.10-1.1~1", 1},
+    {"0.4.0-2", "0.4.0-2~", 1},
+    {"2.4.114-1+b1", "0.22-4+b1", 1},
+    {"1:1.2.13.dfsg-1", "3.40.1-2+deb12u2", 1},
+    {"2023.3+deb12u2", "3.11.2-1+b1", 1},
+    {"3.7.0-0.2+b1", "122-3", -1},
+    {"1:1.0.9-1", "1.0.9-1", 1},
+    {"1.21.3-1+deb12u1", "23a9za-36042195324528671429183725963550152Azz", -1},
+    {"23.0.0-1", "23.0.0-1~", 1},
+    {"2022.1-1", "0.16.1-2", 1},
+    {"0~20171227-0.3+deb12u1", "0.7.0+dfsg-8+b1", -1},
+    {"1.15.1-5+b1", "1a15.1-5+b1", 1},
+    {"1.6.3-2", "1:1.6.3-2", -1},
+    {"3.4-1+b5", "3.4.0-1", -1},
+    {"0.4-1", "0.4-1~~", 1},
+    {"0.13.0-1", "4.19.0-2+deb12u1", -1},
+    {"6.4-4", "3.0.17-1~deb12u3", 1},
+    {"1.74.0+ds1-21", "0:1.74.0+ds1-21", 0},
+    {"3.4-1+b6", "23.6-1", -1},
+    {"2:1.1.3-3", "1.0.11-1+deb12u2", 1},
+    {"1.201-1", "1.201-1.", -1},
+    {"0.11.1-1+deb12u1", "2.28.3-1", -1},
+    {"3.4-2.1", "01:89yY+99-100zZYYz.9", -1},
+    {"3.0.9-1", "3.0.9-1.", -1},
+    {"1.12.0-2+b1", "0.4-1", 1},
+    {"0.4.0-1+b1", "0~4.0-1+b1", 1},
+    {"1:5.44-3", "1:5.44-03", 0},
+    {"2.3.1-3", "0:2.3.1-3", 0},
+    {"1.2.1-1", "0:1.2.1-1", 0},
+    {"4.2.2-1+deb12u1", "1.12-1", 1},
+    {"9.0.2-1.1", "0.4.0-1+b1", 1},
+    {"122-3", "9.0.2-1.1", 1},
+    {"1.9.5-4", "1.9.5-4.", -1},
+    {"4.2.2-1+deb12u1", "1:1.1.4-1+b2", -1},
+    {"0.21.2-1", "0.5.12-2", 1},
+    {"4.9-1", "23.6-1", -1},
+    {"1.0.0-2+deb12u1", "2:1.0.0-2+deb12u1", -1},
+    {"4:12.2.0-3", "1:1.2.13.dfsg-1", 1},
+    {"1.0.8-5", "0.4.0-1+b1", 1},
+    {"1.4.3-1", "1.4.3-001", 0},
+    {"6.4-4", "4.1.4-3", 1},
+    {"1.2.4-0.2+deb12u1", "3.11.0-2", -1},
+    {"1:2.38.1-5+deb12u3", "1.5.0-1", 1},
+    {"4.0.0+ds-2", "10:7:-Bzz348535750135741053806", -1},
+    {"2.13.10-1", "2.13.10-11", -1},
+    {"1.31-1.2", "1:12AA", -1},
+    {"2.1.12-stable-8", "10:710516-148387966609878711556079y.b", -1},
+    {"0.08-5", "3.4-1+b6", -1},
+    {"2.36-9+deb12u13", "499-000421", -1},
+    {"2022.1-1", "5~100Zz-03953", 1},
+    {"2.37-6", "0.2.5-1", 1},
+    {"20220601+dfsg-1+b1", "1:15.0.6-4+b1", -1},
+    {"37~deb12u1", "1.52.0-1+deb12u2", 1},
+    {"3.8-5", "1:1.1.2-3", -1},
+    {"1:2.39.5-0+deb12u2", "2.39.5-0+deb12u2", 1},
+    {"1:1.1.2-0+deb12u1", "0.8.1-1", 1},
+    {"2.5.13+dfsg-5", "1.4.3-3", 1},
+    {"3.4-1", "11zY.000585+", -1},
+    {"2.10.1-1+b1", "1.2.1-1", 1},
+    {"1.0.8+1-1", "10:1.0.8+1-1", -1},
+    {"3.25.1-1", "1.8.0-1", 1},
+    {"4.3-4.1", "1.0.6-3", 1},
+    {"4.8.12-3.1", "0:4.8.12-3.1", 0},
+    {"1.31", "1.0.6-1+b1", 1},
+    {"2.10-0.1+deb12u2", "0.8.0-2+b1", 1},
+    {"1.3-1", "9.1-1", -1},
+    {"0.17-2", "1.74.0+ds1-21", -1},
+    {"1:3.6.0-7.1", "2.40-2", 1},
+    {"2023.3+deb12u2", "2.0.16-1", 1},
+    {"252.39-1~deb12u1", "252.39-1~deb112u1", -1},
+    {"9.1-1", "9.1-1~~", 1},
+    {"1:2.66-4+deb12u2", "2:1.8-1+b1", -1},
+    {"0.5.1-6", "0:0.5.1-6", 0},
+    {"1.34+dfsg-1.2+deb12u1", "0.21.2-1", 1},
+    {"2.10-0.1+deb12u2", "2.10-0.1+deb12u2a", -1},
+    {"1.15.1-1+deb12u1", "12.0-1", -1},
+    {"3.7.9-2+deb12u5", "0:3.7.9-2+deb12u5", 0},
+    {"2:1.3.4-1+b1", "1.3.4.20200120-3.1", 1},
+    {"1.4.3-1", "0381257236283602902547674991232771758199969344753997899692275783015046570-a", -1},
+    {"2.1-6.1", "2.10.1-1+b1", -1},
+    {"4.1.4-3+b1", "0:9000107:10-514970679901400825626423334339220191", -1},
+    {"1:3.8-4", "1:3.8-04", 0},
+    {"2.6.0-1", "2:2.6.1-4~deb12u2", -1},
+    {"1.15.1-1+deb12u1", "1.0.4-2", 1},
+    {"1.5.82", "10:1.5.82", -1},
+    {"1.21.22", "10:1.21.22", -1},
+    {"23.6-1", "23.6-1~", 1},
+    {"0.4.0-1+b1", "0.4.0-1+b1~", 1},
+    {"20220109.1", "20220109.1~rc1", 1},
+    {"2:1.8-1+b1", "12.9", 1},
+    {"38.0.4-3+deb12u1", "2.5.0-1+deb12u2", 1},
+    {"1.13.2+dfsg-1", "0.08-5", 1},
+    {"1.13.1-1", "3.5-2+b1", -1},
+    {"2.3.3-1+b1", "2.3.3-1+b1.", -1},
+    {"3.7.0-0.2+b1", "1.17.1-2+deb12u3", 1},
+    {"1.5.2-6+deb12u1", "0.20.4-3", 1},
+    {"1.3.2-4+b1", "2:1.3.2-4+b1", -1},
+    {"23.0.1+dfsg-1", "1.5-1", 1},
+    {"20.19.5-1nodesource1", "20.19.5-1NODESOURCE1", 1},
+    {"0.17-2", "0.17-2~rc1", 1},
+    {"1.5.1+ds-1+deb12u1", "1+5.1+ds-1+deb12u1", 1},
+    {"1.0.8+1-1", "10:11yzZz", -1},
+    {"1:1.10.0+ds-0.4", "0.18-1", 1},
+    {"0.8.1-1", "5.3.0-4", -1},
+    {"1.17.1-2+deb12u3", "6.1.0-3", -1},
+    {"1:1.2.3-1", "1:1.2.3-01", 0},
+    {"2:1.8-1+b1", "1.2.1-3", 1},
+    {"1.6.39-2", "1.6.39-2.", -1},
+    {"6.9.8-1", "3.2.2-1", 1},
+    {"1.8.1-1", "1.8.1-1a", -1},
+    {"3.8.1-2", "0.11.7-2", 1},
+    {"0.16-2", "1.4.3-1", -1},
+    {"12.0-1", "2.40-2", 1},
+    {"2:1.8.4-2+deb12u2", "10:1.8.4-2+deb12u2", -1},
+    {"2.3.1-3", "6.9.8-1", -1},
+    {"4.19.0-2+deb12u1", "66.1.1-1+deb12u2", -1},
+    {"2.6.0-1", "2.6.0-1~rc1", 1},
+    {"2:9.0.1378-2+deb12u2", "10:9.0.1378-2+deb12u2", -1},
+    {"1.15.1-1+deb12u1", "0.18-1", 1},
+    {"252.39-1~deb12u1", "0:252.39-1~deb12u1", 0},
+    {"1.0-2", "2:1.0-2", -1},
+    {"10.42-1", "3.11.2-1+b1", 1},
+    {"1.0.11-1+deb12u2", "10~0100-YA3yz+A", -1},
+    {"2.10.1-1+b1", "0.21.2-1", 1},
+    {"11+nmu1", "1:1.1.4-1+b2", -1},
+    {"2.6.0", "0:8013718545625835914672790014110297625104873251362306523014954327145-~.11", -1},
+    {"1.201-1", "1.0.201-1", 1},
+    {"12.0-1", "12.0-01", 0},
+    {"1.14", "10:1.14", -1},
+    {"1:0.9.10-1.1", "1BY256-YYb133811913237754177016493314722ya2y", 1},
+    {"1.52.0-1+deb12u2", "1.52.0-01+deb12u2", 0},
+    {"2.9.4-5", "10:2.9.4-5", -1},
+    {"3.6.2-1+deb12u3", "10:3.6.2-1+deb12u3", -1},
+    {"1.201-1", "1~201-1", 1},
+    {"2:1.2.3-1", "2:1.2.3-01", 0},
+    {"1:1.1.2-3", "1:1.1.2-03", 0},
+    {"4.5.0-6+deb12u2", "1.2.1-1", 1},
+    {"1.6.39-2", "1.6.39-2a", -1},
+    {"11+nmu1", "2:11+nmu1", -1},
+    {"2.5.0-1+deb12u2", "7.88.1-10+deb12u14", -1},
+    {"1:9.2p1-2+deb12u7", "1:2.66-4+deb12u2", 1},
+    {"2025b-0+deb12u2", "1.0.8-5+b1", 1},
+    {"12.0-1", "1.3.3+ds-1", 1},
+    {"8.6.13+dfsg-2", "8.96.13+dfsg-2", -1},
+    {"1.2.1-3", "1.2.1-13", -1},
+    {"1.7.1-1", "1.4.19-3", 1},
+    {"3.4.4-1", "3.4.4-1~", 1},
+    {"20220601+dfsg-1+b1", "20220601+dfsg-01+b1", 0},
+    {"1.6.2-3", "2:1.6.2-3", -1},
+    {"3.11.2-6+deb12u6", "4:12.2.0-3", -1},
+    {"1.8.1-1", "1.22.0-2+deb12u1", -1},
+    {"3.4.0-4", "3.4.0-4~a", 1},
+    {"1:15.0.6-4+b1", "1:15.0.6-4+B1", 1},
+    {"3.8.1-2", "2.2.2-2", 1},
+    {"0.5.12-2", "1:0.5.12-2", -1},
+    {"3.6.1", "7+200027~256", -1},
+    {"0.4.0-1+b1", "0:0.4.0-1+b1", 0},
+    {"1.0.8+1-1", "4.13.0-1", -1},
+    {"2.5.13+dfsg-5", "2:1.8-1+b1", -1},
+    {"1.0.9-2+b6", "1.0.9-02+b6", 0},
+    {"2.4.114-1", "2.4.114-1-1", -1},
+    {"0.16-2", "252.39-1~deb12u1", -1},
+    {"1.0.8-5", "1.15.1-5+b1", -1},
+    {"2.1-6.1", "2:2.1-6.1", -1},
+    {"0.4.0-2", "10:0.4.0-2", -1},
+    {"1.9.5-4", "3.6.2-1+deb12u3", -1},
+    {"1.0.18-1", "1.0.18-1~~", 1},
+    {"0.4.0-2", "2:0.4.0-2", -1},
+    {"1.17.0-3", "2.28.3-1", -1},
+    {"1.3.4.20200120-3.1", "0:1.3.4.20200120-3.1", 0},
+    {"0.21.2-1", "0.8.0-2+b1", 1},
+    {"1.4.3-3", "3.4.4-1", -1},
+    {"1:1.2.1-1.1", "1.46-1", 1},
+    {"1.3-1", "1a3-1", 1},
+    {"2.9.4-5", "2~9.4-5", 1},
+    {"44.0-2", "2:211zyy-Bz0006441", -1},
+    {"4.2.0-1", "10:4.2.0-1", -1},
+    {"0.18-1", "0.18-1~~", 1},
+    {"1.5.82", "1.74.0-3", -1},
+    {"0.18-1", "0.18-11", -1},
+    {"0.66.0+ds1-1", "0:0.66.0+ds1-1", 0},
+    {"1.14", "1~14", 1},
+    {"0.4-1", "1.14.10-1~deb12u1", -1},
+    {"0.20.4-3", "0.20.4-3~~", 1},
+    {"2:1.2.3-1", "1.3.6-4", 1},
+    {"1.0.6-1+b1", "11+nmu1", -1},
+    {"1.10.1-3", "0.10.2-1", 1},
+    {"1.2.37-2", "1.0.2.37-2", 1},
+    {"3.3+20.604758e7-6.2", "0:3.3+20.604758e7-6.2", 0},
+    {"0.17-2", "4.2.0-1", -1},
+    {"122-3", "1:3.5.12-1.1+deb12u1", -1},
+    {"1.0.4-2", "9+~", -1},
+    {"0.17-2", "10:0.17-2", -1},
+    {"1.10.1-3", "2:9.0.1378-2+deb12u2", -1},
+    {"0.18+nmu1", "1:0.18+nmu1", -1},
+    {"1:6.0.0-2", "0.04-8+b1", 1},
+    {"4.9-1", "0.99.30-4.1~deb12u1", 1},
+    {"0.4-1", "2:0.4-1", -1},
+    {"2.2.2-2", "2.2.2-2A", -1},
+    {"0.5.12-2", "6.9.8-1", -1},
+    {"12.9", "8.6.13-2", 1},
+    {"3.4.0-4", "2:2.6.1-4~deb12u2", -1},
+    {"3.2.2-1", "03.2.2-1", 0},
+    {"3.2.2-1", "0.13.0-1", 1},
+    {"4.9-1", "3.8-5", 1},
+    {"1.21.3-1+deb12u1", "1.13.1-1", 1},
+    {"3.8-5", "2023.3+deb12u2", -1},
+    {"2.0.0-1", "2.0.0-1+", -1},
+    {"1.2.1-1", "1.2.1-1~a", 1},
+    {"1.14", "1.194", -1},
+    {"11.2.185-2", "400794-0605.", -1},
+    {"2:6.2.1+dfsg1-1.1", "10:6.2.1+dfsg1-1.1", -1},
+    {"0.5.12-2", "2.2.0-2", -1},
+    {"1:9.2p1-2+deb12u7", "0.38.4-2", 1},
+    {"2.5.0-1+deb12u2", "1.0.6-3", 1},
+    {"2.14-2", "6.0-3+b2", -1},
+    {"2.35.1-1", "0:2.35.1-1", 0},
+    {"2.28.3-1", "2.28.3-1~1", 1},
+    {"1.0.6-3", "1~0.6-3", 1},
+    {"0.16-2", "0:0.16-2", 0},
+    {"3.11.0-2", "11zaY-998142226531927855740063az2", -1},
+    {"1.0.4-3", "1+0.4-3", 1},
+    {"1.13.1-1", "1.13.1-01", 0},
+    {"3.6.0-1+deb12u2", "3.6.0-1+deb12u2~a", 1},
+    {"2.14.0+dfsg-1", "2.14.0+dfsg-1-1", -1},
+    {"2.36-9+deb12u13", "2.36-9+deb102u13", -1},
+    {"2.0.16-1", "3B-~bY-bY..+11", -1},
+    {"10.42-1", "3.5-2+b1", 1},
+    {"23.0.1+dfsg-1", "1.4.3-3", 1},
+    {"525.85.05-3~deb12u1", "3.8.1-2", 1},
+    {"9.0.2-1.1", "5.3.28+dfsg2-1", 1},
+    {"1.12.1-0.2", "2:1.2.3-1", -1},
+    {"1.4.3-3", "1:5.44-3", -1},
+    {"3.4-2.1", "3.6.2-1+deb12u3", -1},
+    {"1:1.2.3-1", "700991-.-yzb~", 1},
+    {"2.10-0.1+deb12u2", "2.10-0.1+deb12u002", 0},
+    {"1.6.0-1", "2:1.2.3-1", -1},
+    {"3.4.0-1", "510+30000841-~9A", -1},
+    {"6.1.153-1", "2.5.0-1+deb12u2", 1},
+    {"12.4+deb12u12", "9.1-1", 1},
+    {"1.18.1-3", "1.18.1-3~~", 1},
+    {"1.14.10-1~deb12u1", "1.0.14.10-1~deb12u1", 1},
+    {"0.5.15-2", "23.0.0-1", -1},
+    {"2.5.0-1+deb12u2", "3.6.2-1+deb12u3", -1},
+    {"1.6.39-2", "2:1.6.39-2", -1},
+    {"38.0.4-3+deb12u1", "38.0.4-03+deb12u1", 0},
+    {"0.4-1", "0~4-1", 1},
+    {"1.74.0+ds1-21", "18287802787370867744268943975814882551aBB.-zaByb000794", -1},
+    {"1.4.19-3", "0:1.4.19-3", 0},
+    {"1.3.1-1", "99755843006186635103390791811802455yyb-AYA00138+", -1},
+    {"1:0.9.10-1.1", "3.6.1", 1},
+    {"1:5.44-3", "1:5.44-3~1", 1},
+    {"2.5.5-5", "2+5.5-5", 1},
+    {"2:1.2.3-1", "2b000514-000695", 1},
+    {"5.2.15-2+b9", "5.2.15-2+b9~~", 1},
+    {"3.25.1-1", "2:3.25.1-1", -1},
+    {"2.10.1-1+b1", "1.65.2+deb12u1", 1},
+    {"0.11.7-2", "20220601+dfsg-1+b1", -1},
+    {"1.7.1-1", "1.7.1-01", 0},
+    {"2.4+20151223.gitfa8646d.1-2+b2", "0.18-1", 1},
+    {"1.0.18-1", "1.0.18-1~a", 1},
+    {"2.2.2-2", "2.2.2-2~1", 1},
+    {"3.4.4-1", "00:4bAb", -1},
+    {"0~20171227-0.3+deb12u1", "0~20171227-0.3+deb12u1~a", 1},
+    {"1:7.7+23", "7.7+23", 1},
+    {"1:2.38.1-5+deb12u3", "10:2.38.1-5+deb12u3", -1},
+    {"0.04-8+b1", "300056-00681", -1},
+    {"1.63.0+dfsg1-2", "6.", -1},
+    {"1:2.38.1-5+deb12u3", "525.85.05-3~deb12u1", 1},
+    {"1:1.2.1-1.1", "2:9.0.1378-2+deb12u2", -1},
+    {"122-3", "2:122-3", -1},
+    {"0.08-5", "0:0.08-5", 0},
+    {"2.9.0-1", "92.9.0-1", -1},
+    {"2.1-6.1", "2+1-6.1", 1},
+    {"0.3.10-2", "10:0.3.10-2", -1},
+    {"1.8.0-1", "3.11.2-1+b1", -1},
+    {"3.0.8-3", "1.21.22", 1},
+    {"3.0.8-3", "0.5.12-2", 1},
+    {"2023.3+deb12u2", "2023.3+deb12u2-1-1", -1},
+    {"3.134", "3.134+b1", -1},
+    {"1:4.4.33-2", "1:4.4.33-2~", 1},
+    {"3.4.0-4", "3.4.0-4-1", -1},
+    {"1.6.39-2", "0.18.0-1+b1", 1},
+    {"2.35.1-1", "8255-.BYa", -1},
+    {"0.24.1-2", "1:10bByy-Ba.A..", -1},
+    {"1.5.1+ds-1+deb12u1", "1.5.1+ds-1+deb12u1.", -1},
+    {"0.99.30-4.1~deb12u1", "0.99.30-04.1~deb12u1", 0},
+    {"2.28.3-1", "10:03Zyy", -1},
+    {"3.134", "3.11.2-6+deb12u6", 1},
+    {"0.4.0-2", "10.4.0-2", -1},
+    {"0.3.10-2", "0.3.10-2+b1", -1},
+    {"2.4.7-7~deb12u1", "2.4.7-7~deb12u1~~", 1},
+    {"66.1.1-1+deb12u2", "66.1.1-1+DEB12U2", 1},
+    {"72.1-3+deb12u1", "1.15-1", 1},
+    {"8.6.13-2", "8.6.13-2~1", 1},
+    {"0.24.1-2", "1.0-2", -1},
+    {"1.8.1-1", "7AyZZ11757333435831904751806233818423137~~", -1},
+    {"1.20.7-10+b1", "2.10-0.1+deb12u2", -1},
+    {"4.1.4-3", "2.14-2", 1},
+    {"1:1.16.5-1.3", "1.16.5-1.3", 1},
+    {"1.5.0-1", "1.5.0-1+b1", -1},
+    {"1.6.2-3", "52-.", -1},
+    {"0.8.3-1+b3", "0.8.0-2+b1", 1},
+    {"8.6.13-2", "2.2.40-1.1+deb12u1", 1},
+    {"1.21.3-1+deb12u1", "1.22.0-2+deb12u1", -1},
+    {"3.11.0-2", "3.11.0-2~rc1", 1},
+    {"20220623.1-1+deb12u2", "0.8.3-1+b3", 1},
+    {"0.10.2-1", "10.10.2-1", -1},
+    {"6.4-4", "2:6.4-4", -1},
+    {"1:1.0.9-1", "1:1.0.9-1~", 1},
+    {"1.3.1-1", "0.17029-2", 1},
+    {"2.4.7-7~deb12u1", "2.4.7-7~deb12u1~", 1},
+    {"0.5.1-6", "2:3.8.2+dfsg-1+b1", -1},
+    {"4.2.2-1+deb12u1", "4a2.2-1+deb12u1", 1},
+    {"3.23+nmu1", "1.07-5", 1},
+    {"3.42.2-3+b1", "4.0.0+ds-2", -1},
+    {"3.6.1+dfsg+~3.5.14-1", "3.6.1+dfsg+~3.5.14-1~rc1", 1},
+    {"2:1.8.4-2+deb12u2", "12.4+deb12u12", 1},
+    {"0.04-8+b1", "1.0.0-2+deb12u1", -1},
+    {"30+20221128-1", "10:30+20221128-1", -1},
+    {"1.5.0-1", "1.5.0-1.0", -1},
+    {"2.10.1-1+b1", "1.12.1-0.2", 1},
+    {"6.0-3+b2", "6.1.0-3", -1},
+    {"1:0.9.10-1.1", "10~0", 1},
+    {"5.3.28+dfsg2-1", "2.37-6", 1},
+    {"1.2.4-0.2+deb12u1", "224543460100267056230402ZAb", -1},
+    {"3.6.0-1+deb12u2", "0-0-~", 1},
+    {"6.0-3+b2", "006.0-3+b2", 0},
+    {"0.22-4+b1", "0:0.22-4+b1", 0},
+    {"1.17.1-2+deb12u3", "0:1.17.1-2+deb12u3", 0},
+    {"0.99.30-4.1~deb12u1", "6.1.153-1", -1},
+    {"1.47.0-2+b2", "9.1-1", -1},
+    {"1.3.2-4+b1", "11yb~a", -1},
+    {"3.4.4-1", "3.4.4-01", 0},
+    {"23.0.0-1", "0.21.2-1", 1},
+    {"1:2.39.5-0+deb12u2", "11+nmu1", 1},
+    {"1.31-1.2", "3.7.0-0.2+b1", -1},
+    {"2.38.1-5+deb12u3", "4.0.0+ds-2", -1},
+    {"2:4.0.2-3", "11~.-.159496219910286174436612261898590b256", 1},
+    {"1.10.0-3+b1", "1~10.0-3+b1", 1},
+    {"1:1.11-1.1", "1:1.0011-1.1", 0},
+    {"3.11.2-6+deb12u6", "0:3.11.2-6+deb12u6", 0},
+    {"1.3.1-1", "1.0.3.1-1", 1},
+    {"5.3.28+dfsg2-1", "5.3.28+dfsg2-01", 0},
+    {"3.42.2-3+b1", "3.42.2-3+B1", 1},
+    {"1.6.0-1", "1:2.1.5-2", -1},
+    {"525.85.05-3~deb12u1", "2:525.85.05-3~deb12u1", -1},
+    {"2.6.0", "2.0.16-1", 1},
+    {"0.188-2.1", "2.10.1-1+b1", -1},
+    {"3.8.1-2", "3Zy7714394097422888330604307378000169579775309585940192541748412071511.", 1},
+    {"1:1.2.1-1.1", "1:1.2.1-1.1+b1", -1},
+    {"1:2.1.5-2", "1.5.0-1", 1},
+    {"2.3.6-1", "2.1.12-stable-8", 1},
+    {"8.2-1.3", "2:8.2-1.3", -1},
+    {"1.52.0-1+deb12u2", "1.52.0-1+deb912u2", -1},
+    {"3.2.2-1", "711", -1},
+    {"1.31", "1.31+b1", -1},
+    {"1:0.9.10-1.1", "1:0a9.10-1.1", 1},
+    {"0.8.0-2+b1", "10:0.8.0-2+b1", -1},
+    {"3.4-1+b6", "1.46-1", 1},
+    {"2.2.0-2", "2.02.0-2", 0},
+    {"1.15.1-1+deb12u1", "10:1.15.1-1+deb12u1", -1},
+    {"2.14-2", "1:14.0-55.7~deb12u1", -1},
+    {"1:14.0-55.7~deb12u1", "1:14.0-055.7~deb12u1", 0},
+    {"0.4-1", "0.4-1~1", 1},
+    {"1:3.6.0-7.1", "2.4.114-1+b1", 1},
+    {"2.5.5-5", "0.+-92Zz255.", 1},
+    {"0.4-1", "4.8.12-3.1", -1},
+    {"1:3.5.12-1.1+deb12u1", "1:3.5.12-1.1+DEB12U1", 1},
+    {"3.11.2-3", "122-3", -1},
+    {"1.10.0-3+b1", "2:4+.", -1},
+    {"7.88.1-10+deb12u14", "7.88.1-10+deb12u14~1", 1},
+    {"44.0-2", "44.0-2~rc1", 1},
+    {"2022.1-1", "2.3.1-1", 1},
+    {"0.8.3-1+b3", "0.8.3-1+b3~~", 1},
+    {"1.3.6-4", "9-.000175b-yA~", -1},
+    {"1:1.2.3-1", "1:1.2.3-11", -1},
+    {"1.3-1", "1:1.3-1", -1},
+    {"1.14.10-1~deb12u1", "1.14.10-01~deb12u1", 0},
+    {"0.38.4-2", "0.18+nmu1", 1},
+    {"1.13.2+dfsg-1", "1:1.13.2+dfsg-1", -1},
+    {"0.5.1-6", "1.10.1-3", -1},
+    {"0.3.9-1+b1", "4:12.2.0-3", -1},
+    {"0.16-2", "1196135397216659542481293940156942807.-~~B", -1},
+    {"0.13.0-1", "3.23+nmu1", -1},
+    {"590-2.1~deb12u2", "590-2~1~deb12u2", 1},
+    {"2.6.0", "72.1-3+deb12u1", -1},
+    {"0.14.5-1", "2:13236915162543555721074639490558087168100+.000901-70449408190655517952761318", -1},
+    {"2.12.1+dfsg-5+deb12u4", "2.12.1+dfsg-5+deb12u4.", -1},
+    {"1.22.0-2+deb12u1", "0:1.22.0-2+deb12u1", 0},
+    {"8.6.13-2", "8.6.193-2", -1},
+    {"2.9.4-5", "2.0.9.4-5", 1},
+    {"1.0-2", "1.0-02", 0},
+    {"1:3.0.9-1", "1:3.0.0.9-1", 1},
+    {"3.5-2+b1", "3.005-2+b1", 0},
+    {"1.2.37-2", "1:1.2.37-2", -1},
+    {"1.4.1+dfsg-1", "10:1.4.1+dfsg-1", -1},
+    {"1.9.5-4", "1.9.5-04", 0},
+    {"6.03-2", "6~03-2", 1},
+    {"1.14.10-1~deb12u1", "0:1.14.10-1~deb12u1", 0},
+    {"0.3.21+ds-4", "1.46-1", -1},
+    {"7.88.1-10+deb12u14", "2.5.0-1+deb12u2", 1},
+    {"20220601+dfsg-1+b1", "20220601+dfsg-1+b1~rc1", 1},
+    {"0.38.4-2", "0.38.4-2-0", -1},
+    {"1.21.22", "6.1.153-1", -1},
+    {"2:6.2.1+dfsg1-1.1", "2:6.2.1+dfsg1-1.1~rc1", 1},
+    {"6.1.0-3", "1:6.1.0-3", -1},
+    {"5.7-0.5~deb12u1", "66.1.1-1+deb12u2", -1},
+    {"1.17.1-2+deb12u3", "1.0.17.1-2+deb12u3", 1},
+    {"1.15.1-1+deb12u1", "10:1111000865YA", -1},
+    {"0.21.2-1", "2:0.21.2-1", -1},
+    {"1:1.1.4-1+b2", "5.36.0-7+deb12u3", 1},
+    {"1.18.1-3", "3.4.0-1", -1},
+    {"3.0.8-3", "3.0.8-3.0", -1},
+    {"3.21.12-3", "1:3.6.0-7.1", -1},
+    {"1.21.3-1+deb12u1", "1.21.3-1+deb12u11", -1},
+    {"6.9.8-1", "3.0-13", 1},
+    {"2023.3+deb12u2", "10:2023.3+deb12u2", -1},
+    {"1:1.0.9-1", "1.31", 1},
+    {"1.10.0-3+b1", "3.4.0-4", -1},
+    {"0.8.3-1+b3", "3.06-4", -1},
+    {"12.9", "1.3.1-1", 1},
+    {"1.17.0-3", "0:1199-00198z", -1},
+    {"1.74.0-3", "1.0.4-2", 1},
+    {"2.37-6", "2:1.3.4-1+b1", -1},
+    {"3.11.2-6+deb12u6", "2.4+20151223.gitfa8646d.1-2+b2", 1},
+    {"1.74.0-3", "10.0.0", -1},
+    {"1:1.1.2-1", "10.42-1", 1},
+    {"37~deb12u1", "3.4-2.1", 1},
+    {"6.4-4", "3.11.2-1+b1", 1},
+    {"0.18.0-1+b1", "7++-100256221791421527130452999~000231", -1},
+    {"4.3-4.1", "0:4.3-4.1", 0},
+    {"1.51.1-3+b1", "2.6.0-1", -1},
+    {"0.14.5-1", "7.88.1-10+deb12u14", -1},
+    {"1.12.0-2+b1", "0:1111", -1},
+    {"1.0.9-2+b6", "6AzY.3255", -1},
+    {"1.21.22", "3.0.8-3", -1},
+    {"3.11.2-6+deb12u6", "2.4.114-1+b1", 1},
+    {"0.58+deb12u5", "11.2.185-2", -1},
+    {"4.1.4-3+b1", "9.1.0+ds1-2", -1},
+    {"2.2.0-2", "0:2.2.0-2", 0},
+    {"6.9.8-1", "2:6.9.8-1", -1},
+    {"1.6.3-2", "1.96.3-2", -1},
+    {"3.0.9-1", "3a0.9-1", 1},
+    {"0.04-8+b1", "1:1.2.3-1", -1},
+    {"3.25.1-1", "7AzB.~-104063886918097415060871098078849137040694+.000309", -1},
+    {"2.5.13+dfsg-5", "10YAb99AyB-25600627", -1},
+    {"2.14.1-4", "1.0.8-5+b1", 1},
+    {"3.8-5", "3+8-5", 1},
+    {"1.6-2.1+deb12u1", "8.6.13", -1},
+    {"2.28.3-1", "3.7.9-2+deb12u5", -1},
+    {"0.270", "0:0.270", 0},
+    {"0.17-2", "0.17-02", 0},
+    {"2.4.7-7~deb12u1", "8.0379z-~AY100", -1},
+    {"8.2-1.3", "525.85.05-3~deb12u1", -1},
+    {"3.134", "3~134", 1},
+    {"2:6.2.1+dfsg1-1.1", "2:6.2.1+dfsg1-01.1", 0},
+    {"2022.1-1", "2022.1-1~~", 1},
+    {"1:1.0.9-1", "3.42.2-3+b1", 1},
+    {"4.2.0-1", "4.2.0-1~a", 1},
+    {"1.10.8+repack1-1", "2.4.114-1+b1", -1},
+    {"3.23+nmu1", "3.23+nmu1~", 1},
+    {"2.5.13+dfsg-5", "2.5.13+dfsg-05", 0},
+    {"2.2.0-2", "0.21.2-1", 1},
+    {"1.13.2+dfsg-1", "0:1.13.2+dfsg-1", 0},
+    {"0.22-4+b1", "0.04-8+b1", 1},
+    {"1:2.39.5-0+deb12u2", "12.2550~-yBZ2A", 1},
+    {"1.5.7-1", "2.3.1-1", -1},
+    {"4.9.0-4", "1:5.44-3", -1},
+    {"0.0~git20230123.b2528b0-1", "0.0~git20230123.b2528b0-1~1", 1},
+    {"1:2.66-4+deb12u2", "2.66-4+deb12u2", 1},
+    {"2.4.114-1+b1", "1:15.0.6-4+b1", -1},
+    {"7.88.1-10+deb12u14", "2:7.88.1-10+deb12u14", -1},
+    {"3.1.0-3", "3.4.0-1", -1},
+    {"3.11.2-3", "0:3.11.2-3", 0},
+    {"3.8-5", "0.16-2", 1},
+    {"1:1.11-1.1", "6.4-4", 1},
+    {"2.3.1-1", "3.4-1+b6", -1},
+    {"1.0.8-5+b1", "1.0.8-5+b1~~", 1},
+    {"0.25-1.1", "0.25-1.1~", 1},
+    {"5.7-0.5~deb12u1", "6~+256~-BBa", -1},
+    {"2.6.1", "2.6.1-1-1", -1},
+    {"2.4.114-1", "1.2.6-5", 1},
+    {"1.1.35-1+deb12u3", "0:1.1.35-1+deb12u3", 0},
+    {"0.10.2-1", "0.10.2-1~a", 1},
+    {"11.2.185-2", "2.9.14+dfsg-1.3~deb12u4", 1},
+    {"1:1.2.3-1", "1.4.19-3", 1},
+    {"1.12-1", "1a12-1", 1},
+    {"1.10.0-3+b1", "2:1.10.0-3+b1", -1},
+    {"1.6.39-2", "1.1.35-1+deb12u3", 1},
+    {"4:12.2.0-3", "1.20.7-10+b1", 1},
+    {"1.17.1-2+deb12u3", "1:1.1.4-1+b2", -1},
+    {"1:15.0.6-4+b1", "1:15.0.6-04+b1", 0},
+    {"5.3.28+dfsg2-1", "0:5.3.28+dfsg2-1", 0},
+    {"1.0.0-2+deb12u1", "1+0.0-2+deb12u1", 1},
+    {"1.20.1-2+deb12u4", "3+zZ-000846", -1},
+    {"1.17.0-3", "91.17.0-3", -1},
+    {"1.31", "1.5.0-1", 1},
+    {"1.5.7-1", "1.5.7-1~rc1", 1},
+    {"1.3.1-1", "1.3.1-1~~", 1},
+    {"3.3a-3", "3.7.0-0.2+b1", -1},
+    {"0.5.15-2", "8.6.13-2", -1},
+    {"0.08-5", "1.6.0-1", -1},
+    {"0.04-8+b1", "5.2.15-2+b9", -1},
+    {"1.46-1", "8.6.13+dfsg-2", -1},
+    {"2.3.3-1+b1", "002.3.3-1+b1", 0},
+    {"1.9.4-1", "0:1.9.4-1", 0},
+    {"3.8-5", "1:3.8-5", -1},
+    {"8.2-1.3", "1.46-1", 1},
+    {"2:1.1.3-3", "2.1.12-stable-8", 1},
+    {"3.1.0-3", "10.42-1", -1},
+    {"2.0.16-1", "0:2.0.16-1", 0},
+    {"20.19.5-1nodesource1", "1:20.19.5-1nodesource1", -1},
+    {"1.5.7-1", "5.2.15-2+b9", -1},
+    {"1:6.0.0-2", "601-11b00847~", 1},
+    {"15.14-0+deb12u1", "1:15.14-0+deb12u1", -1},
+    {"1.201-1", "1.201-1-0", -1},
+    {"3.4-1+b6", "0.8.3-1+b3", 1},
+    {"20.19.5-1nodesource1", "20.19.05-1nodesource1", 0},
+    {"0.38.4-2", "11a", -1},
+    {"0.188-2.1", "0.188-2.1~~", 1},
+    {"2:1.02.185-2", "2:1.02.185-02", 0},
+    {"1:6.0.0-2", "1:06.0.0-2", 0},
+    {"1.3.4.20200120-3.1", "1.3.4.20200120-3.001", 0},
+    {"0.7.0+dfsg-8+b1", "10:8ZZz8138405031798375808437049+b-1", -1},
+    {"1:1.11-1.1", "1:1.11-1.1~1", 1},
+    {"1.0-2", "01:10Zz:-110", -1},
+    {"2:2.6.1-4~deb12u2", "2.14-2", 1},
+    {"0.24.1-2", "0.24.1-02", 0},
+    {"5.2.15-2+b9", "0.11.7-2", 1},
+    {"10.0.0", "10:10.0.0", -1},
+    {"3.11.0-2", "1.14", 1},
+    {"2.4.114-1+b1", "2a4.114-1+b1", 1},
+    {"5.3.0-4", "5.3.28+dfsg2-1", -1},
+    {"2:9.0.1378-2+deb12u2", "2:1.1.3-3", 1},
+    {"1.21.22", "2307552448468027454809626931837787792853911-~0967480763324919988063987914~10", -1},
+    {"23.6-1", "23.6-01", 0},
+    {"20220109.1", "2.35.1-1", 1},
+    {"2.6.0", "2.6.0~1", 1},
+    {"0.17-2", "4.5.0-6+deb12u2", -1},
+    {"0.4.0-1+b1", "0.4.0-1+b1~rc1", 1},
+    {"0.11.7-2", "0.11.7-2~", 1},
+    {"2.4.7-7~deb12u1", "10:2.4.7-7~deb12u1", -1},
+    {"3.4.0-4", "5.36.0-7+deb12u3", -1},
+    {"1:1.1.2-0+deb12u1", "2:0.", -1},
+    {"2.9.0-1", "2.9.0-1~rc1", 1},
+    {"1:2.5.1-4", "3.11.2-6+deb12u6", 1},
+    {"1:2.5.1-4+b2", "1:12.5.1-4+b2", -1},
+    {"6.0-28", "6.0-0028", 0},
+    {"2.37-6", "1:2.5.1-4+b2", -1},
+    {"3.4-1+b6", "3.4-1+b6~1", 1},
+    {"0.8.0-2+b1", "0.16.1-2", -1},
+    {"3.1-20221030-2", "2.38.1-5+deb12u3", 1},
+    {"20220623.1-1+deb12u2", "1:3.8-4", -1},
+    {"9.1-1", "2:2zYY-+", -1},
+    {"3.25.1-1", "10:120582", -1},
+    {"3.0.9-1", "3.0.9-1~a", 1},
+    {"1:2.38.1-5+deb12u3", "1:2+38.1-5+deb12u3", 1},
+    {"1.3-1", "1.3-1~rc1", 1},
+    {"1.46-1", "2.6.0-1", -1},
+    {"2.3.6-1", "0.4.0-1+b1", 1},
+    {"1.10.0-3+b1", "1.10.0-3+b1~1", 1},
+    {"0.8.0-2+b1", "0.58+deb12u5", -1},
+    {"1:2.1.5-2", "1.47.0-2+b2", 1},
+    {"2:1.1.3-3", "1:14.0-55.7~deb12u1", 1},
+    {"5.2.15-2+b9", "1.14.10-1~deb12u1", 1},
+    {"4.5.0-6+deb12u2", "1:1.10.0+ds-0.4", -1},
+    {"1:2.1.5-2", "113706050183315005177321160921019000954~bz", 1},
+    {"1.6.3-2", "1.6.3-2-1", -1},
+    {"4:12.2.0-3", "0390763963443361806410009776481908274205455324760197383478-3-bYZY.", 1},
+    {"4.2.0-1", "4.2.0-1.0", -1},
+    {"1.5.7-1", "1a5.7-1", 1},
+    {"3.3+20.604758e7-6.2", "8.6.13+dfsg-2", -1},
+    {"1.5.4+dfsg2-5", "1.0.8-5+b1", 1},
+    {"2.28.3-1", "1:2.28.3-1", -1},
+    {"20230311+deb12u1", "1.0.8-5+b1", 1},
+    {"1.8.9-2", "1.4.3-3", 1},
+    {"3.8.1-2", "0:3.8.1-2", 0},
+    {"3.06-4", "3.006-4", 0},
+    {"1.5.0-1", "0.4.0-2", 1},
+    {"3.2.2-1", "0.5.15-2", 1},
+    {"2.74.6-2+deb12u7", "2~74.6-2+deb12u7", 1},
+    {"1.14", "1:1.14", -1},
+    {"3.6.1", "2.14-2", 1},
+    {"1.17.1-2+deb12u3", "1.17.1-2+DEB12U3", 1},
+    {"1.1.35-1+deb12u3", "1.1.35-1+deb12u3.", -1},
+    {"3.40.1-2+deb12u2", "3.40.1-2+deb12u2~rc1", 1},
+    {"0.5.12-2", "10ABzYayaa256-11~b2", -1},
+    {"1.3.4.20200120-3.1", "2:4.35-1", -1},
+    {"20220109.1", "3.6.0-1+deb12u2", 1},
+    {"2:1.3.4-1+b1", "2:1.1.3-3", 1},
+    {"1.6.0-1", "1:2.5.1-4+b2", -1},
+    {"9.1-1", "9.1-1~", 1},
+    {"1.6.39-2", "1.6.39-2~a", 1},
+    {"1.51.1-3+b1", "1.51.1-3+B1", 1},
+    {"1.5-1", "4.1", -1},
+    {"2:1.02.185-2", "3.4-1+b5", 1},
+    {"1.5-1", "2.2.2-2", -1},
+    {"2.4.114-1", "4+-bzZ", -1},
+    {"2.6.0-1", "1.0.18-1", 1},
+    {"1.6.3-2", "2.5.4-1+deb12u1", -1},
+    {"3.21.12-3", "3.11.2-3", 1},
+    {"5.36.0-7+deb12u3", "5.396.0-7+deb12u3", -1},
+    {"1:2.38.1-5+deb12u3", "1.14.10-1~deb12u1", 1},
+    {"1.65.2+deb12u1", "1.4.0-1", 1},
+    {"0.17-2", "0.17-2+b1", -1},
+    {"4.9-1", "4.9-01", 0},
+    {"1.201-1", "1.201-1~a", 1},
+    {"6.1.0-3", "3.6.0-1+deb12u2", 1},
+    {"2021.8.0-2", "1:2.39.5-0+deb12u2", -1},
+    {"1.6.0-1", "1.6.0-1~1", 1},
+    {"4.1.4-3", "4+1.4-3", 1},
+    {"1.5.4+dfsg2-5", "9zzz", -1},
+    {"4.5.0-6+deb12u2", "0:4.5.0-6+deb12u2", 0},
+    {"2.36-9+deb12u13", "2:4.0.2-3", -1},
+    {"1.0.4-2", "1.0.4-2.0", -1},
+    {"0.5.1-6", "0.5.1-6a", -1},
+    {"4.5.0-6+deb12u2", "4a5.0-6+deb12u2", 1},
+    {"6.1.153-1", "1:6.1.153-1", -1},
+    {"0.3.21+ds-4", "2.13.10-1", -1},
+    {"1.63.0+dfsg1-2", "1.0.63.0+dfsg1-2", 1},
+    {"5.4.1-1", "4.5.0-6+deb12u2", 1},
+    {"6.4-4", "1.74.0+ds1-21", 1},
+    {"1:1.1.2-0+deb12u1", "1:1.1.2-0+deb12u1~rc1", 1},
+    {"1.17.0-3", "1.65.2+deb12u1", -1},
+    {"4.0.0+ds-2", "4.0.0+ds-2-1", -1},
+    {"15.14-0+deb12u1", "1.07-5", 1},
+    {"1.12.1-0.2", "10:9-ba:YAA-3yy~", -1},
+    {"0.11.7-2", "1.6.3-2", -1},
+    {"2.5.5-5", "2:2.5.5-5", -1},
+    {"2025b-0+deb12u2", "2025b-00+deb12u2", 0},
+    {"22.3.6-1+deb12u1", "22.3.6-01+deb12u1", 0},
+    {"2.3.3-1+b1", "2.3.3-1+b1~", 1},
+    {"1.17.1-2+deb12u3", "1.17.1-2+deb112u3", -1},
+    {"22.3.6-1+deb12u1", "6.1.153-1", 1},
+    {"0.04-8+b1", "0.04-8+b1+", -1},
+    {"1:0.4.5-1", "1:0.4.5-1-1", -1},
+    {"0.2.5-1", "2.37-6", -1},
+    {"2.4.114-1", "2a4.114-1", 1},
+    {"0.4.0-1+b1", "0.4.0-1+b1-1", -1},
+    {"3.3a-3", "03.3a-3", 0},
+    {"2023.3+deb12u2", "2.9.0-1", 1},
+    {"0.11.7-2", "1.4.19-3", -1},
+    {"590-2.1~deb12u2", "9az-+970652619164914432844175276133307", 1},
+    {"12.2.0-14+deb12u1", "1:12.2.0-14+deb12u1", -1},
+    {"1.3.1-1", "0:1.3.1-1", 0},
+    {"2.3.6-1", "2.3.6-1~1", 1},
+    {"1.3.6-4", "1.3.6-4+", -1},
+    {"1:1.11-1.1", "1.11-1.1", 1},
+    {"1.63.0+dfsg1-2", "1.16.0-4", 1},
+    {"1:1.2.13.dfsg-1", "1:8018700705", -1},
+    {"11+nmu1", "1:11+nmu1", -1},
+    {"1:1.2.1-1.1", "1.2.1-1.1", 1},
+    {"8.6.13", "98.6.13", -1},
+    {"10.0.0", "10.00.0", 0},
+    {"3.6.0-1+deb12u2", "3.6.0-01+deb12u2", 0},
+    {"2:9.0.1378-2+deb12u2", "1.3.2-4+b1", 1},
+    {"590-2.1~deb12u2", "0~20171227-0.3+deb12u1", 1},
+    {"1.1.35-1+deb12u3", "3.06-4", -1},
+    {"2.2-1", "1.5.0-1", 1},
+    {"2.5.13+dfsg-5", "2:2.5.13+dfsg-5", -1},
+    {"2.0.0-1", "2025b-0+deb12u2", -1},
+    {"8.6.13-2", "8.6.13-2+b1", -1},
+    {"2.4.7-7~deb12u1", "2.4.7-7~deb12u1.", -1},
+    {"0.38.4-2", "00.38.4-2", 0},
+    {"8.6.13+dfsg-2", "8.6.13+dfsg-2~", 1},
+    {"1.46-1", "10:1.46-1", -1},
+    {"1.16.0-4", "0:1.16.0-4", 0},
+    {"3.06-4", "3.06-4-0", -1},
+    {"20230209.2326-1", "0020230209.2326-1", 0},
+    {"4.95.0-1", "0:4.95.0-1", 0},
+    {"1.9.5-4", "1.9.5-4~", 1},
+    {"9.1-1", "1:9.2p1-2+deb12u7", -1},
+    {"1.3-1", "0.13.0-1", 1},
+    {"1.16.0-4", "0:8+255", -1},
+    {"1.12.0-2+b1", "1.12.0-2+b1-1", -1},
+    {"1.20.7-10+b1", "2.36-9+deb12u13", -1},
+    {"1.6.3-2", "00:10ZzbABba:.", -1},
+    {"8.2-1.3", "10:8.2-1.3", -1},
+    {"1.2.6-5", "1.2.6-5~", 1},
+    {"3.06-4", "13.06-4", -1},
+    {"2:4.35-1", "0.17029-2", 1},
+    {"2.4.114-1", "4.0.0+ds-2", -1},
+    {"0.2.5-1", "1.14", -1},
+    {"1:1.10.0+ds-0.4", "1.74.0.3", 1},
+    {"4.95.0-1", "20230209.2326-1", -1},
+    {"6.4", "12.8871625298318949208098815151375099y-00.", -1},
+    {"3.6.1", "1.3-1", 1},
+    {"1.51.1-3+b1", "1.51.1-3+b1A", -1},
+    {"2.14.0+dfsg-1", "2.0.14.0+dfsg-1", 1},
+    {"0.58+deb12u5", "0.58+deb012u5", 0},
+    {"8.2-1.3", "8.2-01.3", 0},
+    {"0.2.5-1", "0.0.2.5-1", 1},
+    {"0.25-1.1", "12.9", -1},
+    {"1:1.16.5-1.3", "2:1.16.5-1.3", -1},
+    {"1.2.1-1", "3.42.2-3+b1", -1},
+    {"3.5-2+b1", "800146-yZYby", -1},
+    {"72.1-3+deb12u1", "72.1-3+deb12u1~", 1},
+    {"1.0.4-3", "1.0.4-3A", -1},
+    {"3.6.1+dfsg+~3.5.14-1", "3.6.1+dfsg+~03.5.14-1", 0},
+    {"1.8.9-2", "1:3.6.0-7.1", -1},
+    {"1:14.0.6-12", "1:14.0.6-12A", -1},
+    {"3.5-2+b1", "3.7.0-0.2+b1", -1},
+    {"6.0-3+b2", "6.0-03+b2", 0},
+    {"1:4.13+dfsg1-1+deb12u1", "4.19.0-2+deb12u1", 1},
+    {"1.6.2-3", "0.10.2-1", 1},
+    {"1.31", "3.8.1-2", -1},
+    {"1.3-1", "7Ya99~-Baz27272366735914652402131.256ZAz", -1},
+    {"1.2.37-2", "2025b-0+deb12u2", -1},
+    {"1:1.1.2-3", "1:1a1.2-3", 1},
+    {"1:1.1.4-1+b2", "1.12.1-0.2", 1},
+    {"15.14-0+deb12u1", "15.14-0+deb12u1~~", 1},
+    {"0.0~git20230123.b2528b0-1", "10:0.0~git20230123.b2528b0-1", -1},
+    {"0.4.0-2", "707202560003661+-255ByA", -1},
+    {"3.4-2.1", "3.4-2.1+", -1},
+    {"2.28.3-1", "12.-2~.", -1},
+    {"2:1.2.3-1", "1.0.4-2", 1},
+    {"0.5.1-6", "1:0.5.1-6", -1},
+    {"1.15.1-5+b1", "1.15.1-5+b1~rc1", 1},
+    {"1.20.7-10+b1", "1+20.7-10+b1", 1},
+    {"3.4-2.1", "1.5.0-1", 1},
+    {"1.0.4-2", "0:0+0489+y0345-+", 1},
+    {"20230209.2326-1", "3.3a-3", 1},
+    {"1.4.19-3", "0.17-2", 1},
+    {"2.6.0", "2.6.0+b1", -1},
+    {"1.6-2.1+deb12u1", "1.6-2.1+deb12u1~a", 1},
+    {"20230311+deb12u1", "2:20230311+deb12u1", -1},
+    {"3.6.1+dfsg+~3.5.14-1", "3.6.1+dfsg+~3.5.14-1~", 1},
+    {"1.3.6-4", "10:1.3.6-4", -1},
+    {"1:2.38.1-5+deb12u3", "1:2.38.1-5+deb12u93", -1},
+    {"2.1-6.1", "10:11.", -1},
+    {"1:0.9.10-1.1", "1:0~9.10-1.1", 1},
+    {"1.4.0-1", "0~20171227-0.3+deb12u1", 1},
+    {"23.0.0-1", "23.10.0-1", -1},
+    {"23.0.0-1", "10:23.0.0-1", -1},
+    {"1.15-1", "1.15-1+b1", -1},
+    {"11.2.185-2", "1:1.2.1-1.1", -1},
+    {"20230209.2326-1", "0:20230209.2326-1", 0},
+    {"0.188-2.1", "0.188-2.1~rc1", 1},
+    {"2:1.1.3-3", "1.23-3", 1},
+    {"3.4-1+b6", "0.5.15-2", 1},
+    {"66.1.1-1+deb12u2", "66.1.1-01+deb12u2", 0},
+    {"1:2.39.5-0+deb12u2", "1:2.39.5-0+deb12u2~rc1", 1},
+    {"3.4-2.1", "0.18-1", 1},
+    {"3.1.0-3", "2.3.6-1", 1},
+    {"0.18-1", "1:3007284243245900268182451100", -1},
+    {"2.12.1+dfsg-5+deb12u4", "3.1-20221030-2", -1},
+    {"2.2-1", "0:2.2-1", 0},
+    {"1.6.0-1", "6Yyy+zAyY-0004512550980000704", -1},
+    {"3.0.17-1~deb12u3", "3.10.17-1~deb12u3", -1},
+    {"5.3.0-4", "1:2.5.1-4", -1},
+    {"2.6.0", "2a6.0", 1},
+    {"2:3.8.2+dfsg-1+b1", "3.11.0-2", 1},
+    {"11.2.185-2", "0:11.2.185-2", 0},
+    {"2.14.1-4", "1.0-2", 1},
+    {"2.1-6.1", "2.0.1-6.1", 1},
+    {"3.11.2-3", "2022.1-1", -1},
+    {"6.0-28", "1:7.7+23", -1},
+    {"1.10.8+repack1-1", "1000955+3", -1},
+    {"4.2.0-1", "4.2.0-01", 0},
+    {"4.0.0+ds-2", "5995608754645180091322094392+Yyab-YBa1a", -1},
+    {"1:4.4.33-2", "1.201-1", 1},
+    {"2:3.8.2+dfsg-1+b1", "92550674ZB-~~", 1},
+    {"1.65.2+deb12u1", "9-y11-+11033bzy", -1},
+    {"1.20.7-10+b1", "7.88.1-10+deb12u14", -1},
+    {"2:1.0.10-1", "38.0.4-3+deb12u1", 1},
+    {"1.13.4~dfsg+~1.11.4-3", "1a13.4~dfsg+~1.11.4-3", 1},
+    {"6.1.0-3", "6.1.0-03", 0},
+    {"1.8.0-1", "4.1.4-3", -1},
+    {"3.4-2.1", "0.10.2-1", 1},
+    {"66.1.1-1+deb12u2", "66.1.1-1+deb12u2+b1", -1},
+    {"1.5-1", "12Zy+991-+.Z..", -1},
+    {"0.08-5", "01:129.~.:", -1},
+    {"3.4.0-1", "1.2.4-0.2+deb12u1", 1},
+    {"3.0.8-3", "2023.3+deb12u2", -1},
+    {"1.74.0.3", "0:1.74.0.3", 0},
+    {"1:2.5.1-4", "1210YZZ+", 1},
+    {"20230311+deb12u1", "1:4000869~", -1},
+    {"1:1.2.13.dfsg-1", "1:1.2.13.dfsg-1~a", 1},
+    {"0.24.1-2", "44.0-2", -1},
+    {"1:1.2.1-1.1", "120yzA0367-BAb3", 1},
+    {"2.1.12-stable-8", "6.4", -1},
+    {"1.201-1", "1.0201-1", 0},
+    {"3.6.1", "3~6.1", 1},
+    {"1.15.1-1+deb12u1", "7298402063524813300803056242944392ybb-.000623", -1},
+    {"3.1-20221030-2", "3~1-20221030-2", 1},
+    {"3.23+nmu1", "5.+~b", -1},
+    {"1.14", "1.14~1", 1},
+    {"2:9.0.1378-2+deb12u2", "23.0.1+dfsg-1", 1},
+    {"1.6-2.1+deb12u1", "0.4.0-1+b1", 1},
+    {"2.3.3-1+b1", "1:30425+Zb99100-Bb1199", -1},
+    {"1.8.9-2", "1:1.8.9-2", -1},
+    {"2025b-0+deb12u2", "1.46-1", 1},
+    {"0.3.9-1+b1", "15.14-0+deb12u1", -1},
+    {"1:0.9.10-1.1", "1:2.39.5-0+deb12u2", -1},
+    {"9.1.0+ds1-2", "9.1.0+ds1-02", 0},
+    {"0.270", "0.270~~", 1},
+    {"3.21.12-3", "3.23+nmu1", -1},
+    {"1.5.7-1", "1:1.5.7-1", -1},
+    {"2.14.1-4", "2.14.1-4~1", 1},
+    {"44.0-2", "0:2-00383AbZZ--.B7624205809418984892000222", 1},
+    {"1.0.8-5+b1", "2.3.3-9", -1},
+    {"1.0.8-5", "1.8.1-1", -1},
+    {"30+20221128-1", "30+20221128-1.", -1},
+    {"0.4.0-1+b1", "0.4.0-01+b1", 0},
+    {"6.03-2", "6.03-2~~", 1},
+    {"3.4-1+b5", "3.4-1+b5A", -1},
+    {"1.15-1", "1.14.10-1~deb12u1", 1},
+    {"2.4+20151223.gitfa8646d.1-2+b2", "1aBa1+yz-00736~y900567", 1},
+    {"1.3.1-1", "1.3.1-01", 0},
+    {"6.1.153-1", "6.1.153-1~1", 1},
+    {"2.37-6", "02.37-6", 0},
+    {"3.42.2-3+b1", "2:3.42.2-3+b1", -1},
+    {"1.12-1", "1.12-1-0", -1},
+    {"1.5-1", "3.0.17-1~deb12u3", -1},
+    {"1.12.0-2+b1", "3.8-5", -1},
+    {"1.2.1-1", "1.002.1-1", 0},
+    {"10.0.0", "10.0.0~~", 1},
+    {"0.14.5-1", "0.14.5-01", 0},
+    {"8.6.13", "2.37-6", 1},
+    {"8.6.13+dfsg-2", "999+~00040.-+", -1},
+    {"0.4.0-2", "0.20.4-3", -1},
+    {"0.99.30-4.1~deb12u1", "0.99.30-4.1~deb1002u1", -1},
+    {"3.11.2-1+b1", "3.11.2-01+b1", 0},
+    {"1.63.0+dfsg1-2", "0:1.63.0+dfsg1-2", 0},
+    {"2.2.2-2", "2.2.2-2+", -1},
+    {"2.4.114-1+b1", "2:2.4.114-1+b1", -1},
+    {"3.11.2-1+b1", "3.23+nmu1", -1},
+    {"3.42.2-3+b1", "01:11:yAA-63384589780108614808111824057366752426100+9ZZ", -1},
+    {"1.0.8-5+b1", "1~0.8-5+b1", 1},
+    {"5.2.15-2+b9", "5.2.15-2+b9~rc1", 1},
+    {"1.6-2.1+deb12u1", "3.11.0-2", -1},
+    {"1.5-1", "1:3.6.0-7.1", -1},
+    {"3.4-1", "2.5.13+dfsg-5", 1},
+    {"0.11.7-2", "20aZA-00715100", -1},
+    {"0.3.21+ds-4", "1.15-1", -1},
+    {"1.6.2-3", "1:1.6.2-3", -1},
+    {"2.14-2", "2.14-02", 0},
+    {"5.3.28+dfsg2-1", "2.10.1-1+b1", 1},
+    {"1.23-3", "10..3", -1},
+    {"0.20.4-3", "4.1.4-3", -1},
+    {"1:2.5.1-4", "1:2.5.1-4+", -1},
+    {"1.0-2", "1.0.6-3", -1},
+    {"0~20171227-0.3+deb12u1", "0~20171227-0.3+deb12u1~", 1},
+    {"4.3-4.1", "1BbaYA-~10+Ba~", 1},
+    {"3.11.2-3", "10:3.11.2-3", -1},
+    {"4.3-4.1", "4.3-4.1-1", -1},
+    {"0.7.0+dfsg-8+b1", "0.0.7.0+dfsg-8+b1", 1},
+    {"1.74.0+ds1-21", "1a74.0+ds1-21", 1},
+    {"1:2.5.1-4+b2", "12.", 1},
+    {"2.35.1-1", "2.35.1-001", 0},
+    {"4.1.4-3", "1:1.0.9-1", -1},
+    {"1.0.18-1", "0:1.0.18-1", 0},
+    {"2.2-1", "10:7+", -1},
+    {"1.3.3+ds-1", "1.3.3+ds-1~", 1},
+    {"1.51.1-3+b1", "7~256AB-~yyy004690", -1},
+    {"12.9", "22.3.6-1+deb12u1", -1},
+    {"3.134", "10.42-1", -1},
+    {"2.7.6-7", "6.1.153-1", -1},
+    {"1:1.0.9-1", "1:1.0.9-91", -1},
+    {"0.3.21+ds-4", "1.6-3", -1},
+    {"1.0.11-1+deb12u2", "10:1.0.11-1+deb12u2", -1},
+    {"1.63.0+dfsg1-2", "1.63.0+dfsg1-2~1", 1},
+    {"0.8.3-1+b3", "0.8.3-1+b3-1", -1},
+    {"1.201-1", "1.21.3-1+deb12u1", 1},
+    {"1.10.8+repack1-1", "20230209.2326-1", -1},
+    {"1:1.2.13.dfsg-1", "1:1a2.13.dfsg-1", 1},
+    {"1.0.8-5", "13-yzbZz00681052.", -1},
+    {"3.06-4", "3.06-4.", -1},
+    {"1.0.4-2", "1.0.4-2a", -1},
+    {"1:3.5.12-1.1+deb12u1", "1:3.5.12-1.1+deb012u1", 0},
+    {"1.1.35-1+deb12u3", "3.5-2+b1", -1},
+    {"3.4-2.1", "0.22-4+b1", 1},
+    {"0.04-8+b1", "0:0.04-8+b1", 0},
+    {"66.1.1-1+deb12u2", "00:6YBYa00856-zB48737630013938670651188041535623999.", 1},
+    {"12.2.0-14+deb12u1", "1.4.19-3", 1},
+    {"1.17.1-2+deb12u3", "1.17.1-02+deb12u3", 0},
+    {"1:2.1.5-2", "2.1.5-2", 1},
+    {"0.4-1", "1.3.4.20200120-3.1", -1},
+    {"3.5-2+b1", "1.34+dfsg-1.2+deb12u1", 1},
+    {"2.2.0-2", "3.23+nmu1", -1},
+    {"1.51.1-3+b1", "1.51.1-3+b1~~", 1},
+    {"1:1.0.9-1", "1.22.0-2+deb12u1", 1},
+    {"3.5-2+b1", "3.0.5-2+b1", 1},
+    {"3.06-4", "6.1.0-3", -1},
+    {"1.07-5", "2.1-6.1", -1},
+    {"1.0.18-1", "10:1.0.18-1", -1},
+    {"2.12.1+dfsg-5+deb12u4", "15.14-0+deb12u1", -1},
+    {"1.16.0-4", "1211-99zy.YYy", -1},
+    {"2.3.1-1", "2.3.001-1", 0},
+    {"4.0.0+ds-2", "4.0.0+ds-2~1", 1},
+    {"1:7.7+23", "8108933336363854079801949014554-zzaAaA+yYZ", 1},
+    {"5.2.15-2+b9", "5.2.15-12+b9", -1},
+    {"1.3.6-4", "1:4.4.33-2", -1},
+    {"4.15.0-1", "63bzAAB-abY", -1},
+    {"23.0.1+dfsg-1", "23.0.0.1+dfsg-1", 1},
+    {"1:1.1.4-1+b2", "1:1.1.4-1+b2~a", 1},
+    {"3.42.2-3+b1", "11.2.185-2", -1},
+    {"6.0-28", "6.0.0-28", -1},
+    {"1.2.1-1", "8.6.13-2", -1},
+    {"1.3.2-4+b1", "10:1.3.2-4+b1", -1},
+    {"3.7.9-2+deb12u5", "3.7.9-2+deb12u5+b1", -1},
+    {"2.3.6-1", "7~-YzaZ0122", -1},
+    {"1.74.0-3", "1.74.0-3~a", 1},
+    {"2.10-0.1+deb12u2", "1.6-2.1+deb12u1", 1},
+    {"1.3.6-4", "0:1.3.6-4", 0},
+    {"1:2.5.1-4+b2", "1.3.0-2", 1},
+    {"1.0-2", "1.1.35-1+deb12u3", -1},
+    {"1.74.0-3", "0.8.1-1", 1},
+    {"1:2.38.1-5+deb12u3", "1:2~38.1-5+deb12u3", 1},
+    {"1:1.1.2-1", "1.1.2-1", 1},
+    {"8.2-1.3", "8.2-11.3", -1},
+    {"1:4.13+dfsg1-1+deb12u1", "1:4.13+DFSG1-1+DEB12U1", 1},
+    {"2.3.1-1", "2.3.1-01", 0},
+    {"12.4+deb12u12", "12.4+deb12u12~a", 1},
+    {"3.3+20.604758e7-6.2", "0.18-1", 1},
+    {"2.2.40-1.1+deb12u1", "2+2.40-1.1+deb12u1", 1},
+    {"2:1.8.4-2+deb12u2", "63~255aZz", 1},
+    {"4.2.2-1+deb12u1", "0~20171227-0.3+deb12u1", 1},
+    {"2.0.0-1", "2:1.8.4-2+deb12u2", -1},
+    {"0.08-5", "5.7-0.5~deb12u1", -1},
+    {"1:1.11-1.1", "1:1.11-01.1", 0},
+    {"1.5.4+dfsg2-5", "2.4.114-1", -1},
+    {"0.58+deb12u5", "1+yb3~-100331", -1},
+    {"4:12.2.0-3", "5.3.28+dfsg2-1", 1},
+    {"2.4.114-1", "3.8-5", -1},
+    {"590-2.1~deb12u2", "2.0.0-1", 1},
+    {"9.1.0+ds1-2", "1.6-2.1+deb12u1", 1},
+    {"1.6-3", "1:2.1.5-2", -1},
+    {"2.38.1-5+deb12u3", "1:1.2.13.dfsg-1", -1},
+    {"1.12.0-2+b1", "4.19.0-2+deb12u1", -1},
+    {"4.9.0-4", "4.15.0-1", -1},
+    {"1.31-1.2", "0.188-2.1", 1},
+    {"1.6-3", "2.5.5-5", -1},
+    {"1.9.5-4", "00:8:YB", -1},
+    {"3.11.0-2", "5.36.0-7+deb12u3", -1},
+    {"1:1.1.2-3", "2:4.0.2-3", -1},
+    {"2.5.0-1+deb12u2", "2.5.0-01+deb12u2", 0},
+    {"2.12.1+dfsg-5+deb12u4", "2617732063070409762443725182462706916505-01", -1},
+    {"2.5.4-1+deb12u1", "0.22-4+b1", 1},
+    {"0.188-2.1", "1.21.3-1+deb12u1", -1},
+    {"1.3-1", "1.18.1-3", -1},
+    {"2.3.3-9", "2~3.3-9", 1},
+    {"4.0.0+ds-2", "4.0.0+ds-2A", -1},
+    {"3.4-1+b5", "0:11100-++:-+100zY", -1},
+    {"1.3.4.20200120-3.1", "1.3.4.20200120-3.1.0", -1},
+    {"1.3.6-4", "1.3.006-4", 0},
+    {"1.12.0-2+b1", "10.42-1", -1},
+    {"1.0.9-2+b6", "1.0.0.9-2+b6", 1},
+    {"1.5-1", "1.5-1.", -1},
+    {"0.18-1", "1:0.18-1", -1},
+    {"1.16.0-4", "1.16.0-4~~", 1},
+    {"3.6.1", "12.4+deb12u12", -1},
+    {"1.5.0-1", "1.31-1.2", -1},
+    {"1:3.0.9-1", "60317zzAB~-6548388324511416543877099994152687626.3", 1},
+    {"1.34+dfsg-1.2+deb12u1", "0:1.34+dfsg-1.2+deb12u1", 0},
+    {"4.2.2-1+deb12u1", "2.3.1-1", 1},
+    {"1.0.4-3", "3.0.8-3", -1},
+    {"0.11.7-2", "1.6-3", -1},
+    {"9.1-1", "1.52.0-1+deb12u2", 1},
+    {"38.0.4-3+deb12u1", "200064330712104878920936778923149300007101-0~~yz+", -1},
+    {"20220109.1", "3.4-2.1", 1},
+    {"0.04-8+b1", "0.0004-8+b1", 0},
+    {"2.4.114-1", "2.4.114-1.0", -1},
+    {"0.20.4-3", "110215-92190338249461129115442635500713-000406ZZ", -1},
+    {"2.74.6-2+deb12u7", "1.4.3-1", 1},
+    {"2.9.0-1", "1:5.44-3", -1},
+    {"23.0.0-1", "3.2.2-1", 1},
+    {"1.31", "1.931", -1},
+    {"0~20171227-0.3+deb12u1", "0~20171227-00.3+deb12u1", 0},
+    {"1.0.6-1+b1", "1~0.6-1+b1", 1},
+    {"1.4.1+dfsg-1", "20220623.1-1+deb12u2", -1},
+    {"3.11.2-6+deb12u6", "3.11.2-06+deb12u6", 0},
+    {"2.3.1-1", "1251152419281691821754558067106040310574.", -1},
+    {"3.11.2-3", "1.10.0-3+b1", 1},
+    {"1.2.4-0.2+deb12u1", "1a2.4-0.2+deb12u1", 1},
+    {"0.2.5-1", "0.8.0-2+b1", -1},
+    {"1:14.0.6-12", "900661~00978000441-1zYy", 1},
+    {"1.9.4-1", "1.9.14-1", -1},
+    {"1.21.3-1+deb12u1", "1.21.3-91+deb12u1", -1},
+    {"1.51.1-3+b1", "72.1-3+deb12u1", -1},
+    {"3.4-1", "1.0.9-2+b6", 1},
+    {"11.2.185-2", "11a2.185-2", 1},
+    {"1:2.5.1-4", "1.6-3", 1},
+    {"1.0.8+1-1", "1.0.8+1-1~rc1", 1},
+    {"6.4-4", "6.94-4", -1},
+    {"0.4-1", "0.4-91", -1},
+    {"1.21.22", "1.10.1-3", 1},
+    {"1.07-5", "0.16.1-2", 1},
+    {"1.5.2-6+deb12u1", "1.0.5.2-6+deb12u1", 1},
+    {"0.8.1-1", "0.8.1-01", 0},
+    {"4.0.0+ds-2", "590-2.1~deb12u2", -1},
+    {"2.3.1-3", "1.13.1-1", 1},
+    {"9.0.2-1.1", "9.0.2-1.1~1", 1},
+    {"8.6.13+dfsg-2", "1.17.1-2+deb12u3", 1},
+    {"1.0.11-1+deb12u2", "1.0.11-1+deb12u2~~", 1},
+    {"2.6.0-1", "2.14.1-4", -1},
+    {"1:2.1.5-2", "1.2.6-5", 1},
+    {"4.9.0-4", "37~deb12u1", -1},
+    {"23.0.0-1", "2:23.0.0-1", -1},
+    {"2:1.8.4-2+deb12u2", "2:1.8.4-2+deb12u2~", 1},
+    {"1:5.44-3", "1:5~44-3", 1},
+    {"3.2.2-1", "9.1-1", -1},
+    {"0.4.0-2", "00:8YaYz+-..", -1},
+    {"1.18.1-3", "1~18.1-3", 1},
+    {"0.18-1", "1.6.39-2", -1},
+    {"1.3-1", "6.7873913624590181456024.99aaB", -1},
+    {"4.1.4-3+b1", "1.6.39-2", 1},
+    {"3.21.12-3", "80aAY2-Y-baBz94982396011618959117601993AZ", -1},
+    {"0.0~git20230123.b2528b0-1", "0.0~git20230123.b2528b0-1~rc1", 1},
+    {"12.2.0-14+deb12u1", "3721769521377276368156+-~+", -1},
+    {"1.9.4-1", "120468256A", -1},
+    {"3.8.1-2", "3.18.1-2", -1},
+    {"11+nmu1", "11+nmu1-1-1", -1},
+    {"0.188-2.1", "0.188-2.1+b1", -1},
+    {"1:3.0.9-1", "3.134", 1},
+    {"1.1.35-1+deb12u3", "2.35.1-1", -1},
+    {"1:1.2.13.dfsg-1", "2.2.40-1.1+deb12u1", 1},
+    {"2.2-1", "2.2-1~rc1", 1},
+    {"3.4-1+b6", "1.15.1-5+b1", 1},
+    {"2023.3+deb12u2", "1.44.2-1+deb12u1", 1},
+    {"3.8-5", "3a8-5", 1},
+    {"2.13.10-1", "1.6.2-3", 1},
+    {"1.14-1", "2.0.16-1", -1},
+    {"2.6.1", "2.6.1~a", 1},
+    {"1.51.1-3+b1", "1.51.1-3+b1~rc1", 1},
+    {"1.5-1", "1.5-1.0", -1},
+    {"2.4.114-1+b1", "2.4.114-01+b1", 0},
+    {"2.4.114-1+b1", "1.2.4-0.2+deb12u1", 1},
+    {"23.6-1", "23.6-1~a", 1},
+    {"6.03-2", "1.7.1-1", 1},
+    {"3.4.4-1", "93.4.4-1", -1},
+    {"0.38.4-2", "0:599--39824223786449341163919aB", -1},
+    {"3.0.17-1~deb12u3", "0:3.0.17-1~deb12u3", 0},
+    {"3.4.0-1", "3.4.0-01", 0},
+    {"1.4.19-3", "6.4", -1},
+    {"1:1.2.13.dfsg-1", "0.22-4+b1", 1},
+    {"3.7.9-2+deb12u5", "3.7.9-2+deb12u5~1", 1},
+    {"1.21.3-1+deb12u1", "1:3.0.9-1", -1},
+    {"2.5.5-5", "3.11.2-3", -1},
+    {"3.8.1-2", "3.008.1-2", 0},
+    {"3.0.8-3", "3.0.8-3~1", 1},
+    {"30+20221128-1", "1.21.3-1+deb12u1", 1},
+    {"0.16-2", "0.16-2.", -1},
+    {"1.8.9-2", "1a8.9-2", 1},
+    {"5.3.28+dfsg2-1", "10:5.3.28+dfsg2-1", -1},
+    {"2.7.0-2", "1:2.7.0-2", -1},
+    {"1.65.2+deb12u1", "1.13.2+dfsg-1", 1},
+    {"3.42.2-3+b1", "3.42.2-3+b1~", 1},
+    {"1:14.0.6-12", "1:14.0.6-12~rc1", 1},
+    {"1:6.0.0-2", "1:6.0.0-2~~", 1},
+    {"2.0.16-1", "1.51.1-3+b1", 1},
+    {"2.36-9+deb12u13", "3.7.9-2+deb12u5", -1},
+    {"1.3.3+ds-1", "6.9.8-1", -1},
+    {"1.9.5-4", "1.9.5-4+b1", -1},
+    {"1.20.1-2+deb12u4", "0:1.20.1-2+deb12u4", 0},
+    {"1:1.0.9-1", "23.0.0-1", 1},
+    {"0.4.0-1+b1", "0.4.0-1+b1~1", 1},
+    {"1.2.4-0.2+deb12u1", "3.1-20221030-2", -1},
+    {"4.2.2-1+deb12u1", "2:4000407-Z.~-2569", -1},
+    {"6.0-3+b2", "1.0.4-3", 1},
+    {"7.88.1-10+deb12u14", "1:2.66-4+deb12u2", -1},
+    {"1.16.0-4", "6.0-3+b2", -1},
+    {"2.74.6-2+deb12u7", "1:6.0.0-2", -1},
+    {"6.9.8-1", "20220601+dfsg-1+b1", -1},
+    {"1:1.1.4-1+b2", "1:1.1.4-01+b2", 0},
+    {"0.11.7-2", "0.2.5-1", 1},
+    {"2:1.3.4-1+b1", "2:1.3.4-1+b1~~", 1},
+    {"1.31", "1:10~000333", -1},
+    {"1.10.0-3+b1", "1.10.0-3+b1a", -1},
+    {"9.1-1", "9.1-11", -1},
+    {"1:3.8-4", "8.6.13", 1},
+    {"0.17029-2", "0.99.30-4.1~deb12u1", 1},
+    {"1.13.1-1", "12010yB000933--.", -1},
+    {"3.11.2-1+b1", "2021.8.0-2", -1},
+    {"2.38.1-5+deb12u3", "2.38.1-5+deb12u3a", -1},
+    {"2:1.0.10-1", "1:1.0.10-1", 1},
+    {"1.16.0-4", "1.16.0-4-0", -1},
+    {"0.3.21+ds-4", "2:0.3.21+ds-4", -1},
+    {"0.14.5-1", "8-2-99.YBzbZ", -1},
+    {"0.3.21+ds-4", "0:0.3.21+ds-4", 0},
+    {"2.4.114-1+b1", "10+-+000763", -1},
+    {"7.88.1-10+deb12u14", "7.898.1-10+deb12u14", -1},
+    {"1.21.0-1", "3.2.2-1", -1},
+    {"3.0.9-1", "0.38.4-2", 1},
+    {"1.8.0-1", "1.9.5-4", -1},
+    {"3.42.2-3+b1", "2025b-0+deb12u2", -1},
+    {"2.1.28+dfsg-10", "0:2.1.28+dfsg-10", 0},
+    {"22.3.6-1+deb12u1", "22.3.6-1+DEB12U1", 1},
+    {"8.6.13-2", "8.6.0013-2", 0},
+    {"1:0.4.5-1", "0.4.5-1", 1},
+    {"4.2.2-1+deb12u1", "4.2.2-01+deb12u1", 0},
+    {"1.3.6-4", "1.13.6-4", -1},
+    {"3.4-1+b5", "0.17029-2", 1},
+    {"1.07-5", "2023.3+deb12u2", -1},
+    {"2.3.6-1", "51--.", -1},
+    {"8.6.13", "3.0.9-1", 1},
+    {"1.74.0.3", "3.11.2-6+deb12u6", -1},
+    {"1.10.8+repack1-1", "3.11.2-6+deb12u6", -1},
+    {"1.5.7-1", "1:4.4.33-2", -1},
+    {"1:6.0.0-2", "2:6.0.0-2", -1},
+    {"2.5.5-5", "2.5.5-15", -1},
+    {"66.1.1-1+deb12u2", "66.1.1-1+deb12u2~~", 1},
+    {"1.4.19-3", "0:401252397270128739849686535514443-+bba~+9", -1},
+    {"6.4", "0.17029-2", 1},
+    {"0.99.30-4.1~deb12u1", "0:0.99.30-4.1~deb12u1", 0},
+    {"12.0-1", "1:12.0-1", -1},
+    {"10.42-1", "2:10.42-1", -1},
+    {"20.19.5-1nodesource1", "20+19.5-1nodesource1", 1},
+    {"0.13.0-1", "00:11zy9492467810483928464102121-0004479bbAay", -1},
+    {"2.14.0+dfsg-1", "10:2096111::-..0710~81491042432413467592046240176", -1},
+    {"252.39-1~deb12u1", "1:252.39-1~deb12u1", -1},
+    {"44.0-2", "44.0-2~~", 1},
+    {"590-2.1~deb12u2", "23.6-1", 1},
+    {"3.0-13", "0:3.0-13", 0},
+    {"0.20.4-3", "1~ay100", -1},
+    {"2:1.2.3-1", "2:1.2.3-1+b1", -1},
+    {"1.2.4-0.2+deb12u1", "1.2.4-0.2+deb12u1~", 1},
+    {"3.21.12-3", "1.13.1-1", 1},
+    {"1.0.8-5", "2..-YZa~", -1},
+    {"1:3.6.0-7.1", "1:1.1.2-3", 1},
+    {"3.3a-3", "3.3a-3~~", 1},
+    {"0.04-8+b1", "0.7.0+dfsg-8+b1", -1},
+    {"12.0-1", "0:12.0-1", 0},
+    {"1:1.2.13.dfsg-1", "1.0.6-3", 1},
+    {"2.2.40-1.1+deb12u1", "82A9+--0844Bza.", -1},
+    {"2:4.35-1", "5.4.1-1", 1},
+    {"1.5.1+ds-1+deb12u1", "2:1.5.1+ds-1+deb12u1", -1},
+    {"3.8.1-2", "0bB2+00664-Yaa+", 1},
+    {"23.0.0-1", "23.0.0-1+b1", -1},
+    {"2.3.3-1+b1", "10:2.3.3-1+b1", -1},
+    {"3.6.1", "7.88.1-10+deb12u14", -1},
+    {"4.9.0-4", "110Yyy991", -1},
+    {"2.38.1-5+deb12u3", "23.0.1+dfsg-1", -1},
+    {"5.3.0-4", "4.0.0+ds-2", 1},
+    {"2021.8.0-2", "2021.8.0-02", 0},
+    {"0.10.2-1", "1.15.1-1+deb12u1", -1},
+    {"3.0.8-3", "5.4.1-1", -1},
+    {"2:1.3.4-1+b1", "3.6.1+dfsg+~3.5.14-1", 1},
+    {"3.2.2-1", "6.0-28", -1},
+    {"6.4-4", "6.4-4~", 1},
+    {"3.6.2-1+deb12u3", "1:2.66-4+deb12u2", -1},
+    {"2.10.1-1+b1", "2.10.1-01+b1", 0},
+    {"1.31-1.2", "1.31-01.2", 0},
+    {"4.9.0-4", "10:4.9.0-4", -1},
+    {"1.0-2", "2022.1-1", -1},
+    {"10.42-1", "0:10.42-1", 0},
+    {"20220109.1", "4.8.12-3.1", 1},
+    {"2.10-0.1+deb12u2", "01:1a:10-10011624152287773677202032294680846412655026386479788416657142059", -1},
+    {"1.8.0-1", "1.74.0.3", -1},
+    {"11+nmu1", "11+nmu1~1", 1},
+    {"0.66.0+ds1-1", "0.16.1-2", 1},
+    {"0.04-8+b1", "0+04-8+b1", 1},
+    {"6.1.153-1", "1:2.66-4+deb12u2", -1},
+    {"2.2-1", "3.8-5", -1},
+    {"23.0.0-1", "3.1-20221030-2", 1},
+    {"1.14-1", "0.20.4-3", 1},
+    {"22.3.6-1+deb12u1", "1:3.6.0-7.1", -1},
+    {"3.11.2-1+b1", "21107071-+Zb0~", -1},
+    {"0.17029-2", "0.17029-02", 0},
+    {"1.3.4.20200120-3.1", "10:1.3.4.20200120-3.1", -1},
+    {"1.2.37-2", "1.2.37-02", 0},
+    {"1:2.38.1-5+deb12u3", "2.1-6.1", 1},
+    {"1.4.1+dfsg-1", "3.0-13", -1},
+    {"1:14.0-55.7~deb12u1", "1:14.0-55.7~deb12u1A", -1},
+    {"0.2.5-1", "12.0-1", -1},
+    {"4.13.0-1", "5.2.15-2+b9", -1},
+    {"5.2.15-2+b9", "0:5.2.15-2+b9", 0},
+    {"3.23+nmu1", "3.23+nmu1-1-1", -1},
+    {"0.17029-2", "0.17029-2~~", 1},
+    {"2.2.2-2", "2:1.3.4-1+b1", -1},
+    {"1.17.1-2+deb12u3", "1a17.1-2+deb12u3", 1},
+    {"1.44.2-1+deb12u1", "1.44.2-1+DEB12U1", 1},
+    {"2.4.7-7~deb12u1", "2.4.7-7~DEB12U1", 1},
+    {"2.3.3-1+b1", "12.0-1", -1},
+    {"4.95.0-1", "4.95.0-01", 0},
+    {"4.1.4-3+b1", "2:4--++~1", -1},
+    {"3.0.17-1~deb12u3", "2:3.0.17-1~deb12u3", -1},
+    {"0.4-1", "1:0.4.5-1", -1},
+    {"1.4.3-1", "0:1.4.3-1", 0},
+    {"6.4-4", "2:4.0.2-3", -1},
+    {"2.14.0+dfsg-1", "3.0.9-1", -1},
+    {"2:1.0.10-1", "2.35.1-1", 1},
+    {"22.3.6-1+deb12u1", "22.0.3.6-1+deb12u1", 1},
+    {"1.4.19-3", "1.0.11-1+deb12u2", 1},
+    {"2023.3+deb12u2", "2023.3+deb12u2~rc1", 1},
+    {"3.40.1-2+deb12u2", "15.14-0+deb12u1", -1},
+    {"0.3.9-1+b1", "3.0-13", -1},
+    {"1.6.39-2", "1+6.39-2", 1},
+    {"0.25-1.1", "1.3.0-2", -1},
+    {"1.0.6-3", "1.0.6-3~~", 1},
+    {"0.13.0-1", "11+nmu1", -1},
+    {"1.9.5-4", "0:1.9.5-4", 0},
+    {"3.0-13", "1.6.39-2", 1},
+    {"1:1.16.5-1.3", "1:1.16.5-1.3~1", 1},
+    {"0.8.1-1", "0:0.8.1-1", 0},
+    {"0.17029-2", "1.6.2-3", -1},
+    {"4.3-4.1", "4.0.3-4.1", 1},
+    {"0.8.0-2+b1", "0:6844998929874435277631246437-11", -1},
+    {"1.21.3-1+deb12u1", "1.21.3-01+deb12u1", 0},
+    {"9.0.2-1.1", "0.4-1", 1},
+    {"1.12-1", "2:1.02.185-2", -1},
+    {"3.4.0-1", "2:1.0.10-1", -1},
+    {"22.3.6-1+deb12u1", "1:12Z-+", -1},
+    {"4.15.0-1", "1.4.3-1", 1},
+    {"2:2.6.1-4~deb12u2", "9BzbZ+", 1},
+    {"2.71-3", "2:2.71-3", -1},
+    {"23.0.0-1", "0:23.0.0-1", 0},
+    {"1:5.44-3", "1:5.44-3~rc1", 1},
+    {"1.65.2+deb12u1", "1.65.2+deb12u1~a", 1},
+    {"37~deb12u1", "3.6.1", 1},
+    {"1.20.1-2+deb12u4", "1.20.1-92+deb12u4", -1},
+    {"1.7.1-1", "1~7.1-1", 1},
+    {"0.3.21+ds-4", "3.0.8-3", -1},
+    {"3.0.8-3", "0:3.0.8-3", 0},
+    {"2.9.0-1", "2.9.0-1.0", -1},
+    {"1:1.1.2-3", "1:1.1.2-3~rc1", 1},
+    {"3.25.1-1", "3.25.1-1~rc1", 1},
+    {"1.21.3-1+deb12u1", "1.2001.3-1+deb12u1", -1},
+    {"0.24.1-2", "4.15.0-1", -1},
+    {"0.16-2", "0.0~git20230123.b2528b0-1", 1},
+    {"0.11.7-2", "1:0.11.7-2", -1},
+    {"2.38.1-5+deb12u3", "8.2-1.3", -1},
+    {"0.11.7-2", "1612890180469552825168439650987.924969058790789393158600170844493883782-..~", -1},
+    {"3.7.0-0.2+b1", "3.7.0-00.2+b1", 0},
+    {"1.10.8+repack1-1", "10zyZ71772477671259569099345406217469595bY.", -1},
+    {"1:2.66-4+deb12u2", "4.95.0-1", 1},
+    {"1.2.37-2", "2:1.1.3-3", -1},
+    {"3.6.1", "1:3.6.1", -1},
+    {"1:6.0.0-2", "1.13.1-1", 1},
+    {"1.0.6-3", "0:72.1100349612253830984201920625973902807920109971", -1},
+    {"0.17-2", "0:0.17-2", 0},
+    {"3.6.0-1+deb12u2", "1:3.6.0-1+deb12u2", -1},
+    {"1.201-1", "1.201-01", 0},
+    {"2.3.3-1+b1", "1.5.7-1", 1},
+    {"3.4-1+b5", "0.1.4-1", 1},
+    {"1.1.35-1+deb12u3", "1.0.6-1+b1", 1},
+    {"1.3.3+ds-1", "0.7.0+dfsg-8+b1", 1},
+    {"1.5.0-1", "0:1.5.0-1", 0},
+    {"23.6-1", "213.6-1", -1},
+    {"1.7.1-1", "1.7.1-1~1", 1},
+    {"1:1.1.2-3", "3.4-1", 1},
+    {"1:0.4.5-1", "4.9.0-4", 1},
+    {"0.3.9-1+b1", "0.3.9-91+b1", -1},
+    {"2.35.1-1", "0.18+nmu1", 1},
+    {"1.0.6-1+b1", "7007601-3yYz100", -1},
+    {"23.0.0-1", "3.3a-3", 1},
+    {"2.3.3-9", "3.11.2-1+b1", -1},
+    {"2.40-2", "2.40-2-0", -1},
+    {"2.9.0-1", "1.0.11-1+deb12u2", 1},
+    {"23.0.1+dfsg-1", "1:310222-0962~~~", -1},
+    {"2:1.8.4-2+deb12u2", "2:1.8.4-2+deb12u2+", -1},
+    {"1.46-1", "10.42-1", -1},
+    {"1.15.1-5+b1", "2.3.3-9", -1},
+    {"1:2.1.5-2", "1:2.01.5-2", 0},
+    {"1.34+dfsg-1.2+deb12u1", "1+34+dfsg-1.2+deb12u1", 1},
+    {"3.0.9-1", "8.2-1.3", -1},
+    {"1.3.0-2", "1.10.8+repack1-1", -1},
+    {"1.34+dfsg-1.2+deb12u1", "2:1.34+dfsg-1.2+deb12u1", -1},
+    {"1.3.6-4", "5.36.0-7+deb12u3", -1},
+    {"252.39-1~deb12u1", "252a39-1~deb12u1", 1},
+    {"2.37-6", "2.37-06", 0},
+    {"4.9-1", "4.9-1~a", 1},
+    {"1.63.0+dfsg1-2", "1:1.2.13.dfsg-1", -1},
+    {"4.2.0-1", "1.74.0+ds1-21", 1},
+    {"3.1-20221030-2", "2:3.1-20221030-2", -1},
+    {"2.38.1-5+deb12u3", "2.1.12-stable-8", 1},
+    {"2.7.6-7", "0.188-2.1", 1},
+    {"1.14.10-1~deb12u1", "122-3", -1},
+    {"4.1.4-3+b1", "4.1.4-3+b01", 0},
+    {"2.6.1", "2.6.1.", -1},
+    {"0.99.30-4.1~deb12u1", "1:0.99.30-4.1~deb12u1", -1},
+    {"2022.1-1", "0.10.2-1", 1},
+    {"4.5.0-6+deb12u2", "4.5.0-06+deb12u2", 0},
+    {"2.9.0-1", "7a255256Yyz--+", -1},
+    {"2.3.3-9", "1.5.4+dfsg2-5", 1},
+    {"1.74.0-3", "1.0-2", 1},
+    {"12.4+deb12u12", "12.4+deb12u12+", -1},
+    {"3.06-4", "4+-BzZBYA~~", -1},
+    {"1:1.0.9-1", "2.36-9+deb12u13", 1},
+    {"20220601+dfsg-1+b1", "0:20220601+dfsg-1+b1", 0},
+    {"2.2.40-1.1+deb12u1", "1.07-5", 1},
+    {"2.2.0-2", "0.11.7-2", 1},
+    {"1.4.1+dfsg-1", "1:1.4.1+dfsg-1", -1},
+    {"1.4.3-1", "3.7.0-0.2+b1", -1},
+    {"1.14.10-1~deb12u1", "2:3.8.2+dfsg-1+b1", -1},
+    {"6.4", "1.21.3-1+deb12u1", 1},
+    {"2.7.6-7", "20220623.1-1+deb12u2", -1},
+    {"0.17-2", "2.5.5-5", -1},
+    {"1.1.35-1+deb12u3", "1.1.35-1+deb12u3+", -1},
+    {"2.9.4-5", "2.3.3-1+b1", 1},
+    {"5.3.28+dfsg2-1", "1.8.0-1", 1},
+    {"1.0.8-5", "12.2.0-14+deb12u1", -1},
+    {"2.4.114-1+b1", "6.4-4", -1},
+    {"1.07-5", "10:1.07-5", -1},
+    {"22.3.6-1+deb12u1", "0.21.2-1", 1},
+    {"3.11.0-2", "3.11.0-02", 0},
+    {"1.7.1-1", "2.1-6.1", -1},
+    {"2:1.8-1+b1", "2:1.8-1+b1-1", -1},
+    {"3.11.2-3", "0.18+nmu1", 1},
+    {"2:1.0.10-1", "23.6-1", 1},
+    {"1.5.7-1", "0:1.5.7-1", 0},
+    {"8.6.13+dfsg-2", "8.0.6.13+dfsg-2", 1},
+    {"1.21.3-1+deb12u1", "3.7.0-0.2+b1", -1},
+    {"1.13.1-1", "1:6.0.0-2", -1},
+    {"2.4.114-1", "2.4.114-1.", -1},
+    {"4.8.12-3.1", "6Zy+500015724644486842406652883470924378103643896295691919946641518362300776-1BY000665", -1},
+    {"2.12.1+dfsg-5+deb12u4", "2.12.1+dfsg-5+deb12u4~", 1},
+    {"7.88.1-10+deb12u14", "5.7-0.5~deb12u1", 1},
+    {"2:9.0.1378-2+deb12u2", "10:900724a~~0788", -1},
+    {"1.12.0-2+b1", "1~12.0-2+b1", 1},
+    {"1.3.2-4+b1", "1.3.2-4+b1~~", 1},
+    {"122-3", "2:2.6.1-4~deb12u2", -1},
+    {"2.71-3", "2.71-3-1", -1},
+    {"1:3.5.12-1.1+deb12u1", "1:3.5.12-1.1+deb12u1a", -1},
+    {"1.20.7-10+b1", "1a20.7-10+b1", 1},
+    {"4.3-4.1", "01:10~~2.", -1},
+    {"1.15.1-5+b1", "1:1.2.13.dfsg-1", -1},
+    {"2:1.2.3-1", "0:12761288864547487524459142067908282165-aB000885255", 1},
+    {"2.2-1", "1:1.2.13.dfsg-1", -1},
+    {"1:1.11-1.1", "1:1.101-1.1", -1},
+    {"1.5-1", "1.5-1~1", 1},
+    {"1.0.11-1+deb12u2", "3.0.9-1", -1},
+    {"2.14.1-4", "002.14.1-4", 0},
+    {"1.13.2+dfsg-1", "2:1aYyZ-+853470886807483745546331416392591~+", -1},
+    {"37~deb12u1", "5.", 1},
+    {"0~20171227-0.3+deb12u1", "2.12.1+dfsg-5+deb12u4", -1},
+    {"0.8.1-1", "90.8.1-1", -1},
+    {"0.21.2-1", "0:0.21.2-1", 0},
+    {"2:1.02.185-2", "1.16.0-4", 1},
+    {"9.1.0+ds1-2", "1.12.1-0.2", 1},
+    {"4.19.0-2+deb12u1", "4.19.0-2+deb12u1~rc1", 1},
+    {"1.3.3+ds-1", "1.3.3+ds-1-0", -1},
+    {"2.9.0-1", "3.11.0-2", -1},
+    {"2.3.6-1", "2.3.6-1+b1", -1},
+    {"3.8-5", "2:1.0.10-1", -1},
+    {"10.0.0", "10.0.0.0", -1},
+    {"0.38.4-2", "0:0.38.4-2", 0},
+    {"1.2.4-0.2+deb12u1", "1~2.4-0.2+deb12u1", 1},
+    {"2.3.3-1+b1", "2.3.3-1+b1~~", 1},
+    {"3.4-1+b5", "0:3.4-1+b5", 0},
+    {"2:4.0.2-3", "2:4.0.2-3+", -1},
+    {"1:3.0.9-1", "0:7~.000253AzBbZ-04281.0279", 1},
+    {"4.15.0-1", "3007100041-Bab-90521055006855692733253558793119", -1},
+    {"1.5.0-1", "1.0.5.0-1", 1},
+    {"0.4.0-2", "2.1-6.1", -1},
+    {"23.0.0-1", "0.4.0-2", 1},
+    {"1.10.1-3", "1.10.1-3~rc1", 1},
+    {"2025b-0+deb12u2", "2025b-0+deb12u2~~", 1},
+    {"11.2.185-2", "0.58+deb12u5", 1},
+    {"2.10.1-1+b1", "0:2.10.1-1+b1", 0},
+    {"3.6.0-1+deb12u2", "0:5.10+10", -1},
+    {"23.0.0-1", "2.14.0+dfsg-1", 1},
+    {"1.5.7-1", "1.5.7-1~~", 1},
+    {"2.74.6-2+deb12u7", "1:2.74.6-2+deb12u7", -1},
+    {"3.0.9-1", "3~0.9-1", 1},
+    {"1.2.1-3", "12496346624125963751397391665045389328681~11+-1+2000115", -1},
+    {"3.25.1-1", "3.25.1-1~a", 1},
+    {"3.06-4", "3.06-4~rc1", 1},
+    {"0.22-4+b1", "0.22-4+b1-1", -1},
+    {"5.36.0-7+deb12u3", "5.36.0-7+deb12u3+b1", -1},
+    {"1:6.0.0-2", "6.0.0-2", 1},
+    {"2.74.6-2+deb12u7", "1:1.11-1.1", -1},
+    {"6.4", "0:6.4", 0},
+    {"0.18.0-1+b1", "1.51.1-3+b1", -1},
+    {"2022.1-1", "0:2022.1-1", 0},
+    {"5.36.0-7+deb12u3", "5.36.0-7+deb12u3~", 1},
+    {"3.3a-3", "1.74.0-3", 1},
+    {"44.0-2", "404.0-2", -1},
+    {"72.1-3+deb12u1", "1.15.1-5+b1", 1},
+    {"3.6.1", "3a6.1", 1},
+    {"0.8.1-1", "0~8.1-1", 1},
+    {"1.4.0-1", "1.4.0-1~rc1", 1},
+    {"23.0.1+dfsg-1", "10:23.0.1+dfsg-1", -1},
+    {"1.31-1.2", "10:1.31-1.2", -1},
+    {"1:7.7+23", "1:7.7+23~~", 1},
+    {"1.0.6-1+b1", "4.1.4-3+b1", -1},
+    {"1.1.35-1+deb12u3", "1.1.35-01+deb12u3", 0},
+    {"0.38.4-2", "0.38.4-2~~", 1},
+    {"2:3.87.1-1+deb12u1", "1:3.87.1-1+deb12u1", 1},
+    {"1:1.1.2-0+deb12u1", "1:1.1.4-1+b2", -1},
+    {"3.23+nmu1", "3.293+nmu1", -1},
+    {"1.15-1", "91.15-1", -1},
+    {"3.4.0-4", "3.4.0-4.0", -1},
+    {"1.47.0-2+b2", "0:1.47.0-2+b2", 0},
+    {"11.2.185-2", "1:3.8-4", -1},
+    {"1.6.2-3", "001.6.2-3", 0},
+    {"1:4.13+dfsg1-1+deb12u1", "1.6.39-2", 1},
+    {"0.1.4-1", "0:0.1.4-1", 0},
+    {"1.2.4-0.2+deb12u1", "1.5.82", -1},
+    {"1:3.5.12-1.1+deb12u1", "3.134", 1},
+    {"0.4.0-1+b1", "00:92ZZy+", -1},
+    {"2:2.6.1-4~deb12u2", "2:2.6.1-4~deb12u2+b1", -1},
+    {"1.201-1", "2:30371:.yA9-100+00077", -1},
+    {"1:3.8-4", "12.2.0-14+deb12u1", 1},
+    {"1:2.5.1-4", "1:2.5.1-4~rc1", 1},
+    {"0.25-1.1", "1.13.1-1", -1},
+    {"1.5.4+dfsg2-5", "0:1.5.4+dfsg2-5", 0},
+    {"3.4-2.1", "3.4-02.1", 0},
+    {"6.4-4", "06.4-4", 0},
+    {"1.6-3", "2:10668006692", -1},
+    {"72.1-3+deb12u1", "2.14-2", 1},
+    {"0.8.0-2+b1", "0.8.0-2+B1", 1},
+    {"1.201-1", "2.6.1", -1},
+    {"3.5-2+b1", "1:2YZ-+yZZ", -1},
+    {"3.3+20.604758e7-6.2", "3.3+20.604758e7-06.2", 0},
+    {"2:2.6.1-4~deb12u2", "2:2.6.1-4~DEB12U2", 1},
+    {"5.36.0-7+deb12u3", "5.36.0-07+deb12u3", 0},
+    {"1.5.1+ds-1+deb12u1", "10:1.5.1+ds-1+deb12u1", -1},
+    {"1.8.1-1", "4.3-4.1", -1},
+    {"4.5.0-6+deb12u2", "1:1.2.13.dfsg-1", -1},
+    {"1.9.4-1", "1.9.4-1+b1", -1},
+    {"1.15.1-5+b1", "1.15.1-5+b1+b1", -1},
+    {"0.2.5-1", "0.2.15-1", -1},
+    {"1.5.7-1", "1:2.39.5-0+deb12u2", -1},
+    {"2021.8.0-2", "2021.08.0-2", 0},
+    {"4.8.12-3.1", "2:2.6.1-4~deb12u2", -1},
+    {"1.6.39-2", "1.6.3009-2", -1},
+    {"1:3.6.0-7.1", "5.4.1-1", 1},
+    {"2.9.4-5", "2.3.3-9", 1},
+    {"2:4.0.2-3", "1.15.1-1+deb12u1", 1},
+    {"2.2-1", "10-ZaY+560442412410061953386292227603578520802-.~06480255255", -1},
+    {"4.2.0-1", "0:4.2.0-1", 0},
+    {"3.6.0-1+deb12u2", "3.6.0-1+DEB12U2", 1},
+    {"23.0.0-1", "23.0.0-1~rc1", 1},
+    {"1.12-1", "1.12-1~rc1", 1},
+    {"2.28.3-1", "0:2.28.3-1", 0},
+    {"1.3.4.20200120-3.1", "5aaB", -1},
+    {"2.2.2-2", "0:2.2.2-2", 0},
+    {"0.08-5", "0.08-05", 0},
+    {"3.4-2.1", "0.08-5", 1},
+    {"1.0.6-1+b1", "1.0.6-1+b1~1", 1},
+    {"1.52.0-1+deb12u2", "2.4+20151223.gitfa8646d.1-2+b2", -1},
+    {"1.4.1+dfsg-1", "1000207y009392~-abYbyYa45272253131873316401", -1},
+    {"1.0-2", "1.3-1", -1},
+    {"3.4-2.1", "1.2.1-1", 1},
+    {"1.12.0-2+b1", "0:1.12.0-2+b1", 0},
+    {"2.9.14+dfsg-1.3~deb12u4", "2.9.14+dfsg-01.3~deb12u4", 0},
+    {"5.36.0-7+deb12u3", "1.0-2", 1},
+    {"1.16.0-4", "1.51.1-3+b1", -1},
+    {"1.0.9-2+b6", "0:1.0.9-2+b6", 0},
+    {"590-2.1~deb12u2", "5900-2.1~deb12u2", -1},
+    {"2:1.0.10-1", "1.74.0-3", 1},
+    {"1:2.5.1-4", "8.2-1.3", 1},
+    {"0.2.5-1", "01:103.5072149350297086653425:", -1},
+    {"0.5.1-6", "1.5.82", -1},
+    {"2.0.0-1", "2~0.0-1", 1},
+    {"1.0.9-2+b6", "1.52.0-1+deb12u2", -1},
+    {"2.5.4-1+deb12u1", "2.5.4-1+deb12u1~a", 1},
+    {"1:1.2.3-1", "1:1.10.0+ds-0.4", -1},
+    {"1.13.2+dfsg-1", "1.13.2+dfsg-1-1", -1},
+    {"20220623.1-1+deb12u2", "20220623.1-1+deb112u2", -1},
+    {"1.3.6-4", "1.74.0.3", -1},
+    {"1.15.1-5+b1", "1:1.1.4-1+b2", -1},
+    {"2.4.7-7~deb12u1", "2.4.7-7~deb12u1~rc1", 1},
+    {"5.7-0.5~deb12u1", "1:1.0.9-1", -1},
+    {"2.71-3", "2:1.0.10-1", -1},
+    {"15.14-0+deb12u1", "20.19.5-1nodesource1", -1},
+    {"122-3", "20230209.2326-1", -1},
+    {"0.14.5-1", "12.9", -1},
+    {"2.7.6-7", "1210Y3+.", -1},
+    {"23.0.1+dfsg-1", "0:23.0.1+dfsg-1", 0},
+    {"4.95.0-1", "10:4.95.0-1", -1},
+    {"20.19.5-1nodesource1", "20.19.5-1nodesource1~a", 1},
+    {"4.19.0-2+deb12u1", "4.19.0-2+deb12u1~", 1},
+    {"1.12-1", "0:1.12-1", 0},
+    {"2:1.3.4-1+b1", "2:1+3.4-1+b1", 1},
+    {"2.35.1-1", "1.5.2-6+deb12u1", 1},
+    {"0.17-2", "1.13.1-1", -1},
+    {"1.14", "1:1.11-1.1", -1},
+    {"1.0.6-1+b1", "10.zzZ000304", -1},
+    {"2.38.1-5+deb12u3", "2.38.1-5+deb12u3A", -1},
+    {"1.31-1.2", "1.31-1.2a", -1},
+    {"9.0.2-1.1", "5+aA-999", 1},
+    {"2:1.02.185-2", "2:1a02.185-2", 1},
+    {"20230311+deb12u1", "0:20230311+deb12u1", 0},
+    {"1:2.1.5-2", "1:2.1.5-2~~", 1},
+    {"1:1.2.1-1.1", "2.14.1-4", 1},
+    {"2.2.40-1.1+deb12u1", "0:2.2.40-1.1+deb12u1", 0},
+    {"0~20171227-0.3+deb12u1", "4.3-4.1", -1},
+    {"12.9", "12a9", 1},
+    {"1.6.39-2", "0.7.0+dfsg-8+b1", 1},
+    {"1.46-1", "590-2.1~deb12u2", -1},
+    {"1.3.4.20200120-3.1", "0.13.0-1", 1},
+    {"6.4", "1.8.1-1", 1},
+    {"1.14", "4ByB-ZAb3023869291606097999936283710527716926.", -1},
+    {"1.46-1", "0:1.46-1", 0},
+    {"0.11.7-2", "8.2-1.3", -1},
+    {"2.40-2", "2.14.0+dfsg-1", 1},
+    {"5.7-0.5~deb12u1", "5.7-0.5~deb12u1~", 1},
+    {"1.0.0-2+deb12u1", "0.22-4+b1", 1},
+    {"5.3.0-4", "1.22.0-2+deb12u1", 1},
+    {"1.0.11-1+deb12u2", "800383690037677404068191942419190286804730676.bA", -1},
+    {"1.6.3-2", "1.6.3-2+b1", -1},
+    {"9.0.2-1.1", "9.0.0.2-1.1", 1},
+    {"6.9.8-1", "1:6.9.8-1", -1},
+    {"1.21.3-1+deb12u1", "72.1-3+deb12u1", -1},
+    {"0.58+deb12u5", "2:1.3.4-1+b1", -1},
+    {"1:3.0.9-1", "6.0-28", 1},
+    {"2.10.1-1+b1", "2.10.1-1+B1", 1},
+    {"3.0.8-3", "1.20.1-2+deb12u4", 1},
+    {"1.12.0-2+b1", "4.1.4-3+b1", -1},
+    {"0.270", "2.7.0-2", -1},
+    {"1.12-1", "6.4-4", -1},
+    {"3.4.4-1", "3a4.4-1", 1},
+    {"0.22-4+b1", "2.4.114-1+b1", -1},
+    {"1.15.1-5+b1", "0:1.15.1-5+b1", 0},
+    {"1:1.2.3-1", "2:900875~.YBbBB", -1},
+    {"0.13.0-1", "0.13.0-01", 0},
+    {"1:3.5.12-1.1+deb12u1", "3.5-2+b1", 1},
+    {"1:0.4.5-1", "1:0+4.5-1", 1},
+    {"1.20.1-2+deb12u4", "0.8.1-1", 1},
+    {"1.5.82", "0:1.5.82", 0},
+    {"3.6.1+dfsg+~3.5.14-1", "00:1020788142298717247550861391830971936:.BYy~", -1},
+    {"1.6-2.1+deb12u1", "15.14-0+deb12u1", -1},
+    {"2.4.7-7~deb12u1", "1:2.66-4+deb12u2", -1},
+    {"3.11.2-6+deb12u6", "20220623.1-1+deb12u2", -1},
+    {"2.3.1-3", "3.3a-3", -1},
+    {"0.11.1-1+deb12u1", "0.11.1-1+DEB12U1", 1},
+    {"9.1-1", "9.91-1", -1},
+    {"3.3a-3", "0:3.3a-3", 0},
+    {"2.14.1-4", "2.14.1-04", 0},
+    {"0.16-2", "3.42.2-3+b1", -1},
+    {"2.37-6", "2:1.8-1+b1", -1},
+    {"2.0.16-1", "1.52.0-1+deb12u2", 1},
+    {"20220623.1-1+deb12u2", "20220623.1-1+deb12u2~", 1},
+    {"3.4-1", "1.07-5", 1},
+    {"2.4.7-7~deb12u1", "0.270", 1},
+    {"0.16.1-2", "1:0.16.1-2", -1},
+    {"2.10.1-1+b1", "2.10.1-1+b1~a", 1},
+    {"1.23-3", "1.0.23-3", 1},
+    {"0.3.21+ds-4", "1.0.9-2+b6", -1},
+    {"2.3.1-3", "2.3.1-3-1", -1},
+    {"1.46-1", "1.46-1A", -1},
+    {"1:14.0-55.7~deb12u1", "1:14.0-55.7~deb12u1~rc1", 1},
+    {"6.0-3+b2", "6.0-3+b2.0", -1},
+    {"9.1-1", "10:9.1-1", -1},
+    {"1.9.5-4", "1.9.5-4a", -1},
+    {"1:1.1.2-1", "5.4.1-1", 1},
+    {"1.34+dfsg-1.2+deb12u1", "1.34+dfsg-1.2+deb12u1~", 1},
+    {"0.18.0-1+b1", "0.13.0-1", 1},
+    {"1.52.0-1+deb12u2", "7--bZy.+.3426108143683928086421311340891114070", -1},
+    {"12.4+deb12u12", "0.10.2-1", 1},
+    {"2025b-0+deb12u2", "1.10.0-3+b1", 1},
+    {"2.10-0.1+deb12u2", "1.6.2-3", 1},
+    {"2.5.4-1+deb12u1", "2.5.4-1+deb12u1A", -1},
+    {"1.74.0.3", "1.74.0.3~rc1", 1},
+    {"5.3.0-4", "0:5.3.0-4", 0},
+    {"3.7.0-0.2+b1", "0:3.7.0-0.2+b1", 0},
+    {"11.2.185-2", "11~2.185-2", 1},
+    {"1.21.22", "0.20.4-3", 1},
+    {"3.11.0-2", "25407113510847127853601901560528948873.11-y-0040516848865807684364532858yBy", -1},
+    {"3.6.0-1+deb12u2", "3.6.0-1+deb12u02", 0},
+    {"1:1.1.2-1", "2:4ybb9:99-~.+", -1},
+    {"0.4-1", "1:0.4-1", -1},
+    {"3.11.2-3", "3.11.2-3~", 1},
+    {"1.0-2", "1.3.6-4", -1},
+    {"1.3-1", "1.13.2+dfsg-1", -1},
+    {"3.5-2+b1", "1.13.1-1", 1},
+    {"2.7.0-2", "3.11.0-2", -1},
+    {"1:7.7+23", "4:12.2.0-3", -1},
+    {"6.4", "2:4.35-1", -1},
+    {"0.58+deb12u5", "0+58+deb12u5", 1},
+    {"1:14.0-55.7~deb12u1", "1:14.0-55.7~deb12u1+b1", -1},
+    {"1.07-5", "0.11.1-1+deb12u1", 1},
+    {"2.2.2-2", "2:1.8-1+b1", -1},
+    {"3.8.1-2", "5.2.15-2+b9", -1},
+    {"1.13.4~dfsg+~1.11.4-3", "1.13.4~dfsg+~1.11.4-03", 0},
+    {"0.18+nmu1", "1:000256za3YBB-0972+Z10.", -1},
+    {"1.0.6-1+b1", "1.10.8+repack1-1", -1},
+    {"1.5.4+dfsg2-5", "11.2.185-2", -1},
+    {"11+nmu1", "1.44.2-1+deb12u1", 1},
+    {"2:4.35-1", "3.8-5", 1},
+    {"2021.8.0-2", "2021.8.0-2~rc1", 1},
+    {"1.0.6-1+b1", "1.0.6-1+B1", 1},
+    {"1:4.13+dfsg1-1+deb12u1", "1.15.1-1+deb12u1", 1},
+    {"0.3.21+ds-4", "0.3.21+DS-4", 1},
+    {"1:0.9.10-1.1", "1:0.9.10-01.1", 0},
+    {"2.3.6-1", "2.3.6-01", 0},
+    {"0.16-2", "1.20.7-10+b1", -1},
+    {"3.0.17-1~deb12u3", "1.12.1-0.2", 1},
+    {"3.2.2-1", "1:1.2.1-1.1", -1},
+    {"0.18-1", "23.0.1+dfsg-1", -1},
+    {"1.10.1-3", "1.10.1-3~~", 1},
+    {"1.3.6-4", "9.1.0+ds1-2", -1},
+    {"2.35.1-1", "2.2.2-2", 1},
+    {"1.9.5-4", "2:1.9.5-4", -1},
+    {"2.0.0-1", "1:4.4.33-2", -1},
+    {"2.13.10-1", "1.0.18-1", 1},
+    {"3.0.17-1~deb12u3", "0.22-4+b1", 1},
+    {"3.11.0-2", "3.11.0-2~a", 1},
+    {"2.14.1-4", "1:21009992-~3", -1},
+    {"2.6.1", "2.0.6.1", 1},
+    {"1.17.0-3", "1:1.17.0-3", -1},
+    {"1.0-2", "20230311+deb12u1", -1},
+    {"0.16-2", "01:12+", -1},
+    {"1.31", "1.31~rc1", 1},
+    {"1.5.82", "91.5.82", -1},
+    {"1.12.0-2+b1", "1a12.0-2+b1", 1},
+    {"1.10.1-3", "0:3100~20598805572690708932796917686213203", -1},
+    {"3.134", "8.6.13", -1},
+    {"3.0.8-3", "44.0-2", -1},
+    {"2.1-6.1", "2~1-6.1", 1},
+    {"3.4-1+b5", "0.14.5-1", 1},
+    {"1.2.4-0.2+deb12u1", "1.2.4-0.2+deb12u1+", -1},
+    {"2.71-3", "2.71-03", 0},
+    {"0.04-8+b1", "2.12.1+dfsg-5+deb12u4", -1},
+    {"3.42.2-3+b1", "1.5.82", 1},
+    {"11+nmu1", "11+nmu1~~", 1},
+    {"0.04-8+b1", "0.04-8+b1~rc1", 1},
+    {"0.22-4+b1", "0~22-4+b1", 1},
+    {"1.10.1-3", "1+10.1-3", 1},
+    {"1.0.8-5+b1", "1.0.8-05+b1", 0},
+    {"1:14.0-55.7~deb12u1", "1:14.0-55.7~deb12u1~1", 1},
+    {"11+nmu1", "2.10-0.1+deb12u2", 1},
+    {"3.0.17-1~deb12u3", "23.0.1+dfsg-1", -1},
+    {"2.74.6-2+deb12u7", "11+nmu1", -1},
+    {"3.8-5", "3.8-5A", -1},
+    {"2.71-3", "2.6.0-1", 1},
+    {"3.4.4-1", "3.4.4-1~~", 1},
+    {"1.6.0-1", "2:1.6.0-1", -1},
+    {"3.6.0-1+deb12u2", "0:3.6.0-1+deb12u2", 0},
+    {"11+nmu1", "710256-584723392846425976051183738811.", -1},
+    {"2:3.87.1-1+deb12u1", "2.10.1-1+b1", 1},
+    {"1:1.1.4-1+b2", "1:1.91.4-1+b2", -1},
+    {"2.3.1-1", "0:12ABb4878679180930118835566143-100.", -1},
+    {"1.6.2-3", "1.06.2-3", 0},
+    {"1.07-5", "0:1.07-5", 0},
+    {"3.8-5", "3.8-5~~", 1},
+    {"1.8.1-1", "3.11.0-2", -1},
+    {"3.42.2-3+b1", "10:11635997050792303845055709942436859:", -1},
+    {"1.2.1-1", "4.1.4-3", -1},
+    {"9.1.0+ds1-2", "9+1.0+ds1-2", 1},
+    {"1.2.4-0.2+deb12u1", "1:14.0-55.7~deb12u1", -1},
+    {"2021.8.0-2", "1:2.66-4+deb12u2", -1},
+    {"4.8.12-3.1", "3.0-13", 1},
+    {"12.4+deb12u12", "0.2.5-1", 1},
+    {"6.9.8-1", "38.0.4-3+deb12u1", -1},
+    {"2.6.0-1", "2.6.0-01", 0},
+    {"1:14.0-55.7~deb12u1", "1:14a0-55.7~deb12u1", 1},
+    {"2.6.0-1", "2:2.6.0-1", -1},
+    {"72.1-3+deb12u1", "0:72.1-3+deb12u1", 0},
+    {"3.5-2+b1", "3.6.1+dfsg+~3.5.14-1", -1},
+    {"3.8-5", "1.6.0-1", 1},
+    {"1:1.2.1-1.1", "0.8.1-1", 1},
+    {"2:4.35-1", "1:4.35-1", 1},
+    {"1.6-2.1+deb12u1", "1.6-2.1+deb012u1", 0},
+    {"20220601+dfsg-1+b1", "1.1.35-1+deb12u3", 1},
+    {"525.85.05-3~deb12u1", "525.85.05-3~DEB12U1", 1},
+    {"3.4.0-4", "12759267257493920798245610721~.+100-bA310170931753151237017781390754973719", -1},
+    {"10.0.0", "2.28.3-1", 1},
+    {"1.4.19-3", "1a4.19-3", 1},
+    {"2:1.8-1+b1", "3.06-4", 1},
+    {"8.2-1.3", "8.2-1.3~a", 1},
+    {"2.5.13+dfsg-5", "1.0.6-3", 1},
+    {"1.21.22", "11000590-~3", -1},
+    {"0.4.0-2", "0.4.0-02", 0},
+    {"2.0.0-1", "5.7-0.5~deb12u1", -1},
+    {"1.15.1-5+b1", "2:1.0.10-1", -1},
+    {"1.0.4-2", "1:1.0.4-2", -1},
+    {"3.0.17-1~deb12u3", "6.9.8-1", -1},
+    {"2:2.6.1-4~deb12u2", "1.9.4-1", 1},
+    {"3.7.0-0.2+b1", "3.7.0-0.2+b1~", 1},
+    {"1.3.1-1", "4.3-4.1", -1},
+    {"1.12.0-2+b1", "1.12.0-2+b01", 0},
+    {"2.14.1-4", "38.0.4-3+deb12u1", -1},
+    {"3.7.0-0.2+b1", "3.7.0-0.2+b1~rc1", 1},
+    {"2022.1-1", "2022.1-1A", -1},
+    {"1.3.4.20200120-3.1", "1:0.4.5-1", -1},
+    {"1:1.10.0+ds-0.4", "8.Yz256", 1},
+    {"2.7.0-2", "0.3.21+ds-4", 1},
+    {"1:1.0.9-1", "1.2.4-0.2+deb12u1", 1},
+    {"2.14.0+dfsg-1", "1:2.14.0+dfsg-1", -1},
+    {"1.2.6-5", "2.3.1-1", -1},
+    {"2.38.1-5+deb12u3", "2.38.1-5+deb12u3~1", 1},
+    {"1.16.0-4", "3-3-Z", -1},
+    {"3.42.2-3+b1", "3.0.42.2-3+b1", 1},
+    {"2.35.1-1", "1:1.1.2-1", -1},
+    {"1:5.44-3", "1:5.44-3-1", -1},
+    {"1.2.4-0.2+deb12u1", "1:7.7+23", -1},
+    {"0.5.12-2", "1.0.9-2+b6", -1},
+    {"1:15.0.6-4+b1", "1.15-1", 1},
+    {"1:1.2.1-1.1", "0.08-5", 1},
+    {"2:2.6.1-4~deb12u2", "2:02.6.1-4~deb12u2", 0},
+    {"8.6.13-2", "2:1.8.4-2+deb12u2", -1},
+    {"2.3.3-1+b1", "2:2.3.3-1+b1", -1},
+    {"6.9.8-1", "0:6.9.8-1", 0},
+    {"2:1.2.3-1", "9.1-1", 1},
+    {"3.06-4", "5.7-0.5~deb12u1", -1},
+    {"0.5.15-2", "1:0.5.15-2", -1},
+    {"2:6.2.1+dfsg1-1.1", "2:6.2.1+dfsg1-1.1~", 1},
+    {"3.6.1+dfsg+~3.5.14-1", "3.6.1+dfsg+~3.5.14-1~1", 1},
+    {"3.40.1-2+deb12u2", "0.18+nmu1", 1},
+    {"1:1.16.5-1.3", "1.22.0-2+deb12u1", 1},
+    {"2:4.0.2-3", "2.1.28+dfsg-10", 1},
+    {"1.0.18-1", "1:1.0.18-1", -1},
+    {"0.5.12-2", "1.2.4-0.2+deb12u1", -1},
+    {"3.1-20221030-2", "3.1-20221030-2.0", -1},
+    {"2.9.0-1", "01:2:11-AY256", -1},
+    {"1.4.3-3", "11+nmu1", -1},
+    {"1.6.0-1", "1.6.0-1a", -1},
+    {"1.15.1-5+b1", "2.2-1", -1},
+    {"1.4.3-3", "0:1.4.3-3", 0},
+    {"0.16-2", "1.0.11-1+deb12u2", -1},
+    {"0.24.1-2", "0.24.1-2+b1", -1},
+    {"3.8.1-2", "10:3.8.1-2", -1},
+    {"8.2-1.3", "8.2-001.3", 0},
+    {"1.201-1", "1.6.0-1", 1},
+    {"525.85.05-3~deb12u1", "1:2.39.5-0+deb12u2", -1},
+    {"2.9.14+dfsg-1.3~deb12u4", "1.0.0-2+deb12u1", 1},
+    {"2.3.1-3", "0.1.4-1", 1},
+    {"3.1.0-3", "1:3.1.0-3", -1},
+    {"1.0.4-3", "1.0.4-3a", -1},
+    {"20220109.1", "202201009.1", -1},
+    {"2.12.1+dfsg-5+deb12u4", "2.12.01+dfsg-5+deb12u4", 0},
+    {"2.13.10-1", "2.13.10-01", 0},
+    {"0.3.9-1+b1", "4.2.0-1", -1},
+    {"2.14.1-4", "0.17-2", 1},
+    {"1.14.10-1~deb12u1", "3.0-13", -1},
+    {"1:2.39.5-0+deb12u2", "1:2a39.5-0+deb12u2", 1},
+    {"1.5-1", "3.21.12-3", -1},
+    {"9.1-1", "1.65.2+deb12u1", 1},
+    {"3.11.2-3", "3.11.2-3~a", 1},
+    {"1.4.1+dfsg-1", "1a4.1+dfsg-1", 1},
+    {"0.17-2", "3.4.4-1", -1},
+    {"3.06-4", "6.9.8-1", -1},
+    {"0.7.0+dfsg-8+b1", "1.6.3-2", -1},
+    {"1:2.39.5-0+deb12u2", "925511aBay-11A255267450166201391558529282526", 1},
+    {"3.4-2.1", "1:1.2.13.dfsg-1", -1},
+    {"0.18+nmu1", "1.15.1-1+deb12u1", -1},
+    {"2.12.1+dfsg-5+deb12u4", "2.12.1+dfsg-5+deb12u4+", -1},
+    {"3.0.8-3", "1.10.1-3", 1},
+    {"2023.3+deb12u2", "3.6.1", 1},
+    {"1:3.5.12-1.1+deb12u1", "1:3a5.12-1.1+deb12u1", 1},
+    {"0.13.0-1", "0:0.13.0-1", 0},
+    {"3.23+nmu1", "0:3.23+nmu1", 0},
+    {"3.0-13", "3.0-13~", 1},
+    {"525.85.05-3~deb12u1", "3.6.0-1+deb12u2", 1},
+    {"23.0.0-1", "0.5.15-2", 1},
+    {"3.11.0-2", "44.0-2", -1},
+    {"2.3.1-1", "2:1.0.10-1", -1},
+    {"2025b-0+deb12u2", "0:2025b-0+deb12u2", 0},
+    {"2.1.12-stable-8", "000900+-430375692891240041377223949", -1},
+    {"6.4", "1.0.18-1", 1},
+    {"1.8.9-2", "2.1.12-stable-8", -1},
+    {"4:12.2.0-3", "1.0.18-1", 1},
+    {"2.3.6-1", "3.2.2-1", -1},
+    {"12.4+deb12u12", "2:3.87.1-1+deb12u1", -1},
+    {"0~20171227-0.3+deb12u1", "0~20171227-0.3+deb12u1+b1", -1},
+    {"1.3.1-1", "1.3.1-1-0", -1},
+    {"1.5.82", "2.2.2-2", -1},
+    {"3.0.9-1", "5.4.1-1", -1},
+    {"2.12.1+dfsg-5+deb12u4", "100--000940-~.00968", -1},
+    {"20230209.2326-1", "2:20230209.2326-1", -1},
+    {"3.6.0-1+deb12u2", "3.6.90-1+deb12u2", -1},
+    {"6.4-4", "0.5.1-6", 1},
+    {"9.1-1", "2.74.6-2+deb12u7", 1},
+    {"2:3.87.1-1+deb12u1", "11ay~az.-100.+", 1},
+    {"2.13.10-1", "1.8.1-1", 1},
+    {"3.0-13", "3.0-013", 0},
+    {"4.0.0+ds-2", "4.0.0+ds-02", 0},
+    {"1.0.8+1-1", "0:1.0.8+1-1", 0},
+    {"2.35.1-1", "2.35.91-1", -1},
+    {"0.4-1", "2.6.1", -1},
+    {"1:1.0.9-1", "3.0.17-1~deb12u3", 1}
+};
@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sys.h"
+#include "version.h"
+#include "versioncorpus.h"
+
+#define NUM_CORPUS                      (sizeof (corpus) / sizeof (corpus[0]))
+#define BENCH_ROUNDS                    200
+
+struct key
+{
+
+    char *data;
+    unsigned int length;
+
+};
+
+static volatile int sink;
+
+static int sign(int c)
+{
+
+    return (c > 0) - (c < 0);
+
+}
+
+static double seconds(void)
+{
+
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1000000000.0;
+
+}
+
+static struct key *compilekeys(void)
+{
+
+    struct key *keys = calloc(NUM_CORPUS * 2, sizeof (struct key));
+    unsigned int i;
+
+    for (i = 0; i < NUM_CORPUS * 2; i++)
+    {
+
+        char *version = (i % 2) ? corpus[i / 2].version2 : corpus[i / 2].version1;
+        unsigned int length = strlen(version);
+
+        keys[i].data = malloc(VERSION_KEYSIZE(length));
+        keys[i].length = version_key(keys[i].data, version, length);
+
+    }
+
+    return keys;
+
+}
+
+static void freekeys(struct key *keys)
+{
+
+    unsigned int i;
+
+    for (i = 0; i < NUM_CORPUS * 2; i++)
+        free(keys[i].data);
+
+    free(keys);
+
+}
+
+static int check(void)
+{
+
+    struct key *keys = compilekeys();
+    unsigned int failed = 0;
+    unsigned int i;
+
+    for (i = 0; i < NUM_CORPUS; i++)
+    {
+
+        struct corpus *current = &corpus[i];
+        int c1 = sign(version_compare(current->version1, strlen(current->version1), current->version2, strlen(current->version2)));
+        int c2 = sign(version_compare(current->version2, strlen(current->version2), current->version1, strlen(current->version1)));
+        int c3 = sign(version_comparekeys(keys[i * 2].data, keys[i * 2].length, keys[i * 2 + 1].data, keys[i * 2 + 1].length));
+
+        if (c1 != current->result || c2 != -current->result || c3 != current->result)
+        {
+
+            dprintf(SYS_FD_STDOUT, "FAIL %s %s: expected %d, got %d (reversed %d, keys %d)\n", current->version1, current->version2, current->result, c1, -c2, c3);
+
+            failed++;
+
+        }
+
+    }
+
+    freekeys(keys);
+    dprintf(SYS_FD_STDOUT, "version: %lu/%lu comparisons passed\n", NUM_CORPUS - failed, NUM_CORPUS);
+
+    return (failed) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
+
+static int bench(void)
+{
+
+    struct key *keys = compilekeys();
+    unsigned int lengths[NUM_CORPUS * 2];
+    unsigned int maxlength = 0;
+    char *buffer;
+    unsigned int i;
+    unsigned int j;
+    double start;
+    double end;
+
+    for (i = 0; i < NUM_CORPUS * 2; i++)
+    {
+
+        lengths[i] = strlen((i % 2) ? corpus[i / 2].version2 : corpus[i / 2].version1);
+
+        if (lengths[i] > maxlength)
+            maxlength = lengths[i];
+
+    }
+
+    buffer = malloc(VERSION_KEYSIZE(maxlength));
+
+    start = seconds();
+
+    for (j = 0; j < BENCH_ROUNDS; j++)
+    {
+
+        for (i = 0; i < NUM_CORPUS; i++)
+            sink += sign(version_compare(corpus[i].version1, lengths[i * 2], corpus[i].version2, lengths[i * 2 + 1]));
+
+    }
+
+    end = seconds();
+
+    dprintf(SYS_FD_STDOUT, "compare per-call %12.0f cmp/s\n", NUM_CORPUS * BENCH_ROUNDS / (end - start));
+
+    start = seconds();
+
+    for (j = 0; j < BENCH_ROUNDS * 10; j++)
+    {
+
+        for (i = 0; i < NUM_CORPUS; i++)
+            sink += sign(version_comparekeys(keys[i * 2].data, keys[i * 2].length, keys[i * 2 + 1].data, keys[i * 2 + 1].length));
+
+    }
+
+    end = seconds();
+
+    dprintf(SYS_FD_STDOUT, "compare keys     %12.0f cmp/s\n", NUM_CORPUS * BENCH_ROUNDS * 10 / (end - start));
+
+    start = seconds();
+
+    for (j = 0; j < BENCH_ROUNDS; j++)
+    {
+
+        for (i = 0; i < NUM_CORPUS * 2; i++)
+            sink += version_key(buffer, (i % 2) ? corpus[i / 2].version2 : corpus[i / 2].version1, lengths[i]);
+
+    }
+
+    end = seconds();
+
+    dprintf(SYS_FD_STDOUT, "key build        %12.0f keys/s\n", NUM_CORPUS * 2 * BENCH_ROUNDS / (end - start));
+    free(buffer);
+    freekeys(keys);
+
+    return EXIT_SUCCESS;
+
+}
+
+int main(int argc, char **argv)
+{
+
+    if (argc > 1 && !strcmp(argv[1], "--bench"))
+        return bench();
+
+    return check();
+
+}